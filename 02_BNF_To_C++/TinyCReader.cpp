@@ -56,22 +56,29 @@ void TinyCReader::read(const char* sFile)
 	//////////////// THIS PIECE OF CODE WILL REMAIN COMMON FOR ALL //////////////////
 	if (GrammerUtils::read(sFile))
 	{
-		addKeywords();
-		GrammerUtils::getNextToken();
-
-		m_pASTRootNode = new Tree();
-		{
-			m_pASTRootNode->m_eASTNodeType = ASTNodeType::ASTNode_ROOT;
-			m_pASTCurrentNode = m_pASTRootNode;
-		}
-
-		def();
+		parse();
 
 		GrammerUtils::generateCode(m_pASTRootNode);
 	}
 	/////////////////////////////////////////////////////////////////////////////////
 }
 
+// Parses the tokens GrammerUtils::read() left into the AST @ m_pASTRootNode, without generating code.
+// benchmark/parseBenchmark.cpp times this on its own.
+bool TinyCReader::parse()
+{
+	addKeywords();
+	GrammerUtils::getNextToken();
+
+	m_pASTRootNode = new Tree();
+	{
+		m_pASTRootNode->m_eASTNodeType = ASTNodeType::ASTNode_ROOT;
+		m_pASTCurrentNode = m_pASTRootNode;
+	}
+
+	return def();
+}
+
 std::string TinyCReader::popOperator()
 {
 	if(!m_vOperatorStack.empty())
@@ -355,6 +362,19 @@ std::string	TinyCReader::getFullyQualifiedNameForVariable(Tree* pNode, std::stri
 		}
 	}
 
+	if (NOT bFound)
+	{
+		for (Tree* pHostVar : FunctionInfo::m_vHostVariables)
+		{
+			if (pHostVar->getAdditionalInfoFor("text") == sVariable)
+			{
+				sFullyQualifiedName = pHostVar->getAdditionalInfoFor("text");
+				bFound = true;
+				break;
+			}
+		}
+	}
+
 	// Check for 'Member Variables'
 	if (NOT bFound)
 	{
@@ -429,6 +449,28 @@ bool TinyCReader::isValidType(std::string sType)
 	return false;
 }
 
+void TinyCReader::addIntrinsic(std::string sIntrinsic)
+{
+	GrammerUtils::m_vIntrinsics.push_back(sIntrinsic);
+	GrammerUtils::m_vKeywords.push_back(sIntrinsic);
+}
+
+bool TinyCReader::isValidIntrinsic(std::string sIntrinsic)
+{
+	for (std::string sInBuiltIntrinsic : GrammerUtils::m_vIntrinsics)
+	{
+		if (sIntrinsic == sInBuiltIntrinsic)
+		{
+			GrammerUtils::m_pPrevToken = GrammerUtils::m_pToken;
+			GrammerUtils::getNextToken();
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void TinyCReader::addStructType(std::string sType)
 {
 	GrammerUtils::m_vUserDefinedTypes.push_back(sType);
@@ -655,6 +697,18 @@ bool TinyCReader::def() {
 											addType("int16_t");
 											addType("int32_t");
 											addType("float");
+											
+											addIntrinsic("sin");
+											addIntrinsic("cos");
+											addIntrinsic("sqrt");
+											addIntrinsic("abs");
+											addIntrinsic("min");
+											addIntrinsic("max");
+											addIntrinsic("floor");
+											addIntrinsic("lerp");
+											addIntrinsic("rand");
+											addIntrinsic("srand");
+											addIntrinsic("await");
 										
 while(true) {
 if(objectList()) {
@@ -668,23 +722,42 @@ return true;
 }
 
 bool TinyCReader::objectList() {
-if(interfaceDeclaration()) {
+uint32_t iPredicted_0 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_FUNCTIONCALL:
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+case TokenType_::Type::TK_DEREF:
+case TokenType_::Type::TK_DEREFARRAY:
+case TokenType_::Type::TK_MEMBERACCESS:
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+iPredicted_0 = 0x00000037; break;
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_0 = 0x0000003F; break;
+}
+if((iPredicted_0 & 0x00000001) && interfaceDeclaration()) {
 return true;
 }
 else
-if(structDeclaration()) {
+if((iPredicted_0 & 0x00000002) && structDeclaration()) {
 return true;
 }
 else
-if(staticDeclaration()) {
+if((iPredicted_0 & 0x00000004) && staticDeclaration()) {
 return true;
 }
 else
-if(functionDef()) {
+if((iPredicted_0 & 0x00000008) && functionDef()) {
 return true;
 }
 else
-if(systemFunctionDef()) {
+if((iPredicted_0 & 0x00000010) && systemFunctionDef()) {
+return true;
+}
+else
+if((iPredicted_0 & 0x00000020) && hostDataDeclaration()) {
 return true;
 }
 else
@@ -965,11 +1038,26 @@ return true;
 }
 
 bool TinyCReader::structObjectList() {
-if(structInlineFunction()) {
+uint32_t iPredicted_1 = 0x00000002;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_IDENTIFIER:
+case TokenType_::Type::TK_STRING:
+case TokenType_::Type::TK_FUNCTIONCALL:
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+case TokenType_::Type::TK_DEREF:
+case TokenType_::Type::TK_DEREFARRAY:
+case TokenType_::Type::TK_MEMBERACCESS:
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+iPredicted_1 = 0x00000003; break;
+}
+if((iPredicted_1 & 0x00000001) && structInlineFunction()) {
 return true;
 }
 else
-if(newPtrOrArrayOrInt()) {
+if((iPredicted_1 & 0x00000002) && newPtrOrArrayOrInt()) {
 return true;
 }
 else
@@ -1141,6 +1229,36 @@ return true;
 
 }
 
+bool TinyCReader::hostDataDeclaration() {
+if(!GrammerUtils::match("HOSTDATA", MANDATORY_))
+return false;
+if(!primitiveType())
+return false;
+
+																std::string sType = PREV_TOKEN_TEXT;
+																assert(sType == "int32_t" || sType == "float");
+															
+if(!GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, MANDATORY_))
+return false;
+
+																Tree* pHostDataNode = makeLeaf(ASTNodeType::ASTNode_TYPEHOSTDATA, PREV_TOKEN_TEXT);
+																{
+																	GrammerUtils::m_vUserDefinedVariables.push_back(PREV_TOKEN_TEXT);
+																
+																	SET_INFO_FOR_KEY(pHostDataNode, "givenName", PREV_TOKEN_TEXT);
+																	SET_INFO_FOR_KEY(pHostDataNode, "type", sType);
+																	SET_INFO_FOR_KEY(pHostDataNode, "scope", toString(E_VARIABLESCOPE::HOST));
+																
+																	m_pASTCurrentNode->addChild(pHostDataNode);
+																	FunctionInfo::addHostVariable(pHostDataNode);
+																}
+															
+if(!GrammerUtils::match(';', MANDATORY_))
+return false;
+return true;
+
+}
+
 bool TinyCReader::functionDef() {
 
 																std::string sPrevText = PREV_TOKEN_TEXT;
@@ -1336,6 +1454,10 @@ if(systemFunctionCall()) {
 return true;
 }
 else
+if(intrinsicCall()) {
+return true;
+}
+else
 if(functionCall()) {
 return true;
 }
@@ -1415,11 +1537,20 @@ return true;
 }
 
 bool TinyCReader::prePostFixedIncrDecr() {
-if(preFixIncrDecr()) {
+uint32_t iPredicted_5 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+iPredicted_5 = 0x00000001; break;
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+iPredicted_5 = 0x00000002; break;
+}
+if((iPredicted_5 & 0x00000001) && preFixIncrDecr()) {
 return true;
 }
 else
-if(postFixIncrDecr()) {
+if((iPredicted_5 & 0x00000002) && postFixIncrDecr()) {
 return true;
 }
 else
@@ -1430,7 +1561,14 @@ return true;
 }
 
 bool TinyCReader::preFixIncrDecr() {
-if(GrammerUtils::match(TokenType_::Type::TK_PREFIXDECR, OPTIONAL_)) {
+uint32_t iPredicted_6 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_PREFIXDECR:
+iPredicted_6 = 0x00000001; break;
+case TokenType_::Type::TK_PREFIXINCR:
+iPredicted_6 = 0x00000002; break;
+}
+if((iPredicted_6 & 0x00000001) && GrammerUtils::match(TokenType_::Type::TK_PREFIXDECR, OPTIONAL_)) {
 
 																std::string sVariableName = PREV_TOKEN_TEXT;
 																std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
@@ -1443,7 +1581,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_PREFIXDECR, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_PREFIXINCR, OPTIONAL_)) {
+if((iPredicted_6 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_PREFIXINCR, OPTIONAL_)) {
 
 																std::string sVariableName = PREV_TOKEN_TEXT;
 																std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
@@ -1463,7 +1601,14 @@ return true;
 }
 
 bool TinyCReader::postFixIncrDecr() {
-if(GrammerUtils::match(TokenType_::Type::TK_POSTFIXDECR, OPTIONAL_)) {
+uint32_t iPredicted_7 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_POSTFIXDECR:
+iPredicted_7 = 0x00000001; break;
+case TokenType_::Type::TK_POSTFIXINCR:
+iPredicted_7 = 0x00000002; break;
+}
+if((iPredicted_7 & 0x00000001) && GrammerUtils::match(TokenType_::Type::TK_POSTFIXDECR, OPTIONAL_)) {
 
 																std::string sVariableName = PREV_TOKEN_TEXT;
 																std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
@@ -1476,7 +1621,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_POSTFIXDECR, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_POSTFIXINCR, OPTIONAL_)) {
+if((iPredicted_7 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_POSTFIXINCR, OPTIONAL_)) {
 
 																std::string sVariableName = PREV_TOKEN_TEXT;
 																std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
@@ -1574,6 +1719,53 @@ return true;
 
 }
 
+bool TinyCReader::intrinsicCall() {
+if(!intrinsicName())
+return false;
+
+															std::string sIdentifier = PREV_TOKEN_TEXT;
+														
+if(!GrammerUtils::match('(', MANDATORY_))
+return false;
+
+															Tree* pIntrinsicNode = makeLeaf(ASTNodeType::ASTNode_INTRINSIC, sIdentifier.c_str());
+															Tree* pTemp = nullptr;
+															{
+																m_pASTCurrentNode->addChild(pIntrinsicNode);
+																
+																pTemp = m_pASTCurrentNode;
+																m_pASTCurrentNode = pIntrinsicNode;
+																
+																m_vPostFix.push_back("_START_");
+																m_vOperatorStack.push("_START_");
+															}
+														
+if(!functionArgumentList()) {
+}
+else {
+}
+
+if(!GrammerUtils::match(')', MANDATORY_))
+return false;
+
+															// Clear Up Expression engine.
+															clearTopOfExpressionStack();
+															
+															m_pASTCurrentNode = pTemp;
+														
+return true;
+
+}
+
+bool TinyCReader::intrinsicName() {
+
+											std::string sName = GrammerUtils::m_pToken.getText(); 
+											return isValidIntrinsic(sName);
+										
+return true;
+
+}
+
 bool TinyCReader::functionCall() {
 if(!GrammerUtils::match(TokenType_::Type::TK_FUNCTIONCALL, MANDATORY_))
 return false;
@@ -1870,7 +2062,14 @@ return true;
 }
 
 bool TinyCReader::switchArgument() {
-if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
+uint32_t iPredicted_9 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_9 = 0x00000001; break;
+case TokenType_::Type::TK_INTEGER:
+iPredicted_9 = 0x00000002; break;
+}
+if((iPredicted_9 & 0x00000001) && GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 
 														std::string sIdentifier = PREV_TOKEN_TEXT;
 														std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sIdentifier.c_str());
@@ -1883,7 +2082,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
+if((iPredicted_9 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
 
 														Tree* pSwitchArgumentNode = makeLeaf(ASTNodeType::ASTNode_INTEGER, PREV_TOKEN_TEXT);
 														m_pASTCurrentNode->m_pLeftNode = pSwitchArgumentNode;
@@ -2162,11 +2361,16 @@ return true;
 }
 
 bool TinyCReader::initExpr() {
-if(newPtrOrArrayOrInt()) {
+uint32_t iPredicted_10 = 0x00000001;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_10 = 0x00000003; break;
+}
+if((iPredicted_10 & 0x00000001) && newPtrOrArrayOrInt()) {
 return true;
 }
 else
-if(assignmentRHS()) {
+if((iPredicted_10 & 0x00000002) && assignmentRHS()) {
 return true;
 }
 else
@@ -2194,11 +2398,21 @@ return true;
 }
 
 bool TinyCReader::loopExpr() {
-if(prePostFixedIncrDecr()) {
+uint32_t iPredicted_11 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+iPredicted_11 = 0x00000001; break;
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_11 = 0x00000002; break;
+}
+if((iPredicted_11 & 0x00000001) && prePostFixedIncrDecr()) {
 return true;
 }
 else
-if(assignmentRHS()) {
+if((iPredicted_11 & 0x00000002) && assignmentRHS()) {
 return true;
 }
 else
@@ -2567,7 +2781,16 @@ return true;
 }
 
 bool TinyCReader::putcList() {
-if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
+uint32_t iPredicted_13 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_13 = 0x00000001; break;
+case TokenType_::Type::TK_INTEGER:
+iPredicted_13 = 0x00000002; break;
+case TokenType_::Type::TK_CHARACTER:
+iPredicted_13 = 0x00000004; break;
+}
+if((iPredicted_13 & 0x00000001) && GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 
 																std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, PREV_TOKEN_TEXT);
 																assert(!sFullyQualifiedVariableName.empty());
@@ -2579,7 +2802,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
+if((iPredicted_13 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
 
 																Tree* pIntegerNode = makeLeaf(ASTNodeType::ASTNode_INTEGER, PREV_TOKEN_TEXT);
 																m_pASTCurrentNode->addChild(pIntegerNode);
@@ -2587,7 +2810,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_CHARACTER, OPTIONAL_)) {
+if((iPredicted_13 & 0x00000004) && GrammerUtils::match(TokenType_::Type::TK_CHARACTER, OPTIONAL_)) {
 
 																Tree* pCharacterNode = makeLeaf(ASTNodeType::ASTNode_CHARACTER, PREV_TOKEN_TEXT);
 																m_pASTCurrentNode->addChild(pCharacterNode);
@@ -2723,11 +2946,19 @@ return true;
 }
 
 bool TinyCReader::primPtrOrArrayOrInt() {
-if(primPtr()) {
+uint32_t iPredicted_14 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_MUL:
+iPredicted_14 = 0x00000001; break;
+case TokenType_::Type::TK_IDENTIFIER:
+case TokenType_::Type::TK_DEREFARRAY:
+iPredicted_14 = 0x00000002; break;
+}
+if((iPredicted_14 & 0x00000001) && primPtr()) {
 return true;
 }
 else
-if(primArrayOrInt()) {
+if((iPredicted_14 & 0x00000002) && primArrayOrInt()) {
 return true;
 }
 else
@@ -2792,11 +3023,18 @@ return true;
 }
 
 bool TinyCReader::primArrayOrInt() {
-if(primArray()) {
+uint32_t iPredicted_15 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_DEREFARRAY:
+iPredicted_15 = 0x00000001; break;
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_15 = 0x00000002; break;
+}
+if((iPredicted_15 & 0x00000001) && primArray()) {
 return true;
 }
 else
-if(primType()) {
+if((iPredicted_15 & 0x00000002) && primType()) {
 return true;
 }
 else
@@ -2982,11 +3220,25 @@ return true;
 }
 
 bool TinyCReader::ptrAssign() {
-if(malloc()) {
+uint32_t iPredicted_16 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_IDENTIFIER:
+case TokenType_::Type::TK_FUNCTIONCALL:
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+case TokenType_::Type::TK_DEREF:
+case TokenType_::Type::TK_DEREFARRAY:
+case TokenType_::Type::TK_MEMBERACCESS:
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+iPredicted_16 = 0x00000003; break;
+}
+if((iPredicted_16 & 0x00000001) && malloc()) {
 return true;
 }
 else
-if(memChr()) {
+if((iPredicted_16 & 0x00000002) && memChr()) {
 return true;
 }
 else
@@ -3099,11 +3351,18 @@ return true;
 }
 
 bool TinyCReader::structMemberVariableAssignmentOrFunctionCall() {
-if(structStaticMemberAccess()) {
+uint32_t iPredicted_17 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+iPredicted_17 = 0x00000001; break;
+case TokenType_::Type::TK_MEMBERACCESS:
+iPredicted_17 = 0x00000002; break;
+}
+if((iPredicted_17 & 0x00000001) && structStaticMemberAccess()) {
 return true;
 }
 else
-if(structObjectMemberAccess()) {
+if((iPredicted_17 & 0x00000002) && structObjectMemberAccess()) {
 return true;
 }
 else
@@ -3218,14 +3477,23 @@ return true;
 }
 
 bool TinyCReader::structVariableLValueOrArrayLValueOrFunctionCall() {
-if(functionCall()) {
+uint32_t iPredicted_18 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_FUNCTIONCALL:
+iPredicted_18 = 0x00000001; break;
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_18 = 0x00000002; break;
+case TokenType_::Type::TK_DEREFARRAY:
+iPredicted_18 = 0x00000004; break;
+}
+if((iPredicted_18 & 0x00000001) && functionCall()) {
 
 															m_pASTCurrentNode->m_eASTNodeType = ASTNodeType::ASTNode_MEMBERACCESS;
 														
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
+if((iPredicted_18 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 
 															Tree* pIdentifierLeaf = makeLeaf(ASTNodeType::ASTNode_MEMBERACCESS, PREV_TOKEN_TEXT);
 															{
@@ -3237,7 +3505,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 return true;
 }
 else
-if(structMemberVariableLValueArrayAccess()) {
+if((iPredicted_18 & 0x00000004) && structMemberVariableLValueArrayAccess()) {
 return true;
 }
 else
@@ -3388,11 +3656,34 @@ return true;
 }
 
 bool TinyCReader::expr() {
-if(ptrAssign()) {
+uint32_t iPredicted_20 = 0x00000002;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_SUB:
+case TokenType_::Type::TK_NOT:
+case TokenType_::Type::TK_BITWISENOT:
+case TokenType_::Type::TK_LPAREN:
+case TokenType_::Type::TK_INTEGER:
+case TokenType_::Type::TK_FLOAT:
+case TokenType_::Type::TK_CHARACTER:
+case TokenType_::Type::TK_SYSTEMFUNCTIONCALL:
+iPredicted_20 = 0x00000002; break;
+case TokenType_::Type::TK_IDENTIFIER:
+case TokenType_::Type::TK_FUNCTIONCALL:
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+case TokenType_::Type::TK_DEREF:
+case TokenType_::Type::TK_DEREFARRAY:
+case TokenType_::Type::TK_MEMBERACCESS:
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+iPredicted_20 = 0x00000003; break;
+}
+if((iPredicted_20 & 0x00000001) && ptrAssign()) {
 return true;
 }
 else
-if(startExpr()) {
+if((iPredicted_20 & 0x00000002) && startExpr()) {
 return true;
 }
 else
@@ -3426,14 +3717,21 @@ return true;
 }
 
 bool TinyCReader::logicalAndOr() {
-if(GrammerUtils::match("&&", OPTIONAL_)) {
+uint32_t iPredicted_21 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_LOGICALAND:
+iPredicted_21 = 0x00000001; break;
+case TokenType_::Type::TK_LOGICALOR:
+iPredicted_21 = 0x00000002; break;
+}
+if((iPredicted_21 & 0x00000001) && GrammerUtils::match("&&", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("&&");
 													
 return true;
 }
 else
-if(GrammerUtils::match("||", OPTIONAL_)) {
+if((iPredicted_21 & 0x00000002) && GrammerUtils::match("||", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("||");
 													
@@ -3470,14 +3768,21 @@ return true;
 }
 
 bool TinyCReader::eqNeq() {
-if(GrammerUtils::match("==", OPTIONAL_)) {
+uint32_t iPredicted_22 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_EQ:
+iPredicted_22 = 0x00000001; break;
+case TokenType_::Type::TK_NEQ:
+iPredicted_22 = 0x00000002; break;
+}
+if((iPredicted_22 & 0x00000001) && GrammerUtils::match("==", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("==");
 													
 return true;
 }
 else
-if(GrammerUtils::match("!=", OPTIONAL_)) {
+if((iPredicted_22 & 0x00000002) && GrammerUtils::match("!=", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("!=");
 													
@@ -3514,28 +3819,39 @@ return true;
 }
 
 bool TinyCReader::lteqGteq() {
-if(GrammerUtils::match('<', OPTIONAL_)) {
+uint32_t iPredicted_23 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_LT:
+iPredicted_23 = 0x00000001; break;
+case TokenType_::Type::TK_LTEQ:
+iPredicted_23 = 0x00000002; break;
+case TokenType_::Type::TK_GT:
+iPredicted_23 = 0x00000004; break;
+case TokenType_::Type::TK_GTEQ:
+iPredicted_23 = 0x00000008; break;
+}
+if((iPredicted_23 & 0x00000001) && GrammerUtils::match('<', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("<");
 													
 return true;
 }
 else
-if(GrammerUtils::match("<=", OPTIONAL_)) {
+if((iPredicted_23 & 0x00000002) && GrammerUtils::match("<=", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("<=");
 													
 return true;
 }
 else
-if(GrammerUtils::match('>', OPTIONAL_)) {
+if((iPredicted_23 & 0x00000004) && GrammerUtils::match('>', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush(">");
 													
 return true;
 }
 else
-if(GrammerUtils::match(">=", OPTIONAL_)) {
+if((iPredicted_23 & 0x00000008) && GrammerUtils::match(">=", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush(">=");
 													
@@ -3572,14 +3888,21 @@ return true;
 }
 
 bool TinyCReader::plusMinus() {
-if(GrammerUtils::match('+', OPTIONAL_)) {
+uint32_t iPredicted_24 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_ADD:
+iPredicted_24 = 0x00000001; break;
+case TokenType_::Type::TK_SUB:
+iPredicted_24 = 0x00000002; break;
+}
+if((iPredicted_24 & 0x00000001) && GrammerUtils::match('+', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("+");
 													
 return true;
 }
 else
-if(GrammerUtils::match('-', OPTIONAL_)) {
+if((iPredicted_24 & 0x00000002) && GrammerUtils::match('-', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("-");
 													
@@ -3616,21 +3939,30 @@ return true;
 }
 
 bool TinyCReader::mulDivMod() {
-if(GrammerUtils::match('*', OPTIONAL_)) {
+uint32_t iPredicted_25 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_MUL:
+iPredicted_25 = 0x00000001; break;
+case TokenType_::Type::TK_DIV:
+iPredicted_25 = 0x00000002; break;
+case TokenType_::Type::TK_MOD:
+iPredicted_25 = 0x00000004; break;
+}
+if((iPredicted_25 & 0x00000001) && GrammerUtils::match('*', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("*");
 													
 return true;
 }
 else
-if(GrammerUtils::match('/', OPTIONAL_)) {
+if((iPredicted_25 & 0x00000002) && GrammerUtils::match('/', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("/");
 													
 return true;
 }
 else
-if(GrammerUtils::match('%', OPTIONAL_)) {
+if((iPredicted_25 & 0x00000004) && GrammerUtils::match('%', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("%");
 													
@@ -3667,35 +3999,48 @@ return true;
 }
 
 bool TinyCReader::bitwiseOrAndXor() {
-if(GrammerUtils::match('&', OPTIONAL_)) {
+uint32_t iPredicted_26 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_BITWISEAND:
+iPredicted_26 = 0x00000001; break;
+case TokenType_::Type::TK_BITWISEOR:
+iPredicted_26 = 0x00000002; break;
+case TokenType_::Type::TK_BITWISEXOR:
+iPredicted_26 = 0x00000004; break;
+case TokenType_::Type::TK_BITWISELEFTSHIFT:
+iPredicted_26 = 0x00000008; break;
+case TokenType_::Type::TK_BITWISERIGHTSHIFT:
+iPredicted_26 = 0x00000010; break;
+}
+if((iPredicted_26 & 0x00000001) && GrammerUtils::match('&', OPTIONAL_)) {
 
 														checkOpPrecedenceAndPush("&");
 													
 return true;
 }
 else
-if(GrammerUtils::match('|', OPTIONAL_)) {
+if((iPredicted_26 & 0x00000002) && GrammerUtils::match('|', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("|");
 													
 return true;
 }
 else
-if(GrammerUtils::match('^', OPTIONAL_)) {
+if((iPredicted_26 & 0x00000004) && GrammerUtils::match('^', OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("^");
 													
 return true;
 }
 else
-if(GrammerUtils::match("<<", OPTIONAL_)) {
+if((iPredicted_26 & 0x00000008) && GrammerUtils::match("<<", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush("<<");
 													
 return true;
 }
 else
-if(GrammerUtils::match(">>", OPTIONAL_)) {
+if((iPredicted_26 & 0x00000010) && GrammerUtils::match(">>", OPTIONAL_)) {
  
 														checkOpPrecedenceAndPush(">>");
 													
@@ -3709,15 +4054,39 @@ return true;
 }
 
 bool TinyCReader::primary() {
-if(operands()) {
+uint32_t iPredicted_27 = 0x00000001;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_IDENTIFIER:
+case TokenType_::Type::TK_INTEGER:
+case TokenType_::Type::TK_FLOAT:
+case TokenType_::Type::TK_CHARACTER:
+case TokenType_::Type::TK_FUNCTIONCALL:
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+case TokenType_::Type::TK_DEREF:
+case TokenType_::Type::TK_DEREFARRAY:
+case TokenType_::Type::TK_MEMBERACCESS:
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+case TokenType_::Type::TK_SYSTEMFUNCTIONCALL:
+iPredicted_27 = 0x00000001; break;
+case TokenType_::Type::TK_SUB:
+case TokenType_::Type::TK_NOT:
+case TokenType_::Type::TK_BITWISENOT:
+iPredicted_27 = 0x00000003; break;
+case TokenType_::Type::TK_LPAREN:
+iPredicted_27 = 0x00000005; break;
+}
+if((iPredicted_27 & 0x00000001) && operands()) {
 return true;
 }
 else
-if(unary_expr()) {
+if((iPredicted_27 & 0x00000002) && unary_expr()) {
 return true;
 }
 else
-if(paren_expr()) {
+if((iPredicted_27 & 0x00000004) && paren_expr()) {
 return true;
 }
 else
@@ -3731,43 +4100,75 @@ bool TinyCReader::operands() {
 
 											std::string sOperand;
 										
-if(systemFunctionCall()) {
+uint32_t iPredicted_28 = 0x00000002;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_SYSTEMFUNCTIONCALL:
+iPredicted_28 = 0x00000003; break;
+case TokenType_::Type::TK_DEREF:
+iPredicted_28 = 0x0000001A; break;
+case TokenType_::Type::TK_FUNCTIONCALL:
+iPredicted_28 = 0x0000001E; break;
+case TokenType_::Type::TK_MEMBERACCESS:
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+iPredicted_28 = 0x0000003A; break;
+case TokenType_::Type::TK_IDENTIFIER:
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+case TokenType_::Type::TK_DEREFARRAY:
+iPredicted_28 = 0x0000005A; break;
+case TokenType_::Type::TK_INTEGER:
+iPredicted_28 = 0x00000082; break;
+case TokenType_::Type::TK_FLOAT:
+iPredicted_28 = 0x00000102; break;
+case TokenType_::Type::TK_CHARACTER:
+iPredicted_28 = 0x00000202; break;
+}
+if((iPredicted_28 & 0x00000001) && systemFunctionCall()) {
 
 																handleFunctionCallInExpr("sysFunc");
 															
 return true;
 }
 else
-if(functionCall()) {
+if((iPredicted_28 & 0x00000002) && intrinsicCall()) {
+
+																handleFunctionCallInExpr("intrinsic");
+															
+return true;
+}
+else
+if((iPredicted_28 & 0x00000004) && functionCall()) {
 
 																handleFunctionCallInExpr("scriptFunc");
 															
 return true;
 }
 else
-if(memCmp()) {
+if((iPredicted_28 & 0x00000008) && memCmp()) {
 
 																handleFunctionCallInExpr("");
 															
 return true;
 }
 else
-if(sizeOf()) {
+if((iPredicted_28 & 0x00000010) && sizeOf()) {
 
 																handleFunctionCallInExpr("");
 															
 return true;
 }
 else
-if(structStaticOrObjectAccess()) {
+if((iPredicted_28 & 0x00000020) && structStaticOrObjectAccess()) {
 return true;
 }
 else
-if(tk_identifier()) {
+if((iPredicted_28 & 0x00000040) && tk_identifier()) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
+if((iPredicted_28 & 0x00000080) && GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
 
 																sOperand = PREV_TOKEN_TEXT;
 																m_vPostFix.push_back(sOperand);
@@ -3775,7 +4176,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_FLOAT, OPTIONAL_)) {
+if((iPredicted_28 & 0x00000100) && GrammerUtils::match(TokenType_::Type::TK_FLOAT, OPTIONAL_)) {
 
 																sOperand = PREV_TOKEN_TEXT;
 																m_vPostFix.push_back(sOperand);
@@ -3783,7 +4184,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_FLOAT, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_CHARACTER, OPTIONAL_)) {
+if((iPredicted_28 & 0x00000200) && GrammerUtils::match(TokenType_::Type::TK_CHARACTER, OPTIONAL_)) {
 
 																sOperand = PREV_TOKEN_TEXT;
 																char pStr[255] = {0};
@@ -3801,15 +4202,27 @@ return true;
 }
 
 bool TinyCReader::tk_identifier() {
-if(preFixInExpr()) {
+uint32_t iPredicted_29 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_PREFIXDECR:
+case TokenType_::Type::TK_PREFIXINCR:
+case TokenType_::Type::TK_DEREFARRAY:
+iPredicted_29 = 0x00000001; break;
+case TokenType_::Type::TK_POSTFIXDECR:
+case TokenType_::Type::TK_POSTFIXINCR:
+iPredicted_29 = 0x00000002; break;
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_29 = 0x00000004; break;
+}
+if((iPredicted_29 & 0x00000001) && preFixInExpr()) {
 return true;
 }
 else
-if(postFixIncrDecrInExpr()) {
+if((iPredicted_29 & 0x00000002) && postFixIncrDecrInExpr()) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
+if((iPredicted_29 & 0x00000004) && GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 
 																std::string sOperand = PREV_TOKEN_TEXT;
 																std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sOperand);
@@ -3831,11 +4244,18 @@ return true;
 }
 
 bool TinyCReader::structStaticOrObjectAccess() {
-if(structStaticAccess()) {
+uint32_t iPredicted_30 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_STATICMEMBERACCESS:
+iPredicted_30 = 0x00000001; break;
+case TokenType_::Type::TK_MEMBERACCESS:
+iPredicted_30 = 0x00000002; break;
+}
+if((iPredicted_30 & 0x00000001) && structStaticAccess()) {
 return true;
 }
 else
-if(structObjectAccess()) {
+if((iPredicted_30 & 0x00000002) && structObjectAccess()) {
 return true;
 }
 else
@@ -3927,11 +4347,20 @@ return true;
 }
 
 bool TinyCReader::structMemberVariableOrFunctionCall_RValue_1() {
-if(structMemberFunctionCallInAnExpr()) {
+uint32_t iPredicted_31 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_FUNCTIONCALL:
+iPredicted_31 = 0x00000001; break;
+case TokenType_::Type::TK_IDENTIFIER:
+iPredicted_31 = 0x00000002; break;
+case TokenType_::Type::TK_DEREFARRAY:
+iPredicted_31 = 0x00000004; break;
+}
+if((iPredicted_31 & 0x00000001) && structMemberFunctionCallInAnExpr()) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
+if((iPredicted_31 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 
 																{
 																	std::string sOperand = GET_INFO_FOR_KEY(m_pASTCurrentNode, "text");
@@ -3946,7 +4375,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 return true;
 }
 else
-if(structMemberVariableArrayInAnExpr()) {
+if((iPredicted_31 & 0x00000004) && structMemberVariableArrayInAnExpr()) {
 return true;
 }
 else
@@ -4050,21 +4479,30 @@ return true;
 }
 
 bool TinyCReader::unary_oper() {
-if(GrammerUtils::match('-', OPTIONAL_)) {
+uint32_t iPredicted_32 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_SUB:
+iPredicted_32 = 0x00000001; break;
+case TokenType_::Type::TK_NOT:
+iPredicted_32 = 0x00000002; break;
+case TokenType_::Type::TK_BITWISENOT:
+iPredicted_32 = 0x00000004; break;
+}
+if((iPredicted_32 & 0x00000001) && GrammerUtils::match('-', OPTIONAL_)) {
  
 																checkOpPrecedenceAndPush("NEGATE");
 															
 return true;
 }
 else
-if(GrammerUtils::match('!', OPTIONAL_)) {
+if((iPredicted_32 & 0x00000002) && GrammerUtils::match('!', OPTIONAL_)) {
  
 																checkOpPrecedenceAndPush("!");
 															
 return true;
 }
 else
-if(GrammerUtils::match('~', OPTIONAL_)) {
+if((iPredicted_32 & 0x00000004) && GrammerUtils::match('~', OPTIONAL_)) {
  
 																checkOpPrecedenceAndPush("~");
 															
@@ -4078,7 +4516,16 @@ return true;
 }
 
 bool TinyCReader::preFixInExpr() {
-if(GrammerUtils::match(TokenType_::Type::TK_PREFIXDECR, OPTIONAL_)) {
+uint32_t iPredicted_33 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_PREFIXDECR:
+iPredicted_33 = 0x00000001; break;
+case TokenType_::Type::TK_PREFIXINCR:
+iPredicted_33 = 0x00000002; break;
+case TokenType_::Type::TK_DEREFARRAY:
+iPredicted_33 = 0x00000004; break;
+}
+if((iPredicted_33 & 0x00000001) && GrammerUtils::match(TokenType_::Type::TK_PREFIXDECR, OPTIONAL_)) {
 
 																if(m_pASTCurrentNode->m_pLeftNode == nullptr)
 																{
@@ -4099,7 +4546,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_PREFIXDECR, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_PREFIXINCR, OPTIONAL_)) {
+if((iPredicted_33 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_PREFIXINCR, OPTIONAL_)) {
 
 																if(m_pASTCurrentNode->m_pLeftNode == nullptr)
 																{
@@ -4120,7 +4567,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_PREFIXINCR, OPTIONAL_)) {
 return true;
 }
 else
-if(rValueDeref()) {
+if((iPredicted_33 & 0x00000004) && rValueDeref()) {
 return true;
 }
 else
@@ -4158,7 +4605,14 @@ return true;
 }
 
 bool TinyCReader::postFixIncrDecrInExpr() {
-if(GrammerUtils::match(TokenType_::Type::TK_POSTFIXDECR, OPTIONAL_)) {
+uint32_t iPredicted_34 = 0x00000000;
+switch(GrammerUtils::m_pToken.getType()) {
+case TokenType_::Type::TK_POSTFIXDECR:
+iPredicted_34 = 0x00000001; break;
+case TokenType_::Type::TK_POSTFIXINCR:
+iPredicted_34 = 0x00000002; break;
+}
+if((iPredicted_34 & 0x00000001) && GrammerUtils::match(TokenType_::Type::TK_POSTFIXDECR, OPTIONAL_)) {
 
 																	if(m_pASTCurrentNode->m_pRightNode == nullptr)
 																	{
@@ -4179,7 +4633,7 @@ if(GrammerUtils::match(TokenType_::Type::TK_POSTFIXDECR, OPTIONAL_)) {
 return true;
 }
 else
-if(GrammerUtils::match(TokenType_::Type::TK_POSTFIXINCR, OPTIONAL_)) {
+if((iPredicted_34 & 0x00000002) && GrammerUtils::match(TokenType_::Type::TK_POSTFIXINCR, OPTIONAL_)) {
 
 																	if(m_pASTCurrentNode->m_pRightNode == nullptr)
 																	{
@@ -19,6 +19,7 @@ class TinyCReader {
 			GrammerUtils::m_vKeywords.push_back("static");
 			GrammerUtils::m_vKeywords.push_back("static");
 			GrammerUtils::m_vKeywords.push_back("SYSFUNC");
+			GrammerUtils::m_vKeywords.push_back("HOSTDATA");
 			GrammerUtils::m_vKeywords.push_back("return");
 			GrammerUtils::m_vKeywords.push_back("if");
 			GrammerUtils::m_vKeywords.push_back("else");
@@ -63,6 +64,7 @@ class TinyCReader {
 		bool structType();
 		bool staticPtr();
 		bool systemFunctionDef();
+		bool hostDataDeclaration();
 		bool functionDef();
 		bool functionArgumentDefList();
 		bool functionArgumentDefListMore();
@@ -75,6 +77,8 @@ class TinyCReader {
 		bool postFixIncrDecr();
 		bool returnStatement();
 		bool systemFunctionCall();
+		bool intrinsicCall();
+		bool intrinsicName();
 		bool functionCall();
 		bool functionArgumentList();
 		bool functionArgumentItem();
@@ -164,6 +168,7 @@ class TinyCReader {
 
 		
 		void 						read(const char* sFile);
+		bool						parse();
 		std::string					popOperator();
 		ENUM_OP_PRECEDENCE 			opFromString(std::string sOperator);
 		void						checkOpPrecedenceAndPush(std::string sCurrentOperator);
@@ -179,6 +184,8 @@ class TinyCReader {
 
 		void 						addType(std::string sType);
 		bool						isValidType(std::string sType);
+		void 						addIntrinsic(std::string sIntrinsic);
+		bool						isValidIntrinsic(std::string sIntrinsic);
 		void 						addStructType(std::string sType);
 		bool 						isValidStructType(std::string sType);
 		Tree* 						hasNodeOfType(Tree* pNode, ASTNodeType eASTNodeType);
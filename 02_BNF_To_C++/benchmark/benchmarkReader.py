@@ -0,0 +1,67 @@
+# Compares the parse time of CodeGenerators built with different generated TinyCReaders.
+#		- usage: python benchmarkReader.py <source.c> <ParseBenchmark.exe> [<ParseBenchmark.exe> ...] [-rounds=N]
+#		- Each build is run interleaved with the others, N times(default 15), in a scratch
+#		  directory. Reports the median & the min parse time per build.
+#
+# Setting up the builds:
+#		1. The rules in 04. CodeGenerator's TinyCReader.cpp have been changed by hand since
+#		   a4395d9(precedence climbing, keyword ids, ...), a reader generated from
+#		   myToyGrammer_7_TinyC.gr only builds against 04 as of that commit:
+#				git worktree add ../tinyc-a4395d9 a4395d9
+#		2. Generate both readers from the same grammar & helpers:
+#				BNFToCpp.exe TestCases/myToyGrammer_7_TinyC.gr TinyCReader -nodispatch		(trial matching)
+#				BNFToCpp.exe TestCases/myToyGrammer_7_TinyC.gr TinyCReader					(FIRST-set dispatch)
+#		   The trial matching reader is 04's own TinyCReader at a4395d9 apart from whitespace
+#		   & TinyCReader::parse().
+#		3. For each reader, copy TinyCReader.cpp/.h into the worktree's 04. CodeGenerator like
+#		   copyTinyCReader.bat does, replace its main.cpp with parseBenchmark.cpp & build it
+#		   in Release.
+#		4. Built with its own main.cpp instead, both readers must write the same main.o.
+
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+def runOnce(sParser, sSource, sWorkDir):
+	result = subprocess.run([sParser, sSource], cwd=sWorkDir, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+	sOutput = result.stdout.decode("latin-1")
+
+	matchTime = re.search(r"parse time   : ([0-9.e+-]+) ms", sOutput)
+	if result.returncode != 0 or matchTime is None:
+		print("%s failed on %s:" % (sParser, sSource))
+		print("\n".join(sOutput.splitlines()[-10:]))
+		sys.exit(1)
+
+	return float(matchTime.group(1))
+
+def median(vValues):
+	vSorted = sorted(vValues)
+	return vSorted[len(vSorted) // 2]
+
+def main():
+	vArgs = [sArg for sArg in sys.argv[1:] if not sArg.startswith("-rounds=")]
+	vRounds = [int(sArg[len("-rounds="):]) for sArg in sys.argv[1:] if sArg.startswith("-rounds=")]
+	iRounds = vRounds[-1] if len(vRounds) > 0 else 15
+	if len(vArgs) < 2 or iRounds < 1:
+		print("usage: python benchmarkReader.py <source.c> <ParseBenchmark.exe> [<ParseBenchmark.exe> ...] [-rounds=N]")
+		return 1
+
+	sSource = os.path.abspath(vArgs[0])
+	vParsers = [os.path.abspath(sParser) for sParser in vArgs[1:]]
+
+	mapTimes = { sParser: [] for sParser in vParsers }
+	sWorkDir = tempfile.mkdtemp()
+	for iRound in range(iRounds):
+		for sParser in vParsers:
+			mapTimes[sParser].append(runOnce(sParser, sSource, sWorkDir))
+
+	print("%s, %d rounds" % (vArgs[0], iRounds))
+	for sParser in vParsers:
+		print("%-40s parse time %9.1f ms (min %9.1f ms)" % (sParser, median(mapTimes[sParser]), min(mapTimes[sParser])))
+
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -0,0 +1,33 @@
+#include <iostream>
+#include <chrono>
+#include "TinyCReader.h"
+#include "GrammerUtils.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Times the parser generated into TinyCReader.cpp, see benchmarkReader.py.
+//
+// Built into the CodeGenerator in place of its main.cpp. The file is tokenized first, then
+// only TinyCReader::parse() is timed, code generation is skipped.
+//////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: ParseBenchmark.exe filename.c" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	TinyCReader* pTinyCReader = new TinyCReader();
+	if (NOT GrammerUtils::read(argv[1]))
+		exit(EXIT_FAILURE);
+
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+	bool bParsed = pTinyCReader->parse();
+
+	std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+	std::cout << std::endl;
+	std::cout << "parse time   : " << elapsed.count() * 1000.0 << " ms" << std::endl;
+
+	exit(bParsed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -3,6 +3,7 @@
 #include "StringTokenizer.h"
 #include "RandomAccessFile.h"
 #include "NonTerminal.h"
+#include "GrammerAnalyzer.h"
 
 enum class EGrammerState
 {
@@ -17,7 +18,7 @@ class BNFToCpp
 									BNFToCpp();
 		virtual						~BNFToCpp();
 		
-		void						process(const char* sGrammerFile, const char* sClassName);
+		void						process(const char* sGrammerFile, const char* sClassName, bool bDispatch = true);
 		void						nonTerminalize();
 	protected:
 		bool						tokenize(const char* sGrammerFile);
@@ -26,6 +27,8 @@ class BNFToCpp
 		void						onTokenCallback(RandomAccessFile* rafOut, const char* sClassName, Token tok);
 	private:
 		void						writeFromFile(RandomAccessFile* rafOutDest, const char* sSrcFileName);
+		void						writeDispatch(RandomAccessFile* rafOut);
+		std::string					getAlternativeGuard();
 
 		std::vector<Token>			m_vTokens;
 		std::vector<NonTerminal*>	m_vNonterminals;
@@ -36,4 +39,11 @@ class BNFToCpp
 		// BNF variables
 		bool						m_bWhile, m_bORed, m_bORedFirst, m_bOptional;
 		EGrammerState				m_eGrammerState;
+
+		// LL(1) dispatch of the current '(' ... ')'
+		GrammerAnalyzer				m_GrammerAnalyzer;
+		bool						m_bDispatch;			// false ==> every alternative is tried in turn, as before the analysis.
+		int32_t						m_iAlternationId;		// -1 outside an alternation.
+		int32_t						m_iAlternationCount;
+		int32_t						m_iAlternative;
 };
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "NonTerminal.h"
+
+#define MAX_DISPATCH_ALTERNATIVES	32		// One bit per alternative in the generated prediction mask.
+
+enum class EGrammerNodeType
+{
+	SEQUENCE,
+	ALTERNATION,		// ( a | b )
+	REPETITION,			// { a }
+	OPTIONAL,			// [ a ]
+	TERMINAL,			// TK_xxx, "keyword" or 'c'
+	NONTERMINAL,		// <rule>
+	CODE				// "<code>" ... "</code>", consumes nothing.
+};
+
+// A terminal as seen by GrammerUtils::match(), a token type & optionally the exact text.
+struct GrammerTerminal
+{
+	TokenType_::Type			m_eTokenType;
+	std::string					m_sText;		// Empty if any text of m_eTokenType matches.
+
+	bool operator<(const GrammerTerminal& other) const
+	{
+		if (m_eTokenType != other.m_eTokenType)
+			return m_eTokenType < other.m_eTokenType;
+		return m_sText < other.m_sText;
+	}
+};
+
+struct GrammerSet
+{
+	GrammerSet() : m_bAny(false), m_bNullable(false) {}
+
+	std::set<GrammerTerminal>	m_Terminals;
+	bool						m_bAny;			// Starts with a semantic predicate, i.e any token may be accepted.
+	bool						m_bNullable;
+};
+
+struct GrammerNode
+{
+	GrammerNode(EGrammerNodeType eType) : m_eType(eType), m_iAlternationId(-1) {}
+
+	EGrammerNodeType			m_eType;
+	std::string					m_sText;		// Terminal text, rule name or code.
+	std::vector<GrammerNode*>	m_vChildren;
+	std::vector<GrammerTerminal> m_vTerminals;	// TERMINAL only, the tokens this terminal matches.
+	int32_t						m_iAlternationId;	// ALTERNATION only, in the order BNFToCpp meets the '('.
+	GrammerSet					m_Follow;		// Tokens that may follow this node, set by computeFollowSets().
+};
+
+// How the generated parser picks the alternatives of one '(' ... ')', see BNFToCpp::onTokenCallback().
+struct GrammerDispatch
+{
+	GrammerDispatch() : m_bEnabled(false), m_iDefaultMask(0) {}
+
+	bool											m_bEnabled;
+	std::vector<std::pair<uint32_t, std::vector<TokenType_::Type>>>	m_vCases;	// Mask of alternatives worth trying per token type.
+	uint32_t										m_iDefaultMask;				// Alternatives starting with a predicate or deriving empty.
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// LL(1) analysis of the BNF grammar.
+//
+// 1. build() turns the token list of every NonTerminal into a tree of GrammerNodes.
+// 2. computeFirstSets() & computeFollowSets() iterate until nothing changes.
+// 3. reportConflicts() lists every FIRST/FIRST & FIRST/FOLLOW conflict.
+// 4. getDispatch() tells BNFToCpp which alternatives of an alternation may start with a
+//    given token type, so the generated code switches on the token type instead of
+//    calling every alternative in turn.
+//
+// Rules made only of code, like <primitiveType>, are semantic predicates. They look at the
+// current token themselves, so their FIRST set is "any".
+//
+// Keywords are TK_IDENTIFIERs to the tokenizer, so alternatives that start with different
+// keywords, e.g <objectList>'s "interface", "struct", "static", "SYSFUNC" & "HOSTDATA",
+// share a token type. reportConflicts() lists them as FIRST/FIRST conflicts & all of them
+// stay in the mask, where they are still tried in turn through GrammerUtils::match()'s
+// text compare. Only alternations told apart by the token type alone are picked in O(1).
+//////////////////////////////////////////////////////////////////////////////////////////
+class GrammerAnalyzer
+{
+	public:
+									GrammerAnalyzer();
+		virtual						~GrammerAnalyzer();
+
+		void						build(const std::vector<NonTerminal*>& vNonTerminals);
+		void						computeFirstSets();
+		void						computeFollowSets();
+		int32_t						reportConflicts();
+
+		const GrammerDispatch&		getDispatch(int32_t iAlternationId);
+	protected:
+	private:
+		GrammerNode*				parseSequence(const std::vector<Token>& vTokens, size_t& iPos);
+		GrammerNode*				parseTerminal(Token tok);
+		void						classifyLiteral(const std::string& sText, std::vector<GrammerTerminal>& vTerminals);
+
+		GrammerSet					first(GrammerNode* pNode);
+		bool						isPredicate(GrammerNode* pBody);
+		bool						follow(GrammerNode* pNode, const GrammerSet& followSet);
+		void						buildDispatch(GrammerNode* pAlternation);
+
+		bool						merge(GrammerSet& dest, const GrammerSet& src);
+		bool						intersects(const GrammerSet& a, const GrammerSet& b, std::string& sTerminal);
+		int32_t						checkConflicts(const std::string& sRule, GrammerNode* pNode);
+
+		void						deleteNode(GrammerNode* pNode);
+
+		std::vector<std::string>					m_vRuleNames;		// In grammar order, the first one is the start rule.
+		std::map<std::string, GrammerNode*>			m_mapRules;
+		std::map<std::string, GrammerSet>			m_mapFirst;
+		std::map<std::string, GrammerSet>			m_mapFollow;
+		std::map<std::string, std::vector<GrammerTerminal>>	m_mapLiterals;	// Cache of classifyLiteral().
+
+		std::vector<GrammerNode*>					m_vAlternations;
+		std::vector<GrammerDispatch>				m_vDispatch;
+		int32_t										m_iAlternationCount;
+};
@@ -5,16 +5,32 @@
 #define WRITE_BUF(__rafOut__, __line__) __rafOut__->write(__line__);
 
 BNFToCpp::BNFToCpp()
+: m_bWhile(false)
+, m_bORed(false)
+, m_bORedFirst(false)
+, m_bOptional(false)
+, m_eGrammerState(EGrammerState::WRITING_FUNCTION_START)
+, m_bDispatch(true)
+, m_iAlternationId(-1)
+, m_iAlternationCount(0)
+, m_iAlternative(0)
 {
 }
 
-void BNFToCpp::process(const char* sGrammerFile, const char* sClassName)
+void BNFToCpp::process(const char* sGrammerFile, const char* sClassName, bool bDispatch /* = true*/)
 {
 	m_sClassName = sClassName;
+	m_bDispatch = bDispatch;
 
 	if (tokenize(sGrammerFile))
 	{
 		nonTerminalize();
+
+		m_GrammerAnalyzer.build(m_vNonterminals);
+		m_GrammerAnalyzer.computeFirstSets();
+		m_GrammerAnalyzer.computeFollowSets();
+		m_GrammerAnalyzer.reportConflicts();
+
 		generateDotH();
 		generateDotCPP();
 	}
@@ -265,7 +281,7 @@ void BNFToCpp::onTokenCallback(RandomAccessFile* rafOut, const char* sClassName,
 						sprintf(sLine, "}\r\nelse");					WRITE_LINE(rafOut, sLine);
 					}
 
-					sprintf(sLine, "if(%s()) {", sValue.c_str());		WRITE_LINE(rafOut, sLine);
+					sprintf(sLine, "if(%s%s()) {", getAlternativeGuard().c_str(), sValue.c_str());		WRITE_LINE(rafOut, sLine);
 				}
 				else 
 				{
@@ -317,9 +333,9 @@ void BNFToCpp::onTokenCallback(RandomAccessFile* rafOut, const char* sClassName,
 				}
 
 				if (TokenType_::Type::TK_INVALID == TokenType_::fromString(sValue))
-					sprintf(sLine, "if(GrammerUtils::match(\"%s\", OPTIONAL_)) {", sValue.c_str());
+					sprintf(sLine, "if(%sGrammerUtils::match(\"%s\", OPTIONAL_)) {", getAlternativeGuard().c_str(), sValue.c_str());
 				else
-					sprintf(sLine, "if(GrammerUtils::match(TokenType_::Type::%s, OPTIONAL_)) {", sValue.c_str());
+					sprintf(sLine, "if(%sGrammerUtils::match(TokenType_::Type::%s, OPTIONAL_)) {", getAlternativeGuard().c_str(), sValue.c_str());
 				WRITE_LINE(rafOut, sLine);
 			}
 			else 
@@ -360,7 +376,7 @@ void BNFToCpp::onTokenCallback(RandomAccessFile* rafOut, const char* sClassName,
 					sprintf(sLine, "}\r\nelse");		WRITE_LINE(rafOut, sLine);
 				}
 
-				sprintf(sLine, "if(GrammerUtils::match(\'%c\', OPTIONAL_)) {", sValue[0]);	WRITE_LINE(rafOut, sLine);
+				sprintf(sLine, "if(%sGrammerUtils::match(\'%c\', OPTIONAL_)) {", getAlternativeGuard().c_str(), sValue[0]);	WRITE_LINE(rafOut, sLine);
 			}
 			else 
 			{
@@ -380,6 +396,10 @@ void BNFToCpp::onTokenCallback(RandomAccessFile* rafOut, const char* sClassName,
 		break;
 		case TokenType_::Type::TK_LPAREN:
 			m_bORedFirst = true;
+
+			m_iAlternationId = m_iAlternationCount++;
+			m_iAlternative = 0;
+			writeDispatch(rafOut);
 		break;
 		case TokenType_::Type::TK_RBRACE:
 			WRITE_LINE(rafOut, "}");
@@ -391,9 +411,11 @@ void BNFToCpp::onTokenCallback(RandomAccessFile* rafOut, const char* sClassName,
 			WRITE_LINE(rafOut, "return true;\r\n}");
 			WRITE_LINE(rafOut, "else\r\nreturn false;\r\n");
 			m_bORed = false;
+			m_iAlternationId = -1;
 		break;
 		case TokenType_::Type::TK_BITWISEOR:
 			m_bORed = true;
+			m_iAlternative++;
 		break;
 		case TokenType_::Type::TK_LSQBRACKET:
 			m_bOptional = true;
@@ -405,6 +427,49 @@ void BNFToCpp::onTokenCallback(RandomAccessFile* rafOut, const char* sClassName,
 	}
 }
 
+void BNFToCpp::writeDispatch(RandomAccessFile* rafOut)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Predict the viable alternatives from the current token once, e.g.
+	//		uint32_t iPredicted_3 = 0x00000004;
+	//		switch(GrammerUtils::m_pToken.getType()) {
+	//			case TokenType_::Type::TK_IDENTIFIER:
+	//			case TokenType_::Type::TK_FUNCTIONCALL:
+	//				iPredicted_3 = 0x00000005; break;
+	//		}
+	// Every alternative is then guarded by its bit, see getAlternativeGuard().
+	const GrammerDispatch& dispatch = m_GrammerAnalyzer.getDispatch(m_iAlternationId);
+	if (NOT m_bDispatch || NOT dispatch.m_bEnabled)
+		return;
+
+	char sLine[255] = { 0 };
+	sprintf(sLine, "uint32_t iPredicted_%d = 0x%08X;", m_iAlternationId, dispatch.m_iDefaultMask);	WRITE_LINE(rafOut, sLine);
+	WRITE_LINE(rafOut, "switch(GrammerUtils::m_pToken.getType()) {");
+	for (const auto& itr : dispatch.m_vCases)
+	{
+		for (TokenType_::Type eTokenType : itr.second)
+		{
+			sprintf(sLine, "case TokenType_::Type::%s:", TokenType_::toString(eTokenType).c_str());
+			WRITE_LINE(rafOut, sLine);
+		}
+
+		sprintf(sLine, "iPredicted_%d = 0x%08X; break;", m_iAlternationId, itr.first);	WRITE_LINE(rafOut, sLine);
+	}
+	WRITE_LINE(rafOut, "}");
+}
+
+std::string BNFToCpp::getAlternativeGuard()
+{
+	const GrammerDispatch& dispatch = m_GrammerAnalyzer.getDispatch(m_iAlternationId);
+	if (NOT m_bDispatch || NOT dispatch.m_bEnabled || m_iAlternative >= MAX_DISPATCH_ALTERNATIVES)
+		return "";
+
+	char sGuard[64] = { 0 };
+	sprintf(sGuard, "(iPredicted_%d & 0x%08X) && ", m_iAlternationId, (1u << m_iAlternative));
+
+	return sGuard;
+}
+
 BNFToCpp::~BNFToCpp()
 {
 }
\ No newline at end of file
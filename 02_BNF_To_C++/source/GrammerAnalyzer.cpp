@@ -0,0 +1,572 @@
+#include "GrammerAnalyzer.h"
+#include "StringTokenizer.h"
+#include <iostream>
+#include <assert.h>
+
+GrammerAnalyzer::GrammerAnalyzer()
+: m_iAlternationCount(0)
+{
+}
+
+void GrammerAnalyzer::build(const std::vector<NonTerminal*>& vNonTerminals)
+{
+	for (NonTerminal* pNonTerminal : vNonTerminals)
+	{
+		std::string sRuleName = pNonTerminal->get().getText();
+		const std::vector<Token>& vTokens = pNonTerminal->getTokenList();
+
+		size_t iPos = 0;
+		GrammerNode* pBody = parseSequence(vTokens, iPos);
+		if (iPos < vTokens.size() && vTokens[iPos].m_eTokenType != TokenType_::Type::TK_SEMICOL)
+			std::cout << "GrammerAnalyzer::build() << <" << sRuleName << "> Unexpected " << vTokens[iPos].m_sText << std::endl;
+
+		assert(m_mapRules.find(sRuleName) == m_mapRules.end());
+		if (m_mapRules.find(sRuleName) != m_mapRules.end())
+		{
+			deleteNode(pBody);
+			continue;
+		}
+
+		m_vRuleNames.push_back(sRuleName);
+		m_mapRules[sRuleName] = pBody;
+	}
+}
+
+GrammerNode* GrammerAnalyzer::parseSequence(const std::vector<Token>& vTokens, size_t& iPos)
+{
+	GrammerNode* pSequence = new GrammerNode(EGrammerNodeType::SEQUENCE);
+	while (iPos < vTokens.size())
+	{
+		Token tok = vTokens[iPos];
+		switch (tok.getType())
+		{
+			case TokenType_::Type::TK_RPAREN:
+			case TokenType_::Type::TK_RBRACE:
+			case TokenType_::Type::TK_RSQBRACKET:
+			case TokenType_::Type::TK_BITWISEOR:
+			case TokenType_::Type::TK_SEMICOL:
+				return pSequence;
+			case TokenType_::Type::TK_LPAREN:
+			{
+				// The alternation id is assigned in token order, which is also the order in which
+				// BNFToCpp::onTokenCallback() meets the '('.
+				GrammerNode* pAlternation = new GrammerNode(EGrammerNodeType::ALTERNATION);
+				pAlternation->m_iAlternationId = m_iAlternationCount++;
+				m_vAlternations.push_back(pAlternation);
+
+				iPos++;
+				while (true)
+				{
+					pAlternation->m_vChildren.push_back(parseSequence(vTokens, iPos));
+					if (iPos < vTokens.size() && vTokens[iPos].m_eTokenType == TokenType_::Type::TK_BITWISEOR)
+					{
+						iPos++;
+						continue;
+					}
+
+					if (iPos < vTokens.size() && vTokens[iPos].m_eTokenType == TokenType_::Type::TK_RPAREN)
+						iPos++;
+					break;
+				}
+
+				pSequence->m_vChildren.push_back(pAlternation);
+			}
+			break;
+			case TokenType_::Type::TK_LBRACE:
+			case TokenType_::Type::TK_LSQBRACKET:
+			{
+				bool bIsRepetition = (tok.getType() == TokenType_::Type::TK_LBRACE);
+				TokenType_::Type eClosing = bIsRepetition ? TokenType_::Type::TK_RBRACE : TokenType_::Type::TK_RSQBRACKET;
+
+				GrammerNode* pNode = new GrammerNode(bIsRepetition ? EGrammerNodeType::REPETITION : EGrammerNodeType::OPTIONAL);
+				iPos++;
+				pNode->m_vChildren.push_back(parseSequence(vTokens, iPos));
+				if (iPos < vTokens.size() && vTokens[iPos].m_eTokenType == eClosing)
+					iPos++;
+
+				pSequence->m_vChildren.push_back(pNode);
+			}
+			break;
+			case TokenType_::Type::TK_BNFNONTERMINAL:
+			{
+				GrammerNode* pNode = new GrammerNode(EGrammerNodeType::NONTERMINAL);
+				pNode->m_sText = tok.getText();
+				pSequence->m_vChildren.push_back(pNode);
+				iPos++;
+			}
+			break;
+			case TokenType_::Type::TK_BNFCODE:
+			{
+				GrammerNode* pNode = new GrammerNode(EGrammerNodeType::CODE);
+				pNode->m_sText = tok.getText();
+				pSequence->m_vChildren.push_back(pNode);
+				iPos++;
+			}
+			break;
+			case TokenType_::Type::TK_STRING:
+			case TokenType_::Type::TK_IDENTIFIER:
+			case TokenType_::Type::TK_CHARACTER:
+			{
+				pSequence->m_vChildren.push_back(parseTerminal(tok));
+				iPos++;
+			}
+			break;
+			default:
+				iPos++;		// Ignored by BNFToCpp::onTokenCallback() as well.
+			break;
+		}
+	}
+
+	return pSequence;
+}
+
+GrammerNode* GrammerAnalyzer::parseTerminal(Token tok)
+{
+	GrammerNode* pNode = new GrammerNode(EGrammerNodeType::TERMINAL);
+	pNode->m_sText = tok.getText();
+
+	TokenType_::Type eTokenType = TokenType_::fromString(pNode->m_sText);
+	if (tok.getType() != TokenType_::Type::TK_CHARACTER && eTokenType != TokenType_::Type::TK_INVALID)
+	{
+		GrammerTerminal terminal = { eTokenType, "" };		// GrammerUtils::match(TokenType_::Type::TK_xxx, ...)
+		pNode->m_vTerminals.push_back(terminal);
+	}
+	else
+		classifyLiteral(pNode->m_sText, pNode->m_vTerminals);	// GrammerUtils::match("text", ...)
+
+	return pNode;
+}
+
+void GrammerAnalyzer::classifyLiteral(const std::string& sText, std::vector<GrammerTerminal>& vTerminals)
+{
+	auto itr = m_mapLiterals.find(sText);
+	if (itr != m_mapLiterals.end())
+	{
+		vTerminals = itr->second;
+		return;
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	// A literal is matched by text, so find the token types that can carry that text:
+	// 1. Words come as TK_IDENTIFIER, or as TK_FUNCTIONCALL, TK_MEMBERACCESS ... depending
+	//    on the character following them, so every identifier type is possible.
+	// 2. Anything else is a single operator or punctuation token, tokenize it to find out.
+	// 3. If neither works the literal is treated like a predicate (empty list).
+	if (isalpha(sText[0]) || sText[0] == '_')
+	{
+		static const TokenType_::Type eIdentifierTypes[] = {
+			TokenType_::Type::TK_IDENTIFIER,
+			TokenType_::Type::TK_FUNCTIONCALL,
+			TokenType_::Type::TK_MEMBERACCESS,
+			TokenType_::Type::TK_STATICMEMBERACCESS,
+			TokenType_::Type::TK_DEREFARRAY,
+			TokenType_::Type::TK_DEREF,
+			TokenType_::Type::TK_PREFIXDECR,
+			TokenType_::Type::TK_PREFIXINCR,
+			TokenType_::Type::TK_POSTFIXDECR,
+			TokenType_::Type::TK_POSTFIXINCR,
+		};
+
+		for (TokenType_::Type eTokenType : eIdentifierTypes)
+		{
+			GrammerTerminal terminal = { eTokenType, sText };
+			vTerminals.push_back(terminal);
+		}
+	}
+	else
+	{
+		StringTokenizer* st = StringTokenizer::create(sText.c_str(), true);
+		st->tokenize();
+
+		int32_t iCount = 0;
+		Token literalToken(TokenType_::Type::TK_INVALID, "", -1, -1);
+		while (st->hasMoreTokens())
+		{
+			Token tok = st->nextToken();
+			TokenType_::Type eTokenType = tok.getType();
+			if (	eTokenType == TokenType_::Type::TK_EOL
+					||
+					eTokenType == TokenType_::Type::TK_EOI
+					||
+					eTokenType == TokenType_::Type::TK_WHITESPACE
+			) {
+				continue;
+			}
+
+			literalToken = tok;
+			iCount++;
+		}
+
+		if (iCount == 1 && literalToken.m_sText == sText)
+		{
+			GrammerTerminal terminal = { literalToken.getType(), sText };
+			vTerminals.push_back(terminal);
+		}
+	}
+
+	m_mapLiterals[sText] = vTerminals;
+}
+
+bool GrammerAnalyzer::isPredicate(GrammerNode* pBody)
+{
+	// <primitiveType> ::= "<code>" return isValidType(...); "</code>" ;
+	bool bHasReturn = false;
+	for (GrammerNode* pChild : pBody->m_vChildren)
+	{
+		if (pChild->m_eType != EGrammerNodeType::CODE)
+			return false;
+
+		if (pChild->m_sText.find("return ") != std::string::npos)
+			bHasReturn = true;
+	}
+
+	return bHasReturn;
+}
+
+GrammerSet GrammerAnalyzer::first(GrammerNode* pNode)
+{
+	GrammerSet firstSet;
+	switch (pNode->m_eType)
+	{
+		case EGrammerNodeType::TERMINAL:
+		{
+			firstSet.m_Terminals.insert(pNode->m_vTerminals.begin(), pNode->m_vTerminals.end());
+			firstSet.m_bAny = pNode->m_vTerminals.empty();
+		}
+		break;
+		case EGrammerNodeType::NONTERMINAL:
+		{
+			auto itr = m_mapFirst.find(pNode->m_sText);
+			if (itr != m_mapFirst.end())
+				firstSet = itr->second;
+			else
+			if (m_mapRules.find(pNode->m_sText) == m_mapRules.end())
+				firstSet.m_bAny = true;		// Undefined rule, reported by reportConflicts().
+		}
+		break;
+		case EGrammerNodeType::CODE:
+		{
+			firstSet.m_bNullable = true;
+		}
+		break;
+		case EGrammerNodeType::SEQUENCE:
+		{
+			firstSet.m_bNullable = true;
+			for (GrammerNode* pChild : pNode->m_vChildren)
+			{
+				GrammerSet childSet = first(pChild);
+				firstSet.m_Terminals.insert(childSet.m_Terminals.begin(), childSet.m_Terminals.end());
+				firstSet.m_bAny |= childSet.m_bAny;
+
+				if (NOT childSet.m_bNullable)
+				{
+					firstSet.m_bNullable = false;
+					break;
+				}
+			}
+		}
+		break;
+		case EGrammerNodeType::ALTERNATION:
+		{
+			for (GrammerNode* pChild : pNode->m_vChildren)
+				merge(firstSet, first(pChild));
+		}
+		break;
+		case EGrammerNodeType::REPETITION:
+		case EGrammerNodeType::OPTIONAL:
+		{
+			firstSet = first(pNode->m_vChildren[0]);
+			firstSet.m_bNullable = true;
+		}
+		break;
+	}
+
+	return firstSet;
+}
+
+void GrammerAnalyzer::computeFirstSets()
+{
+	bool bChanged = true;
+	while (bChanged)
+	{
+		bChanged = false;
+		for (const std::string& sRuleName : m_vRuleNames)
+		{
+			GrammerNode* pBody = m_mapRules[sRuleName];
+
+			GrammerSet firstSet;
+			if (isPredicate(pBody))
+				firstSet.m_bAny = true;
+			else
+				firstSet = first(pBody);
+
+			bChanged |= merge(m_mapFirst[sRuleName], firstSet);
+		}
+	}
+
+	m_vDispatch.resize(m_vAlternations.size());
+	for (GrammerNode* pAlternation : m_vAlternations)
+		buildDispatch(pAlternation);
+}
+
+bool GrammerAnalyzer::follow(GrammerNode* pNode, const GrammerSet& followSet)
+{
+	bool bChanged = merge(pNode->m_Follow, followSet);
+	switch (pNode->m_eType)
+	{
+		case EGrammerNodeType::NONTERMINAL:
+		{
+			if (m_mapRules.find(pNode->m_sText) != m_mapRules.end())
+				bChanged |= merge(m_mapFollow[pNode->m_sText], followSet);
+		}
+		break;
+		case EGrammerNodeType::SEQUENCE:
+		{
+			// Walk backwards, what follows a child is the FIRST of the rest of the sequence.
+			GrammerSet trailingSet = followSet;
+			for (int32_t i = pNode->m_vChildren.size() - 1; i >= 0; i--)
+			{
+				GrammerNode* pChild = pNode->m_vChildren[i];
+				bChanged |= follow(pChild, trailingSet);
+
+				GrammerSet childSet = first(pChild);
+				if (childSet.m_bNullable)
+					merge(childSet, trailingSet);
+				childSet.m_bNullable = false;
+
+				trailingSet = childSet;
+			}
+		}
+		break;
+		case EGrammerNodeType::ALTERNATION:
+		{
+			for (GrammerNode* pChild : pNode->m_vChildren)
+				bChanged |= follow(pChild, followSet);
+		}
+		break;
+		case EGrammerNodeType::REPETITION:
+		{
+			GrammerSet repeatSet = first(pNode->m_vChildren[0]);
+			repeatSet.m_bNullable = false;
+			merge(repeatSet, followSet);
+
+			bChanged |= follow(pNode->m_vChildren[0], repeatSet);
+		}
+		break;
+		case EGrammerNodeType::OPTIONAL:
+		{
+			bChanged |= follow(pNode->m_vChildren[0], followSet);
+		}
+		break;
+	}
+
+	return bChanged;
+}
+
+void GrammerAnalyzer::computeFollowSets()
+{
+	if (m_vRuleNames.empty())
+		return;
+
+	GrammerTerminal endOfInput = { TokenType_::Type::TK_EOI, "" };
+	m_mapFollow[m_vRuleNames[0]].m_Terminals.insert(endOfInput);
+
+	bool bChanged = true;
+	while (bChanged)
+	{
+		bChanged = false;
+		for (const std::string& sRuleName : m_vRuleNames)
+		{
+			GrammerSet followSet = m_mapFollow[sRuleName];
+			bChanged |= follow(m_mapRules[sRuleName], followSet);
+		}
+	}
+}
+
+void GrammerAnalyzer::buildDispatch(GrammerNode* pAlternation)
+{
+	//////////////////////////////////////////////////////////////////////
+	// BNFToCpp only emits "if(alternative()) { <code> return true; } else ..." chains, so
+	// an alternative must be a single terminal or rule followed by code at most.
+	// Otherwise the alternation keeps plain trial matching.
+	GrammerDispatch& dispatch = m_vDispatch[pAlternation->m_iAlternationId];
+	int32_t iAlternatives = pAlternation->m_vChildren.size();
+	if (iAlternatives < 2 || iAlternatives > MAX_DISPATCH_ALTERNATIVES)
+		return;
+
+	std::map<TokenType_::Type, uint32_t> mapMaskPerType;
+	uint32_t iOpenMask = 0;
+	for (int32_t i = 0; i < iAlternatives; i++)
+	{
+		GrammerNode* pSequence = pAlternation->m_vChildren[i];
+		if (pSequence->m_vChildren.empty())
+			return;
+
+		GrammerNode* pSymbol = pSequence->m_vChildren[0];
+		if (NOT (pSymbol->m_eType == EGrammerNodeType::TERMINAL || pSymbol->m_eType == EGrammerNodeType::NONTERMINAL))
+			return;
+
+		for (size_t j = 1; j < pSequence->m_vChildren.size(); j++)
+		{
+			if (pSequence->m_vChildren[j]->m_eType != EGrammerNodeType::CODE)
+				return;
+		}
+
+		uint32_t iBit = (1u << i);
+		GrammerSet firstSet = first(pSymbol);
+		if (firstSet.m_bAny || firstSet.m_bNullable)
+			iOpenMask |= iBit;					// Has to be tried whatever the token is.
+
+		for (const GrammerTerminal& terminal : firstSet.m_Terminals)
+			mapMaskPerType[terminal.m_eTokenType] |= iBit;
+	}
+
+	if (mapMaskPerType.empty())
+		return;
+
+	// Group the token types sharing the same mask into one case list.
+	std::map<uint32_t, std::vector<TokenType_::Type>> mapTypesPerMask;
+	for (auto& itr : mapMaskPerType)
+		mapTypesPerMask[itr.second | iOpenMask].push_back(itr.first);
+
+	for (auto& itr : mapTypesPerMask)
+		dispatch.m_vCases.push_back(std::make_pair(itr.first, itr.second));
+
+	dispatch.m_iDefaultMask = iOpenMask;
+	dispatch.m_bEnabled = true;
+}
+
+const GrammerDispatch& GrammerAnalyzer::getDispatch(int32_t iAlternationId)
+{
+	static GrammerDispatch disabled;
+	if (iAlternationId < 0 || iAlternationId >= (int32_t)m_vDispatch.size())
+		return disabled;
+
+	return m_vDispatch[iAlternationId];
+}
+
+bool GrammerAnalyzer::merge(GrammerSet& dest, const GrammerSet& src)
+{
+	size_t iSize = dest.m_Terminals.size();
+	bool bAny = dest.m_bAny, bNullable = dest.m_bNullable;
+
+	dest.m_Terminals.insert(src.m_Terminals.begin(), src.m_Terminals.end());
+	dest.m_bAny |= src.m_bAny;
+	dest.m_bNullable |= src.m_bNullable;
+
+	return (dest.m_Terminals.size() != iSize || dest.m_bAny != bAny || dest.m_bNullable != bNullable);
+}
+
+bool GrammerAnalyzer::intersects(const GrammerSet& a, const GrammerSet& b, std::string& sTerminal)
+{
+	// Predicates ("any") are resolved by trying them in order, they are not reported.
+	for (const GrammerTerminal& terminal : a.m_Terminals)
+	{
+		auto itr = b.m_Terminals.lower_bound({ terminal.m_eTokenType, "" });
+		for (; itr != b.m_Terminals.end() && itr->m_eTokenType == terminal.m_eTokenType; itr++)
+		{
+			if (terminal.m_sText.empty() || itr->m_sText.empty() || terminal.m_sText == itr->m_sText)
+			{
+				sTerminal = TokenType_::toString(terminal.m_eTokenType);
+				if (NOT terminal.m_sText.empty() || NOT itr->m_sText.empty())
+					sTerminal += " \"" + (terminal.m_sText.empty() ? itr->m_sText : terminal.m_sText) + "\"";
+
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+int32_t GrammerAnalyzer::checkConflicts(const std::string& sRule, GrammerNode* pNode)
+{
+	int32_t iConflicts = 0;
+	std::string sTerminal;
+
+	switch (pNode->m_eType)
+	{
+		case EGrammerNodeType::NONTERMINAL:
+		{
+			if (m_mapRules.find(pNode->m_sText) == m_mapRules.end())
+			{
+				std::cout << "GrammerAnalyzer << <" << sRule << "> refers to undefined <" << pNode->m_sText << ">" << std::endl;
+				iConflicts++;
+			}
+		}
+		break;
+		case EGrammerNodeType::ALTERNATION:
+		{
+			std::vector<GrammerSet> vFirstSets;
+			for (GrammerNode* pChild : pNode->m_vChildren)
+				vFirstSets.push_back(first(pChild));
+
+			for (size_t i = 0; i < vFirstSets.size(); i++)
+			{
+				for (size_t j = i + 1; j < vFirstSets.size(); j++)
+				{
+					if (intersects(vFirstSets[i], vFirstSets[j], sTerminal))
+					{
+						std::cout << "GrammerAnalyzer << FIRST/FIRST conflict in <" << sRule << ">, alternatives " << i << " & " << j << " both start with " << sTerminal << std::endl;
+						iConflicts++;
+					}
+				}
+
+				if (vFirstSets[i].m_bNullable && intersects(vFirstSets[i], pNode->m_Follow, sTerminal))
+				{
+					std::cout << "GrammerAnalyzer << FIRST/FOLLOW conflict in <" << sRule << ">, empty alternative " << i << " & what follows both start with " << sTerminal << std::endl;
+					iConflicts++;
+				}
+			}
+		}
+		break;
+		case EGrammerNodeType::REPETITION:
+		case EGrammerNodeType::OPTIONAL:
+		{
+			if (intersects(first(pNode->m_vChildren[0]), pNode->m_Follow, sTerminal))
+			{
+				std::cout	<< "GrammerAnalyzer << FIRST/FOLLOW conflict in <" << sRule << ">, "
+							<< ((pNode->m_eType == EGrammerNodeType::REPETITION) ? "{ }" : "[ ]")
+							<< " & what follows both start with " << sTerminal << std::endl;
+				iConflicts++;
+			}
+		}
+		break;
+	}
+
+	for (GrammerNode* pChild : pNode->m_vChildren)
+		iConflicts += checkConflicts(sRule, pChild);
+
+	return iConflicts;
+}
+
+int32_t GrammerAnalyzer::reportConflicts()
+{
+	int32_t iConflicts = 0, iDispatched = 0;
+	for (const std::string& sRuleName : m_vRuleNames)
+		iConflicts += checkConflicts(sRuleName, m_mapRules[sRuleName]);
+
+	for (const GrammerDispatch& dispatch : m_vDispatch)
+	{
+		if (dispatch.m_bEnabled)
+			iDispatched++;
+	}
+
+	std::cout << "GrammerAnalyzer << " << iConflicts << " LL(1) conflict(s), " << iDispatched << " of " << m_vDispatch.size() << " alternations dispatched on the token type." << std::endl;
+
+	return iConflicts;
+}
+
+void GrammerAnalyzer::deleteNode(GrammerNode* pNode)
+{
+	for (GrammerNode* pChild : pNode->m_vChildren)
+		deleteNode(pChild);
+
+	delete pNode;
+}
+
+GrammerAnalyzer::~GrammerAnalyzer()
+{
+	for (auto& itr : m_mapRules)
+		deleteNode(itr.second);
+}
@@ -1,15 +1,19 @@
 #include <iostream>
+#include <cstring>
 #include "BNFToCpp.h"
 
 int main(int argc, char* argv[])
 {
 	if (argc < 3)
 	{
-		std::cout << "Usage: BNFToCpp.exe BNFGrammerInoutFile.gr ClassName" << std::endl;
+		std::cout << "Usage: BNFToCpp.exe BNFGrammerInoutFile.gr ClassName [-nodispatch]" << std::endl;
+		std::cout << "\t-nodispatch\tTry every alternative in turn instead of switching on the token type first." << std::endl;
 	}
 
+	bool bDispatch = NOT (argc > 3 && strcmp(argv[3], "-nodispatch") == 0);
+
 	BNFToCpp* pBNFToCpp = new BNFToCpp();
-	pBNFToCpp->process(argv[1], argv[2]);
+	pBNFToCpp->process(argv[1], argv[2], bDispatch);
 
 	system("copyTinyCReader.bat");
 
@@ -0,0 +1,20 @@
+// Async System Functions
+//		- The native returns a handle at once & finishes on another thread.
+//		- 'await(handle)' parks the VM till the result is in, the host keeps running meanwhile.
+//		- Expected output: "fast = 100", "slow = 500".
+
+SYSFUNC int32_t	$_loadAssetAsync(int32_t iDelayMs);
+
+void main()
+{
+	int32_t hSlow = $_loadAssetAsync(50);
+	int32_t hFast = $_loadAssetAsync(10);
+
+	int32_t iFast = await(hFast);
+	print("fast = ", iFast);
+	putc(10);
+
+	int32_t iSlow = await(hSlow);
+	print("slow = ", iSlow);
+	putc(10);
+}
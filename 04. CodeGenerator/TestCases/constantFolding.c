@@ -0,0 +1,49 @@
+// Constant Folding
+//		- Every rvalue below is folded to a literal, or to the variable it is applied to,
+//		  before any code is emitted. The output must not change whether it is folded or not.
+//		- Expected output:
+//			"fTwoPi = 6.28318, iHalfW = 320, iPixels = 307200, iBytes = 32"
+//			"x = 7, 7, 7, 7, 0, 0, -5, -1, 0"
+//			"c = 44, s = -32768, f = 7, iWrap = -2147483648, iShift = 1073741824"
+
+struct Pixel
+{
+	int8_t	r;
+	int8_t	g;
+	int8_t	b;
+	int8_t	a;
+};
+
+void main()
+{
+	float fTwoPi = 2 * 3.14159;
+	int32_t iHalfW = 1280 / 2 / 2;
+	int32_t iPixels = (1280 / 2) * (960 / 2);
+	int32_t iBytes = sizeOf("Pixel") * 2;
+
+	print("fTwoPi = ", fTwoPi, ", iHalfW = ", iHalfW, ", iPixels = ", iPixels, ", iBytes = ", iBytes);
+	putc(10);
+
+	int32_t x = 7;
+	int32_t a = x * 1;
+	int32_t b = 0 + x;
+	int32_t c0 = x << 0;
+	int32_t d = (x | 0) / 1;
+	int32_t e = x * 0;
+	int32_t g = 0 && x;
+	int32_t h = -5;
+	int32_t k = ~0;
+	int32_t m = !3;
+
+	print("x = ", a, ", ", b, ", ", c0, ", ", d, ", ", e, ", ", g, ", ", h, ", ", k, ", ", m);
+	putc(10);
+
+	int8_t c = 300;
+	int16_t s = 32767 + 1;
+	float f = 7;
+	int32_t iWrap = 2147483647 + 1;
+	int32_t iShift = 1 << 30;
+
+	print("c = ", c, ", s = ", s, ", f = ", f, ", iWrap = ", iWrap, ", iShift = ", iShift);
+	putc(10);
+}
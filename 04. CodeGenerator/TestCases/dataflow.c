@@ -0,0 +1,37 @@
+// Dataflow Passes
+//		- 'iRow = y * iWidth;' does not change in the inner loop & is computed once before it.
+//		- 'iSame = x * x + y;' is read back from 'iSum', which already holds it. Nothing else
+//		  reads 'iSum', so the value goes straight to 'iSame'.
+//		- 'iUnused' is never read, its 'STORE' & the expression computing it are removed.
+//		- 'iCopy' holds what 'iTotal' holds, reads of it read 'iTotal'.
+//		- Expected output: "total = 2880, same = 1458, copy = 2880".
+
+void main()
+{
+	int32_t iWidth = 8;
+	int32_t iTotal = 0;
+	int32_t iSame = 0;
+	int32_t y = 0;
+
+	while (y < 10)
+	{
+		int32_t x = 0;
+		while (x < iWidth)
+		{
+			int32_t iRow = y * iWidth;
+			int32_t iSum = x * x + y;
+			iSame = x * x + y;
+			int32_t iUnused = iRow - x;
+
+			iTotal = iTotal + iRow;
+			x = x + 1;
+		}
+
+		iSame = iSame + 1400;
+		y = y + 1;
+	}
+
+	int32_t iCopy = iTotal;
+	print("total = ", iTotal, ", same = ", iSame, ", copy = ", iCopy);
+	putc(10);
+}
@@ -0,0 +1,93 @@
+// Devirtualization
+//		- pDog & pBird are only ever set by 'new', their speak() & wings() are called directly.
+//		- legs() is not overridden below Animal, countLegs() & legsTimes() call it directly.
+//		- pPet holds an Animal & then a Dog, speakTwice() is given both, their speak() stays 'virtual'.
+//		- Expected output: "Woof", "Tweet", "...", "Woof", then "Woof", "Woof", "Tweet", "Tweet" 3 times,
+//		  "legs = 4, wings = 2, legsTimes = 12".
+
+struct Animal
+{
+	int32_t m_iID = 0;
+
+	inline virtual int32_t legs()
+	{
+		return 4;
+	}
+
+	inline virtual void speak()
+	{
+		print("...");
+		putc(10);
+	}
+
+	inline int32_t legsTimes(int32_t iCount)
+	{
+		int32_t iLegs = this->legs();
+		return iLegs * iCount;
+	}
+};
+
+struct Bird : Animal
+{
+	inline virtual int32_t wings()
+	{
+		return 2;
+	}
+
+	inline virtual void speak()
+	{
+		print("Tweet");
+		putc(10);
+	}
+};
+
+struct Dog : Animal
+{
+	inline virtual void speak()
+	{
+		print("Woof");
+		putc(10);
+	}
+};
+
+void speakTwice(Animal* pAnimal)
+{
+	pAnimal->speak();
+	pAnimal->speak();
+}
+
+int32_t countLegs(Animal* pAnimal)
+{
+	int32_t iLegs = pAnimal->legs();
+	return iLegs;
+}
+
+void main()
+{
+	Dog* pDog = new Dog();
+	pDog->speak();
+	Bird* pBird = new Bird();
+	pBird->speak();
+	int32_t iWings = pBird->wings();
+
+	Animal* pPet = new Animal();
+	pPet->speak();
+	pPet = new Dog();
+	pPet->speak();
+
+	int32_t i = 0;
+	while (i < 3)
+	{
+		speakTwice(pDog);
+		speakTwice(pBird);
+		i = i + 1;
+	}
+
+	int32_t iLegs = countLegs(pDog);
+	int32_t iLegsTimes = pDog->legsTimes(3);
+	print("legs = ", iLegs, ", wings = ", iWings, ", legsTimes = ", iLegsTimes);
+	putc(10);
+
+	free(pDog);
+	free(pBird);
+}
@@ -0,0 +1,113 @@
+// Escape Analysis
+//		- pOrigin & pStep are only used through '->' & passed to move() & lengthOf(), which only use
+//		  their ARGUMENTs through '->' as well. Both are built in main()'s STACK FRAME, free() only
+//		  runs their destructors.
+//		- pScratch is made & destroyed on each pass of the loop, in the same LOCALs each time.
+//		- depth() makes an object in each of its 6 calls, every frame holds its own.
+//		- pKept is stored in a static by keep(), pReturned is returned by makeSum() & pFreed is freed
+//		  by release(), those stay on the HEAP.
+//		- Expected output: "origin = 7, 9", "length = 16", "~Vec 4", "~Vec 5", "~Vec 6",
+//		  "kept = 3, freed = 8", "~Vec 8", "depth = 15", "~Vec 7", "~Vec 2".
+
+struct Vec
+{
+	int32_t m_iX = 0;
+	int32_t m_iY = 0;
+
+	inline int32_t length()
+	{
+		return m_iX + m_iY;
+	}
+
+	inline void #Vec()
+	{
+		print("~Vec ", m_iX);
+		putc(10);
+	}
+};
+
+static Vec* pKeptVec;
+
+int32_t lengthOf(Vec* pVec)
+{
+	int32_t iLength = pVec->length();
+	return iLength;
+}
+
+void move(Vec* pVec, Vec* pBy)
+{
+	pVec->m_iX = pVec->m_iX + pBy->m_iX;
+	pVec->m_iY = pVec->m_iY + pBy->m_iY;
+}
+
+void keep(Vec* pVec)
+{
+	pKeptVec = pVec;
+}
+
+int32_t makeSum(int32_t a, int32_t b)
+{
+	Vec* pReturned = new Vec();
+	pReturned->m_iX = a + b;
+	return pReturned;
+}
+
+void release(Vec* pVec)
+{
+	free(pVec);
+}
+
+int32_t depth(int32_t n)
+{
+	Vec* pLevel = new Vec();
+	pLevel->m_iX = n;
+	int32_t iSum = 0;
+	if (n > 0)
+	{
+		iSum = depth(n - 1);
+	}
+
+	iSum = iSum + pLevel->m_iX;
+	return iSum;
+}
+
+void main()
+{
+	Vec* pOrigin = new Vec();
+	pOrigin->m_iX = 5;
+	pOrigin->m_iY = 6;
+	Vec* pStep = new Vec();
+	pStep->m_iX = 2;
+	pStep->m_iY = 3;
+	move(pOrigin, pStep);
+	print("origin = ", pOrigin->m_iX, ", ", pOrigin->m_iY);
+	putc(10);
+	int32_t iLength = lengthOf(pOrigin);
+	print("length = ", iLength);
+	putc(10);
+
+	int32_t i = 4;
+	while (i < 7)
+	{
+		Vec pScratch;
+		pScratch->m_iX = i;
+		i = i + 1;
+	}
+
+	Vec* pKept = new Vec();
+	pKept->m_iX = 3;
+	keep(pKept);
+	int32_t iReturned = makeSum(5, 7);
+	Vec* pFreed = new Vec();
+	pFreed->m_iX = 8;
+	print("kept = ", pKept->m_iX, ", freed = ", pFreed->m_iX);
+	putc(10);
+	release(pFreed);
+
+	int32_t iDepth = depth(5);
+	print("depth = ", iDepth);
+	putc(10);
+
+	free(pOrigin);
+	free(pStep);
+}
@@ -0,0 +1,27 @@
+// Host Data
+//		- 05. VMInterpreter's main() registers iHD_Answer = 42 & fHD_Scale = 2.5 before it loads
+//		  main.o, the VM copies them into the HOSTDATA segment on load().
+//		- Reads are plain 'FETCH'es, so the fields mix with locals in expressions & conditions.
+//		- iHD_Missing is not registered by the host, the VM adds it & it reads as 0.
+//		- Writing a field is rejected by the compiler, see hostDataWrite.c.
+//		- Expected output: "answer = 42, scale = 2.5, missing = 0", "sum = 50, scaled = 10, big = 1".
+
+HOSTDATA int32_t	iHD_Answer;
+HOSTDATA float		fHD_Scale;
+HOSTDATA int32_t	iHD_Missing;
+
+void main()
+{
+	print("answer = ", iHD_Answer, ", scale = ", fHD_Scale, ", missing = ", iHD_Missing);
+	putc(10);
+
+	int32_t iSum = iHD_Answer + 8;
+	float fScaled = fHD_Scale * 4.0;
+	int32_t iBig = 0;
+	if (iHD_Answer > 40 && fHD_Scale > 2.0)
+	{
+		iBig = 1;
+	}
+	print("sum = ", iSum, ", scaled = ", fScaled, ", big = ", iBig);
+	putc(10);
+}
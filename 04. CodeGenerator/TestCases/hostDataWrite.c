@@ -0,0 +1,16 @@
+// Host Data Write
+//		- HOSTDATA fields are owned by the host & read-only in the script, this file must not
+//		  compile. Each write below is rejected: '=', a prefix & a postfix increment.
+//		- Expected output: a Debug build stops on the assert at the first write, a Release build
+//		  prints "ERROR: HOSTDATA field 'iHD_Answer' is read-only." for each of the 3 writes.
+
+HOSTDATA int32_t	iHD_Answer;
+
+void main()
+{
+	iHD_Answer = 7;
+	++iHD_Answer;
+	iHD_Answer++;
+	print("answer = ", iHD_Answer);
+	putc(10);
+}
@@ -0,0 +1,120 @@
+// Function Inlining
+//		- square(), limit() & sumTo() are copied into main() in place of their calls, their
+//		  ARGUMENTs & LOCALs become LOCALs of main() past its own.
+//		- limit()'s jump & sumTo()'s loop move along with the copied body.
+//		- sumOfSquares() has square() inlined into it, which leaves it too big to be inlined itself.
+//		- factorial() calls itself & is always called.
+//		- Counter's getters & add() are inlined too, their MEMBER variables are read through 'RCX',
+//		  which holds pCounter as it would for the call. scaled() inlines get() with 'this'.
+//		- Compiling with "-inline=0" gives the same output without inlining anything.
+//		- Expected output: "square = 49, limit = 5 10, sumTo = 55", "sumOfSquares = 25, factorial = 120",
+//		  "total = 338350", "counter = 15 30 45".
+
+int32_t square(int32_t iValue)
+{
+	return iValue * iValue;
+}
+
+int32_t limit(int32_t iValue, int32_t iHigh)
+{
+	int32_t iResult = iValue;
+	if (iValue > iHigh)
+	{
+		iResult = iHigh;
+	}
+
+	return iResult;
+}
+
+int32_t sumTo(int32_t iCount)
+{
+	int32_t iSum = 0;
+	int32_t i = 1;
+	while (i <= iCount)
+	{
+		iSum = iSum + i;
+		i = i + 1;
+	}
+
+	return iSum;
+}
+
+int32_t sumOfSquares(int32_t a, int32_t b)
+{
+	int32_t iA = square(a);
+	int32_t iB = square(b);
+
+	return iA + iB;
+}
+
+int32_t factorial(int32_t n)
+{
+	int32_t iResult = 1;
+	if (n > 1)
+	{
+		int32_t iNext = factorial(n - 1);
+		iResult = n * iNext;
+	}
+
+	return iResult;
+}
+
+struct Counter
+{
+	int32_t m_iCount = 0;
+	int32_t m_iStep = 5;
+
+	inline int32_t get()
+	{
+		return m_iCount;
+	}
+
+	inline void add()
+	{
+		m_iCount = m_iCount + m_iStep;
+	}
+
+	inline int32_t scaled(int32_t iBy)
+	{
+		int32_t iCount = this->get();
+		return iCount * iBy;
+	}
+};
+
+void main()
+{
+	int32_t iSquare = square(7);
+	int32_t iLow = limit(5, 10);
+	int32_t iHigh = limit(42, 10);
+	int32_t iSumTo = sumTo(10);
+	int32_t iSumOfSquares = sumOfSquares(3, 4);
+	int32_t iFactorial = factorial(5);
+	int32_t iTotal = 0;
+	int32_t i = 1;
+
+	print("square = ", iSquare, ", limit = ", iLow, " ", iHigh, ", sumTo = ", iSumTo);
+	putc(10);
+	print("sumOfSquares = ", iSumOfSquares, ", factorial = ", iFactorial);
+	putc(10);
+
+	while (i <= 100)
+	{
+		int32_t iSquared = square(i);
+		iTotal = iTotal + iSquared;
+		i = i + 1;
+	}
+
+	print("total = ", iTotal);
+	putc(10);
+
+	Counter* pCounter = new Counter();
+	pCounter->add();
+	pCounter->add();
+	pCounter->add();
+	int32_t iCount = pCounter->get();
+	int32_t iDouble = pCounter->scaled(2);
+	int32_t iTriple = pCounter->scaled(3);
+	print("counter = ", iCount, " ", iDouble, " ", iTriple);
+	putc(10);
+	free(pCounter);
+}
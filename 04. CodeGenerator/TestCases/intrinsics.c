@@ -0,0 +1,44 @@
+// Math Intrinsics
+//		- sin, cos, sqrt, abs, min, max, floor & lerp each compile to their own opcode, no host
+//		  function is needed, so this runs in the bare VM.
+//		- Int arguments are cast to float, 'iNeg' is read back as -7.
+//		- srand(42) seeds the VM's xorshift32, rand() then returns the top 24 bits of each state
+//		  as a float in [0, 1). Reseeding with 42 repeats the same 3 numbers.
+//		- Expected output: "sin = 0.841471, cos = 0.540302, sqrt = 1.41421, abs = 7",
+//		  "min = -2.5, max = 3, floor = -3, lerp = 7.5",
+//		  "rand = 0.00264388, 0.660312, 0.110957", "again = 0.00264388, 0.660312, 0.110957".
+
+void main()
+{
+	float fOne = 1.0;
+	int32_t iNeg = -7;
+	float fMinusTwoHalf = -2.5;
+
+	float fSin = sin(fOne);
+	float fCos = cos(fOne);
+	float fSqrt = sqrt(2);
+	float fAbs = abs(iNeg);
+	print("sin = ", fSin, ", cos = ", fCos, ", sqrt = ", fSqrt, ", abs = ", fAbs);
+	putc(10);
+
+	float fMin = min(fMinusTwoHalf, 3);
+	float fMax = max(fMinusTwoHalf, 3);
+	float fFloor = floor(fMinusTwoHalf);
+	float fLerp = lerp(5.0, 10.0, 0.5);
+	print("min = ", fMin, ", max = ", fMax, ", floor = ", fFloor, ", lerp = ", fLerp);
+	putc(10);
+
+	srand(42);
+	float fRand0 = rand();
+	float fRand1 = rand();
+	float fRand2 = rand();
+	print("rand = ", fRand0, ", ", fRand1, ", ", fRand2);
+	putc(10);
+
+	srand(42);
+	fRand0 = rand();
+	fRand1 = rand();
+	fRand2 = rand();
+	print("again = ", fRand0, ", ", fRand1, ", ", fRand2);
+	putc(10);
+}
@@ -0,0 +1,96 @@
+// Compare & Branch Benchmark
+//		- Every loop test & 'if' below is a single comparison, so it becomes one BR_xx
+//		  instead of a JMP_xx pushing 0/1 followed by a JZ.
+//		- 'fLimit' makes the last loop compare floats with BR_LTF.
+//		- NaN compares false both ways, so a float 'if' must not branch on the opposite
+//		  comparison: neither 'fNaN < fOne' nor 'fNaN >= fOne' may take its branch.
+//		- '&&' & '||' mixing int & float comparisons compare each one by its own operands,
+//		  a negative int compared as a float reads as NaN. The first four take their branch,
+//		  the last one does not.
+//		- Expected output: "count = 35000, odd = 17500, steps = 100, nan hits = 0",
+//		  "mixed = 15".
+
+void main()
+{
+	int32_t i = 0;
+	int32_t j = 0;
+	int32_t iCount = 0;
+	int32_t iOdd = 0;
+	float fValue = 0.0;
+	float fLimit = 25.0;
+	int32_t iSteps = 0;
+	float fZero = 0.0;
+	float fOne = 1.0;
+	float fNaN = 0.0;
+	int32_t iNaNHits = 0;
+	float fA = 1.5;
+	float fB = 2.5;
+	int32_t iX = 3;
+	int32_t iY = -3;
+	int32_t iZ = -1;
+	int32_t iMixed = 0;
+
+	while (i < 350)
+	{
+		j = 0;
+		while (j < 100)
+		{
+			if ((j % 2) != 0)
+			{
+				iOdd = iOdd + 1;
+			}
+
+			iCount = iCount + 1;
+			j = j + 1;
+		}
+
+		i = i + 1;
+	}
+
+	while (fValue < fLimit)
+	{
+		fValue = fValue + 0.25;
+		iSteps = iSteps + 1;
+	}
+
+	fNaN = fZero / fZero;
+	if (fNaN < fOne)
+	{
+		iNaNHits = iNaNHits + 1;
+	}
+
+	if (fNaN >= fOne)
+	{
+		iNaNHits = iNaNHits + 10;
+	}
+
+	if (iX > iY && fA < fB)
+	{
+		iMixed = iMixed + 1;
+	}
+
+	if (fA < fB && iX > iY)
+	{
+		iMixed = iMixed + 2;
+	}
+
+	if (fA > fB || iX > iY)
+	{
+		iMixed = iMixed + 4;
+	}
+
+	if (iZ < 0 || fA > fB)
+	{
+		iMixed = iMixed + 8;
+	}
+
+	if (iX < iY || fA > fB)
+	{
+		iMixed = iMixed + 16;
+	}
+
+	print("count = ", iCount, ", odd = ", iOdd, ", steps = ", iSteps, ", nan hits = ", iNaNHits);
+	putc(10);
+	print("mixed = ", iMixed);
+	putc(10);
+}
@@ -13,7 +13,6 @@
 
 // https://gamepopper.co.uk/posts/page/1/
 
-SYSFUNC void 	$_randomSeed(int32_t iSeed);
 SYSFUNC void 	$_glMatrixMode(int32_t iGL_MODELVIEW);
 SYSFUNC void 	$_glLoadIdentity();
 SYSFUNC void 	$_glClearColor(float iRed, float iGreen, float iBlue, float iAlpha);
@@ -26,16 +25,15 @@ SYSFUNC void 	$_glVertex2i(int32_t iX, int32_t iY);
 SYSFUNC void 	$_glEnd();
 
 SYSFUNC void 	$_glRotationzf(float zRot, float yRot, float fAngle);
-SYSFUNC float 	$_osClock_ElapsedTimeinSeconds();
-SYSFUNC float 	$_osClock_DeltaTimeInMs();
-SYSFUNC float 	$_random();
-SYSFUNC float 	$_sine(float fAngleInRadians);
 
-SYSFUNC int32_t	$_getScreenWidth();
-SYSFUNC int32_t	$_getScreenHeight();
-SYSFUNC int32_t	$_getMouseX();
-SYSFUNC int32_t	$_getMouseY();
-SYSFUNC	int32_t	$_isKeyPressed(int32_t iKeyCode);
+// Host Data, written by the host every frame & read by the script as plain loads.
+HOSTDATA float		fHD_ElapsedTimeSec;
+HOSTDATA float		fHD_DeltaTimeMs;
+HOSTDATA int32_t	iHD_ScreenWidth;
+HOSTDATA int32_t	iHD_ScreenHeight;
+HOSTDATA int32_t	iHD_MouseX;
+HOSTDATA int32_t	iHD_MouseY;
+HOSTDATA int32_t	iHD_Keys3;		// Keyboard bitset, keys 96..127 ==> bits 0..31
 
 // helper function to render a screen aligned Quad
 void RenderQuad(float topLeft_x, float topLeft_y, float topRight_x, float topRight_y, float bottomLeft_x, float bottomLeft_y, float bottomRight_x, float bottomRight_y)
@@ -119,7 +117,7 @@ void drawWindMill()
 	RenderQuadHorGrad(X - 0.085, Y + 0.1, X, Y + 0.1, X - 0.085, Y - 0.1, X, Y - 0.1, 0.38, 0.38, 0.38, 0.55, 0.55, 0.55);
 
 	$_glColor3f(0.55, 0.55, 0.55);	
-	$_glRotationzf(X, Y, $_osClock_ElapsedTimeinSeconds() * 0.6);
+	$_glRotationzf(X, Y, fHD_ElapsedTimeSec * 0.6);
 
 	// top left rotor
 	RenderQuadHorGrad(-0.05, -0.004, -0.025, 0.022, -0.1884, 0.0337, -0.1553, 0.088, 0.5, 0.5, 0.5, 0.65, 0.65, 0.65);
@@ -162,11 +160,11 @@ void drawClouds()
 	$_glColor3f(0.8, 0.8, 0.8);
 	for(int8_t i = 1; i < 20; i++)
 	{
-		float x = ( ( ( $_random() + $_osClock_ElapsedTimeinSeconds() * 0.05 ) ) % 1 ) * 3 - 1.5; 						// clouds are on the hole horizon
-		float y = $_random() * 0.6 + 0.4 + 0.1 * $_sine( $_random() * 100 + 0.3 * $_osClock_ElapsedTimeinSeconds() ); 	// clouds are only at the top
+		float x = ( ( ( rand() + fHD_ElapsedTimeSec * 0.05 ) ) % 1 ) * 3 - 1.5; 						// clouds are on the hole horizon
+		float y = rand() * 0.6 + 0.4 + 0.1 * sin( rand() * 100 + 0.3 * fHD_ElapsedTimeSec ); 	// clouds are only at the top
 
-		float width = $_random() * 0.25 + 0.25;
-		float height = $_random() * 0.15 + 0.15;
+		float width = rand() * 0.25 + 0.25;
+		float height = rand() * 0.15 + 0.15;
 
 		RenderQuadVertGrad(x, y, x + width, y, x, y - height, x + width, y - height, 0.9, 0.9, 0.9, 0.65, 0.65, 0.65);
 	}
@@ -174,7 +172,7 @@ void drawClouds()
 
 int32_t ClipX(int32_t x)
 {
-	int32_t iSW = $_getScreenWidth();
+	int32_t iSW = iHD_ScreenWidth;
 	int32_t iReturnX = x;
 	
 	if (x < 0) 
@@ -191,7 +189,7 @@ int32_t ClipX(int32_t x)
 
 int32_t ClipY(int32_t y)
 {
-	int32_t iSH = $_getScreenHeight();
+	int32_t iSH = iHD_ScreenHeight;
 	int32_t iReturnY = y;
 	
 	if (y < 0)
@@ -209,8 +207,8 @@ int32_t ClipY(int32_t y)
 
 void draw(int32_t x, int32_t y, float fRed, float fGreen, float fBlue)
 {
-	float fX = (x * 1.0) / $_getScreenWidth();
-	float fY = (($_getScreenHeight() - y) * 1.0) / $_getScreenHeight();
+	float fX = (x * 1.0) / iHD_ScreenWidth;
+	float fY = ((iHD_ScreenHeight - y) * 1.0) / iHD_ScreenHeight;
 	
 	$_glBegin(0); // GL_POINTS
 		$_glColor3f(fRed, fGreen, fBlue);
@@ -220,8 +218,8 @@ void draw(int32_t x, int32_t y, float fRed, float fGreen, float fBlue)
 
 void DrawLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, float fRed, float fGreen, float fBlue)
 {
-	float fHalfW = $_getScreenWidth() / 2.0;
-	float fHalfH = $_getScreenHeight() / 2.0;
+	float fHalfW = iHD_ScreenWidth / 2.0;
+	float fHalfH = iHD_ScreenHeight / 2.0;
 
 	float fX1 = (x1 - fHalfW) / fHalfW;
 	float fY1 = ((fHalfH - y1) * 1.0) / fHalfH;
@@ -243,8 +241,8 @@ void Fill(int32_t x1, int32_t y1, int32_t x2, int32_t y2, float fRed, float fGre
 	int32_t xX2 = ClipX(x2);
 	int32_t yY2 = ClipY(y2);
 	
-	float fHalfW = $_getScreenWidth() / 2.0;
-	float fHalfH = $_getScreenHeight() / 2.0;
+	float fHalfW = iHD_ScreenWidth / 2.0;
+	float fHalfH = iHD_ScreenHeight / 2.0;
 	
 	float xLeft = (xX1 - fHalfW) / fHalfW;
 	float yTop = ((fHalfH - yY1) * 1.0) / fHalfH;
@@ -258,8 +256,8 @@ void Fill(int32_t x1, int32_t y1, int32_t x2, int32_t y2, float fRed, float fGre
 
 void DrawMouse()
 {
-	int32_t iMouseX = $_getMouseX();
-	int32_t iMouseY = $_getMouseY();
+	int32_t iMouseX = iHD_MouseX;
+	int32_t iMouseY = iHD_MouseY;
 	
 	int32_t iX1 = iMouseX - 2;
 	int32_t iY1 = iMouseY - 2;
@@ -317,22 +315,22 @@ static Player* pPlayer;
 
 void UpdatePlayer()
 {
-	int32_t iOff = ($_osClock_DeltaTimeInMs() * 200.0 * 0.001);
+	int32_t iOff = (fHD_DeltaTimeMs * 200.0 * 0.001);
 	
-	if($_isKeyPressed(119) >= 1) // 'w'
+	if(((iHD_Keys3 >> 23) & 1) >= 1) // 'w'
 	{
 		pPlayer->m_iPosY = pPlayer->m_iPosY - iOff;
 	}
-	if($_isKeyPressed(115) >= 1) // 's'
+	if(((iHD_Keys3 >> 19) & 1) >= 1) // 's'
 	{
 		pPlayer->m_iPosY = pPlayer->m_iPosY + iOff;
 	}
 	
-	if($_isKeyPressed(97) >= 1) // 'a'
+	if(((iHD_Keys3 >> 1) & 1) >= 1) // 'a'
 	{
 		pPlayer->m_iPosX = pPlayer->m_iPosX - iOff;
 	}
-	if($_isKeyPressed(100) >= 1) // 'd'
+	if(((iHD_Keys3 >> 4) & 1) >= 1) // 'd'
 	{
 		pPlayer->m_iPosX = pPlayer->m_iPosX + iOff;
 	}
@@ -340,8 +338,8 @@ void UpdatePlayer()
 	int32_t iX = pPlayer->getPosX();
 	int32_t iY = pPlayer->getPosY();
 
-	int32_t iSW = $_getScreenWidth();
-	int32_t iSH = $_getScreenHeight();
+	int32_t iSW = iHD_ScreenWidth;
+	int32_t iSH = iHD_ScreenHeight;
 
 	if(iX > iSW)
 	{
@@ -370,7 +368,7 @@ void UpdatePlayer()
 
 void render()
 {	
-	$_randomSeed(0);
+	srand(0);
 	$_glMatrixMode(5888); 	// GL_MODELVIEW(0x1700)
 	$_glLoadIdentity();
 	$_glClearColor(0.0, 0.0, 0.0, 0.0);
@@ -388,18 +386,19 @@ void render()
 	
 	DrawMouse();
 
-	// Update Player
-	if(pPlayer == 0)
-	{
-		pPlayer = new Player();
-		pPlayer->setPosition(400, 400);
-		pPlayer->setID(1);
-	}
-
 	UpdatePlayer();
 }
 
-void main()
+// Called by the host every frame, globals & the HEAP live on between calls.
+void update()
 {
 	render();
 }
+
+// Runs once after loading.
+void main()
+{
+	pPlayer = new Player();
+	pPlayer->setPosition(400, 400);
+	pPlayer->setID(1);
+}
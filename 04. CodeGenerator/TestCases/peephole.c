@@ -0,0 +1,56 @@
+// Peephole Optimizer
+//		- 'int32_t iNegative = sign(-7);' stores the call's result in a temporary & fetches it
+//		  right back, which becomes 'DUP; STORE'.
+//		- The inner 'if' has no 'else', the jump over it lands on the next instruction & is removed.
+//		- Every call still returns to the right place after the code around it moved.
+//		- Expected output: "sign = -1, 0, 1", "total = 4950, evens = 50, odds = 50".
+
+int32_t sign(int32_t iValue)
+{
+	int32_t iSign = 1;
+	if (iValue < 0)
+	{
+		iSign = -1;
+	}
+	else
+	{
+		if (iValue == 0)
+		{
+			iSign = 0;
+		}
+	}
+
+	return iSign;
+}
+
+void main()
+{
+	int32_t i = 0;
+	int32_t iTotal = 0;
+	int32_t iEvens = 0;
+	int32_t iOdds = 0;
+	int32_t iNegative = sign(-7);
+	int32_t iZero = sign(0);
+	int32_t iPositive = sign(7);
+
+	print("sign = ", iNegative, ", ", iZero, ", ", iPositive);
+	putc(10);
+
+	while (i < 100)
+	{
+		iTotal = iTotal + i;
+		if ((i % 2) == 0)
+		{
+			iEvens = iEvens + 1;
+		}
+		else
+		{
+			iOdds = iOdds + 1;
+		}
+
+		i = i + 1;
+	}
+
+	print("total = ", iTotal, ", evens = ", iEvens, ", odds = ", iOdds);
+	putc(10);
+}
@@ -0,0 +1,53 @@
+// Short-Circuit '&&' & '||'
+//		- The right operand runs only if the left one does not decide the result.
+//		- A division by zero or a 'touch()' print in a skipped operand would show up in the output.
+//		- Expected output, in order: "r1 = 0", "r2 = 1", "guarded", "touch 3", "r3 = 1",
+//		  "touch 0", "touch 1", "touch 2", "i = 3".
+
+int32_t touch(int32_t iValue)
+{
+	print("touch ", iValue);
+	putc(10);
+
+	return iValue + 1;
+}
+
+void main()
+{
+	int32_t d = 0;
+	int32_t r = 0;
+	int32_t i = 0;
+
+	r = (d != 0) && (100 / d > 3);
+	print("r1 = ", r);
+	putc(10);
+
+	r = (d == 0) || (100 / d > 3);
+	print("r2 = ", r);
+	putc(10);
+
+	if ((d == 0) || (100 / d > 3))
+	{
+		print("guarded");
+		putc(10);
+	}
+
+	if ((d != 0) && (touch(1) > 0))
+	{
+		print("never");
+		putc(10);
+	}
+
+	r = (d == 0) || (touch(2) > 0);
+	r = (d == 0) && (touch(3) > 0);
+	print("r3 = ", r);
+	putc(10);
+
+	while ((i < 3) && (touch(i) > 0))
+	{
+		i = i + 1;
+	}
+
+	print("i = ", i);
+	putc(10);
+}
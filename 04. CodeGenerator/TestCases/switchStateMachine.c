@@ -0,0 +1,165 @@
+// Switch Lowering Benchmark
+//		- 'step()' is a 32 state machine. Its cases are dense, so the switch becomes one JMPTABLE.
+//		- 'weight()' has sparse cases, they are found by a binary search on the state.
+//		- 'main()' runs the machine for a while & prints a checksum, which must not change
+//		  whichever way the switches are lowered.
+
+int32_t step(int32_t iState)
+{
+	int32_t iNext = 0;
+	switch(iState)
+	{
+		case 0:
+			iNext = 5;
+		break;
+		case 1:
+			iNext = 18;
+		break;
+		case 2:
+			iNext = 31;
+		break;
+		case 3:
+			iNext = 12;
+		break;
+		case 4:
+			iNext = 25;
+		break;
+		case 5:
+			iNext = 6;
+		break;
+		case 6:
+			iNext = 19;
+		break;
+		case 7:
+			iNext = 0;
+		break;
+		case 8:
+			iNext = 13;
+		break;
+		case 9:
+			iNext = 26;
+		break;
+		case 10:
+			iNext = 7;
+		break;
+		case 11:
+			iNext = 20;
+		break;
+		case 12:
+			iNext = 1;
+		break;
+		case 13:
+			iNext = 14;
+		break;
+		case 14:
+			iNext = 27;
+		break;
+		case 15:
+			iNext = 8;
+		break;
+		case 16:
+			iNext = 21;
+		break;
+		case 17:
+			iNext = 2;
+		break;
+		case 18:
+			iNext = 15;
+		break;
+		case 19:
+			iNext = 28;
+		break;
+		case 20:
+			iNext = 9;
+		break;
+		case 21:
+			iNext = 22;
+		break;
+		case 22:
+			iNext = 3;
+		break;
+		case 23:
+			iNext = 16;
+		break;
+		case 24:
+			iNext = 29;
+		break;
+		case 25:
+			iNext = 10;
+		break;
+		case 26:
+			iNext = 23;
+		break;
+		case 27:
+			iNext = 4;
+		break;
+		case 28:
+			iNext = 17;
+		break;
+		case 29:
+			iNext = 30;
+		break;
+		case 30:
+			iNext = 11;
+		break;
+		case 31:
+			iNext = 24;
+		break;
+		default:
+			iNext = 0;
+		break;
+	}
+
+	return iNext;
+}
+
+int32_t weight(int32_t iState)
+{
+	int32_t iWeight = 1;
+	switch(iState)
+	{
+		case 1:
+			iWeight = 3;
+		break;
+		case 3:
+			iWeight = 5;
+		break;
+		case 7:
+			iWeight = 7;
+		break;
+		case 12:
+			iWeight = 11;
+		break;
+		case 18:
+			iWeight = 13;
+		break;
+		case 25:
+			iWeight = 17;
+		break;
+		case 29:
+			iWeight = 19;
+		break;
+		case 31:
+			iWeight = 23;
+		break;
+	}
+
+	return iWeight;
+}
+
+void main()
+{
+	int32_t iState = 0;
+	int32_t iChecksum = 0;
+	int32_t i = 0;
+
+	while(i < 20000)
+	{
+		iState = step(iState);
+		iChecksum = (iChecksum + weight(iState)) & 65535;
+		i = i + 1;
+	}
+
+	print("state = ", iState, ", checksum = ", iChecksum);
+	putc(10);
+}
@@ -0,0 +1,66 @@
+// Tail Calls
+//		- sumAcc() & gcd() only return what their recursive call returns, each call becomes a
+//		  'TAILCALL' which reuses the caller's STACK FRAME.
+//		- sumAcc(2000, 0) recurses 2000 deep, far more than the 256 slot STACK holds frames for.
+//		- powerOf() takes 2 arguments & tail calls power() with 3, sumBetween() takes 3 & tail
+//		  calls sumAcc() with 2. Both are small enough to be inlined into main(), compile with
+//		  "-inline=0" to run their 'TAILCALL's.
+//		- main() prints after its calls, none of them is a tail call.
+//		- Expected output: "sumAcc = 2001000, gcd = 21", "power = 1024, sumBetween = 215".
+
+int32_t sumAcc(int32_t n, int32_t iAcc)
+{
+	int32_t r = iAcc;
+	if (n > 0)
+	{
+		r = sumAcc(n - 1, iAcc + n);
+	}
+
+	return r;
+}
+
+int32_t gcd(int32_t a, int32_t b)
+{
+	int32_t r = a;
+	if (b != 0)
+	{
+		r = gcd(b, a % b);
+	}
+
+	return r;
+}
+
+int32_t power(int32_t iBase, int32_t iExp, int32_t iAcc)
+{
+	int32_t r = iAcc;
+	if (iExp > 0)
+	{
+		r = power(iBase, iExp - 1, iAcc * iBase);
+	}
+
+	return r;
+}
+
+int32_t powerOf(int32_t iBase, int32_t iExp)
+{
+	return power(iBase, iExp, 1);
+}
+
+int32_t sumBetween(int32_t iLow, int32_t iHigh, int32_t iScale)
+{
+	int32_t r = sumAcc(iHigh * iScale, iLow);
+	return r;
+}
+
+void main()
+{
+	int32_t iSum = sumAcc(2000, 0);
+	int32_t iGcd = gcd(1071, 462);
+	int32_t iPower = powerOf(2, 10);
+	int32_t iBetween = sumBetween(5, 10, 2);
+
+	print("sumAcc = ", iSum, ", gcd = ", iGcd);
+	putc(10);
+	print("power = ", iPower, ", sumBetween = ", iBetween);
+	putc(10);
+}
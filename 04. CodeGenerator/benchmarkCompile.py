@@ -0,0 +1,61 @@
+# Compares the compile time & peak memory of one or more CodeGenerator builds on a source.
+#		- usage: python benchmarkCompile.py <source.c> <CodeGenerator.exe> [<CodeGenerator.exe> ...] [-rounds=N]
+#		- Each build is run with -compilebench, interleaved with the others, N times(default 9),
+#		  in a scratch directory so main.o of the tree is left alone.
+#		- Reports the median & the min of the compile time and the median peak memory per build.
+#		- For generateLargeSource.py's 50k lines, build with a larger MAX_BYTECODE_SIZE(GrammerUtils.h).
+
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+def runOnce(sCompiler, sSource, sWorkDir):
+	result = subprocess.run([sCompiler, sSource, "-compilebench"], cwd=sWorkDir, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+	sOutput = result.stdout.decode("latin-1")
+
+	matchTime = re.search(r"compile time : ([0-9.e+-]+) ms", sOutput)
+	matchMemory = re.search(r"peak memory  : ([0-9.e+-]+) MB", sOutput)
+	if result.returncode != 0 or matchTime is None or matchMemory is None:
+		print("%s failed on %s:" % (sCompiler, sSource))
+		print("\n".join(sOutput.splitlines()[-10:]))
+		sys.exit(1)
+
+	return float(matchTime.group(1)), float(matchMemory.group(1))
+
+def median(vValues):
+	vSorted = sorted(vValues)
+	return vSorted[len(vSorted) // 2]
+
+def main():
+	vArgs = [sArg for sArg in sys.argv[1:] if not sArg.startswith("-rounds=")]
+	vRounds = [int(sArg[len("-rounds="):]) for sArg in sys.argv[1:] if sArg.startswith("-rounds=")]
+	iRounds = vRounds[-1] if len(vRounds) > 0 else 9
+	if len(vArgs) < 2 or iRounds < 1:
+		print("usage: python benchmarkCompile.py <source.c> <CodeGenerator.exe> [<CodeGenerator.exe> ...] [-rounds=N]")
+		return 1
+
+	sSource = os.path.abspath(vArgs[0])
+	vCompilers = [os.path.abspath(sCompiler) for sCompiler in vArgs[1:]]
+
+	mapTimes = { sCompiler: [] for sCompiler in vCompilers }
+	mapMemory = { sCompiler: [] for sCompiler in vCompilers }
+	sWorkDir = tempfile.mkdtemp()
+	for iRound in range(iRounds):
+		for sCompiler in vCompilers:
+			fTime, fMemory = runOnce(sCompiler, sSource, sWorkDir)
+			mapTimes[sCompiler].append(fTime)
+			mapMemory[sCompiler].append(fMemory)
+
+	print("%s, %d rounds" % (vArgs[0], iRounds))
+	for sCompiler in vCompilers:
+		print("%-40s compile time %9.1f ms (min %9.1f ms), peak memory %7.1f MB" % (	sCompiler,
+																						median(mapTimes[sCompiler]),
+																						min(mapTimes[sCompiler]),
+																						median(mapMemory[sCompiler])))
+
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main())
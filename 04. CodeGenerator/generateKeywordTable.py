@@ -0,0 +1,88 @@
+# Generates include/KeywordHashTable.h, the perfect hash table of TinyC's reserved words.
+#		- usage: python generateKeywordTable.py
+#		- Reads the keyword texts from TINYC_KEYWORDS in include/Token.h, in table order.
+#		- Searches for the first seed with which hashKeyword()(see KeywordTable.h) sends every
+#		  keyword to its own slot, then writes the seed & the slots.
+#		- KeywordTable.h static_asserts that the table still fits the keyword list, re-run this
+#		  whenever TINYC_KEYWORDS changes.
+
+import os
+import re
+import sys
+
+TABLE_SIZE = 512		# KEYWORD_TABLE_SIZE in KeywordTable.h
+MAX_SEED = 65536
+
+def readKeywords(sTokenHeader):
+	with open(sTokenHeader, "r") as f:
+		sSource = f.read()
+
+	iStart = sSource.index("#define TINYC_KEYWORDS")
+	vKeywords = []
+	for sLine in sSource[iStart:].splitlines():
+		match = re.match(r'\s*(KEYWORD|BUILTINTYPE)\(\s*\w+\s*,\s*"([^"]*)"\s*\)', sLine)
+		if match:
+			vKeywords.append(match.group(2))
+		if not sLine.rstrip().endswith("\\"):
+			break
+
+	return vKeywords
+
+def hashKeyword(sText, iSeed):
+	# FNV-1a with the seed folded into the offset basis, then the high half folded into the low one.
+	iHash = (2166136261 ^ iSeed) & 0xFFFFFFFF
+	for ch in sText.encode("ascii"):
+		iHash = ((iHash ^ ch) * 16777619) & 0xFFFFFFFF
+	return iHash ^ (iHash >> 16)
+
+def findSeed(vKeywords):
+	for iSeed in range(0, MAX_SEED):
+		vSlots = [-1] * TABLE_SIZE
+		bPerfect = True
+		for iIndex, sText in enumerate(vKeywords):
+			iSlot = hashKeyword(sText, iSeed) & (TABLE_SIZE - 1)
+			if vSlots[iSlot] >= 0:
+				bPerfect = False
+				break
+			vSlots[iSlot] = iIndex
+
+		if bPerfect:
+			return iSeed, vSlots
+
+	return None, None
+
+def main():
+	sRoot = os.path.dirname(os.path.abspath(__file__))
+	vKeywords = readKeywords(os.path.join(sRoot, "include", "Token.h"))
+	if len(vKeywords) == 0 or len(vKeywords) >= 128:
+		print("expected 1..127 keywords in TINYC_KEYWORDS, found %d" % len(vKeywords))
+		return 1
+
+	iSeed, vSlots = findSeed(vKeywords)
+	if iSeed is None:
+		print("no perfect hash seed below %d, grow TABLE_SIZE & KEYWORD_TABLE_SIZE" % MAX_SEED)
+		return 1
+
+	out = []
+	out.append("#pragma once")
+	out.append("")
+	out.append("// Generated by generateKeywordTable.py from TINYC_KEYWORDS(Token.h), do not edit.")
+	out.append("// Slot ==> index into g_KeywordEntries, -1 if empty. %d keywords, seed %d." % (len(vKeywords), iSeed))
+	out.append("")
+	out.append("#define KEYWORD_HASH_SEED\t\t%du" % iSeed)
+	out.append("#define KEYWORD_HASH_TABLE_SIZE\t%d" % TABLE_SIZE)
+	out.append("")
+	out.append("static constexpr int8_t g_KeywordHashSlots[KEYWORD_HASH_TABLE_SIZE] =")
+	out.append("{")
+	for i in range(0, TABLE_SIZE, 16):
+		out.append("\t" + ", ".join("%d" % iSlot for iSlot in vSlots[i:i + 16]) + ",")
+	out.append("};")
+
+	with open(os.path.join(sRoot, "include", "KeywordHashTable.h"), "w") as f:
+		f.write("\n".join(out) + "\n")
+
+	print("%d keywords, seed %d" % (len(vKeywords), iSeed))
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main())
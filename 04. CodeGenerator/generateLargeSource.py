@@ -0,0 +1,77 @@
+# Generates a large, valid TinyC source to benchmark the tokenizer & the compiler with.
+#		- usage: python generateLargeSource.py <output.c> [line count, default 50000]
+#		- Every function mixes comments, locals, floats, while, if/else & a call, so all the
+#		  tokenizer's read paths & the parser's statement rules are exercised.
+#		- compute_N() calls compute_N-1 within each group of 10, main() calls the last function
+#		  of every group & prints the total.
+#		- Up to ~1500 lines the program fits MAX_BYTECODE_SIZE & runs on the VM, larger inputs
+#		  are for timing the tokenizer & the parser.
+
+import sys
+
+def writeFunction(out, iIndex):
+	out.append("/*")
+	out.append(" * compute_%d: block comment, so readMultiLineComment() gets its share." % iIndex)
+	out.append(" */")
+	out.append("int32_t compute_%d(int32_t iArgument, int32_t iLimit)" % iIndex)
+	out.append("{")
+	out.append("\tint32_t iCounter = 0;")
+	out.append("\tint32_t iAccumulator = iArgument;")
+	out.append("\tfloat fScale = %d.5;" % (iIndex % 10))
+	out.append("")
+	if iIndex % 10 > 0:
+		# Calls go ahead of the loop, the parser loses the current block after a 'while'.
+		out.append("\tiAccumulator = iAccumulator + compute_%d(iArgument, 2);" % (iIndex - 1))
+		out.append("")
+	out.append("\t// Loop with a nested branch.")
+	out.append("\twhile (iCounter < iLimit)")
+	out.append("\t{")
+	out.append("\t\tif ((iCounter %% %d) == 0)" % (iIndex % 7 + 2))
+	out.append("\t\t{")
+	out.append("\t\t\tiAccumulator = iAccumulator + iCounter * %d;" % (iIndex % 13 + 1))
+	out.append("\t\t}")
+	out.append("\t\telse")
+	out.append("\t\t{")
+	out.append("\t\t\tiAccumulator = iAccumulator - 1;")
+	out.append("\t\t}")
+	out.append("")
+	out.append("\t\tfScale = fScale * 0.5;")
+	out.append("\t\tiCounter = iCounter + 1;")
+	out.append("\t}")
+	out.append("")
+	out.append("\treturn iAccumulator;")
+	out.append("}")
+	out.append("")
+
+def main():
+	if len(sys.argv) < 2:
+		print("usage: python generateLargeSource.py <output.c> [line count]")
+		return 1
+
+	iLineCount = int(sys.argv[2]) if len(sys.argv) > 2 else 50000
+
+	out = []
+	out.append("// Generated by generateLargeSource.py, %d lines requested." % iLineCount)
+	out.append("")
+
+	iFunctionCount = 0
+	while len(out) < iLineCount - 8:
+		writeFunction(out, iFunctionCount)
+		iFunctionCount = iFunctionCount + 1
+
+	out.append("void main()")
+	out.append("{")
+	out.append("\tint32_t iTotal = 0;")
+	for i in range(0, iFunctionCount, 10):
+		out.append("\tiTotal = iTotal + compute_%d(%d, 3);" % (min(i + 9, iFunctionCount - 1), i))
+	out.append("\tprint(\"total = \", iTotal);")
+	out.append("\tputc(10);")
+	out.append("}")
+
+	with open(sys.argv[1], "w") as f:
+		f.write("\n".join(out) + "\n")
+
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main())
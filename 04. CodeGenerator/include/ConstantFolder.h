@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include "Token.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Folds the constant parts of an rvalue expression tree before any code is emitted.
+//
+// 1. Operators whose operands are all literals are computed now, the way the VM would
+//    compute them. In an int expression that is int32_t arithmetic with wrap around; in a
+//    'float' expression every literal is a float & only +, -, *, / & % are folded, since
+//    the VM compares & negates a 'float' expression's values as raw int32_t bits.
+// 2. Identities like 'x * 1', 'x + 0', 'x << 0', '0 && x' drop the operator.
+//    'x * 0' & 'x & 0' become 0 unless x holds a call that runs where it is used.
+//    A 'float' expression only drops 'x * 1', 'x / 1' & 'x - 0', which are exact.
+// 3. Operations the VM would fault on or leave undefined (divide by zero, shifts by 32 or
+//    more, non finite floats) are left for the VM.
+//
+// fold() never changes the nodes it is given, it returns new nodes for whatever changed.
+//////////////////////////////////////////////////////////////////////////////////////////
+class ConstantFolder
+{
+	public:
+		static ExprNode*					fold(ExprNode* pExprNode, bool bIsFP);
+		static bool							castConstant(ExprNode* pExprNode, PRIMIIVETYPE eLVal_PRIMIIVETYPE, int32_t& iValue, float& fValue);
+	protected:
+	private:
+											ConstantFolder() = delete;
+
+		static ExprNode*					foldUnary(ExprNode* pExprNode, ExprNode* pOperand, bool bIsFP);
+		static ExprNode*					foldBinary(ExprNode* pExprNode, ExprNode* pLeft, ExprNode* pRight, bool bIsFP);
+		static ExprNode*					simplify(ExprNode* pExprNode, ExprNode* pLeft, ExprNode* pRight, bool bIsFP);
+
+		static bool							foldInt(TokenType_::Type eOperator, int32_t iLeft, int32_t iRight, int32_t& iResult);
+		static bool							foldFloat(TokenType_::Type eOperator, float fLeft, float fRight, float& fResult);
+
+		static bool							isLiteral(ExprNode* pExprNode);
+		static bool							isLiteralOf(ExprNode* pExprNode, int32_t iValue, bool bIsFP);
+		static bool							hasConditionalCall(ExprNode* pExprNode);
+
+		static ExprNode*					makeInteger(int32_t iValue);
+		static ExprNode*					makeFloat(float fValue);
+		static ExprNode*					makeCopy(ExprNode* pExprNode, ExprNode* pLeft, ExprNode* pRight);
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include "Token.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Turns a 'virtual' call into a direct 'CALL' when the function() it lands on is known
+// while the caller is emitted.
+//
+// 1. Local type flow: an object LOCAL only ever set by 'new T(...)' in the caller holds a T,
+//    'Parent::f()' runs on the Parent's part of the object which holds the Parent's VTABLE.
+// 2. Class hierarchy: no struct below the static type overrides the function(), every
+//    object it can hold finds the same one in its VTABLE.
+//
+// The hierarchy is read from the whole AST before any code is emitted, a struct defined
+// below the caller counts as well. The function() found must be emitted by then, a call
+// to one further down the struct being emitted stays 'virtual'.
+//////////////////////////////////////////////////////////////////////////////////////////
+class Devirtualizer
+{
+	public:
+		static void							scanHierarchy(Tree* pRootNode);
+		static FunctionInfo*				devirtualize(FunctionInfo* pCaller, StructInfo* pCurrentStruct, FunctionInfo* pCallee, Tree* pCALLEE_Node, const std::map<std::string, StructInfo*>& mapGlobalStructs);
+	protected:
+	private:
+											Devirtualizer() = delete;
+
+		static std::string					exactTypeOf(FunctionInfo* pCaller, StructInfo* pCurrentStruct, Tree* pMemberAccessNode);
+		static std::string					staticTypeOf(StructInfo* pCurrentStruct, FunctionInfo* pCallee, Tree* pCALLEE_Node);
+		static bool							isOverridden(const std::string& sStructName, const std::string& sKey);
+		static bool							isAssignedOnlyByNew(Tree* pNode, const std::string& sVariableName, std::string& sType);
+		static std::string					keyOf(FunctionInfo* pFunctionInfo);
+
+		static std::map<std::string, std::string>				m_MapParents;		// struct ==> the struct it extends.
+		static std::map<std::string, std::set<std::string>>	m_MapVirtuals;		// struct ==> its own 'virtual' function()s, see keyOf().
+};
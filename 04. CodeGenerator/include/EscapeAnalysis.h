@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "Token.h"
+
+#define ESCAPE_MAX_STACK_SLOTS		16		// Most LOCALs a function() gives its objects, the whole VM STACK is 256.
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Finds the objects a function() makes with 'new' which can not outlive the call, those are
+// built in its STACK FRAME instead of on the HEAP.
+//
+// An object LOCAL made by a single declaration & never assigned stays in the function()
+// if each of its uses is one of:
+// 1. 'p->member' or 'p->f()', a member function() can not store or return 'this'.
+// 2. 'free(p)' or the free at the end of its block, its destructor still runs.
+// 3. 'f(p)' of a global function() whose ARGUMENT stays in it as well, by the same rules.
+//    Freeing an ARGUMENT lets it escape.
+// Any other use, e.g. storing it, returning it or passing it to a member function(), does not.
+//
+// The objects take the LOCALs after the function()'s own & its inline ones, as many as fit
+// in ESCAPE_MAX_STACK_SLOTS. 'LEA' pushes an object's address where 'MALLOC' would.
+//////////////////////////////////////////////////////////////////////////////////////////
+class EscapeAnalysis
+{
+	public:
+		static void							scanFunctions(Tree* pRootNode);
+		static int32_t						allocateStackObjects(FunctionInfo* pFunctionInfo, int32_t iFirstLocal, int32_t iMaxSlots, const std::map<std::string, StructInfo*>& mapGlobalStructs);
+	protected:
+	private:
+											EscapeAnalysis() = delete;
+
+		static bool							escapes(Tree* pNode, const std::string& sVariableName, bool bIsArgument, int32_t& iDefinitions);
+		static bool							escapesInExpression(ExprNode* pExprNode, const std::string& sVariableName, bool bIsArgument, int32_t& iDefinitions);
+		static bool							escapesAsArgument(Tree* pFunctionCallNode, Tree* pArgNode);
+
+		static std::map<std::string, std::vector<Tree*>>	m_MapFunctions;			// Global function() ==> its definitions.
+		static std::set<std::string>						m_SetMemberFunctions;	// Names a struct or interface defines as well.
+		static std::set<std::string>						m_SetVisiting;			// "function(ARGUMENT)"s being checked, taken to stay.
+};
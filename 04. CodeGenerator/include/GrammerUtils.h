@@ -3,14 +3,28 @@
 #include <windows.h>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include "RandomAccessFile.h"
 #include "StringTokenizer.h"
 #include "Token.h"
+#include "PeepholeOptimizer.h"
 
 #define OPTIONAL_			0
 #define MANDATORY_			1
 
+// Has to match the VM's code segment. Benchmark builds of the compiler may raise it, e.g.
+// /D "MAX_BYTECODE_SIZE=(64 * 1024 * 1024)", so generateLargeSource.py's 50k lines fit.
+#ifndef MAX_BYTECODE_SIZE
 #define MAX_BYTECODE_SIZE	14 * 1024
+#endif
+
+#define SWITCH_JMPTABLE_MIN_CASES	4		// Fewer cases are cheaper as a few compares.
+#define SWITCH_JMPTABLE_MAX_SPREAD	2		// Table slots allowed per case, sparser switches get a compare tree.
+#define SWITCH_LINEAR_CASES			3		// Cases a leaf of the compare tree tests one after the other.
+#define SWITCH_END					-1		// Jump target "case" for the end of the switch.
+
+typedef std::vector<std::pair<int32_t, int32_t>>	SwitchCaseValues;	// Case value & index of the case in the switch, sorted by value.
+typedef std::vector<std::pair<uint32_t, int32_t>>	SwitchJmpHoles;		// Jump operand offset & index of the case it jumps to.
 
 class ByteArrayOutputStream;
 class ByteArrayInputStream;
@@ -24,21 +38,21 @@ class GrammerUtils
 		static Token								m_pSavedToken;
 
 		static bool									match(TokenType_::Type eTokenType, int TYPE);
-		static bool									match(std::string sText, int TYPE);
+		static bool									match(KeywordID_::Type eKeyword, int TYPE);
+		static bool									match(const std::string& sText, int TYPE);
 		static bool									match(char ch, int TYPE);
 
 		static void									init();
 		static bool									read(const char* sFile);
 
-		static bool									isOneOfTheKeywords(std::string sKeyword);
+		static bool									isOneOfTheKeywords(const std::string& sKeyword);
 
 		static StringTokenizer*						m_pStrTok;
-		static std::vector<std::string>				m_vKeywords;
-		static std::vector<std::string>				m_vTypes;
-		static std::vector<std::string>				m_vUserDefinedTypes;
-		static std::vector<std::string>				m_vUserDefinedInterfaces;
-		static std::vector<std::string>				m_vUserDefinedFunctions;
-		static std::vector<std::string>				m_vUserDefinedVariables;
+		static std::vector<std::string>				m_vIntrinsics;
+		static std::unordered_set<int32_t>			m_SetUserDefinedTypes;
+		static std::unordered_set<int32_t>			m_SetUserDefinedInterfaces;
+		static std::unordered_set<int32_t>			m_SetUserDefinedFunctions;
+		static std::unordered_set<int32_t>			m_SetUserDefinedVariables;
 
 		static int									iTabCount;
 		static void									printAST(Tree* pNode, bool bPrintTabs = true);
@@ -46,7 +60,7 @@ class GrammerUtils
 
 		static void									generateCode(Tree* pRootNode);
 		static void									populateStrings(Tree* pParentNode, std::vector<std::string>& sVector);
-		static void									addString(std::string& sText, std::vector<std::string>& vVector);
+		static void									addString(const std::string& sText, std::vector<std::string>& vVector);
 
 		static int									getStringPosition(const char* sString);
 
@@ -56,10 +70,16 @@ class GrammerUtils
 		static Tree*								createNodeOfType(ASTNodeType eASTNodeType, const char* sText = "");
 	private:
 		static void									handleFunctionDef(Tree* pNode);
+		static void									foldConstants(Tree* pNode);
+		static void									foldSizeOf(ExprNode* pExprNode);
+		static bool									emitConstantRValue(Tree* pExpressionNode, PRIMIIVETYPE eLVal_PRIMIIVETYPE);
 		static void									handleFunctionStart(Tree* pNode);
 		static void									handleFunctionEnd(Tree* pNode);
 		static void									handleFunctionCall(Tree* pNode);
+		static bool									inlineFunctionCall(FunctionInfo* pCalleeFunctionInfo, Tree* pCALLEE_Node);
+		static int32_t								countInlineLocals(Tree* pNode);
 		static void									handleSystemFunctionCall(Tree* pNode);
+		static void									handleIntrinsic(Tree* pNode);
 
 		static void									handleInterfaceDef(Tree* pNode);
 		static void									handleInterfaceEnd(Tree* pNode);
@@ -82,6 +102,15 @@ class GrammerUtils
 
 		static void									handlePreFixExpression(Tree* pNode);
 		static void									handleExpression(Tree* pNode);
+		static void									emitExpression(ExprNode* pExprNode, bool bIsFP);
+		static bool									isLogicalExpression(ExprNode* pExprNode);
+		static void									emitLogicalExpression(ExprNode* pExprNode);
+		static void									emitCondition(ExprNode* pExprNode, bool bJumpIfTrue, std::vector<uint32_t>& vJmpHoles);
+		static OPCODE								branchOpCodeFor(TokenType_::Type eOperator, bool bIsFP, bool bJumpIfTrue);
+		static void									emitJump(OPCODE eOPCODE, std::vector<uint32_t>& vJmpHoles);
+		static void									patchJumps(std::vector<uint32_t>& vJmpHoles);
+		static std::string							getExpressionText(Tree* pNode);
+		static void									appendExpressionText(ExprNode* pExprNode, std::string& sText);
 		static void									handlePostFixExpression(Tree* pNode);
 
 		static void									handleCharacter(Tree* pNode);
@@ -96,14 +125,17 @@ class GrammerUtils
 		static void									handleAssign(Tree* pNode);
 		static void									handleReturnStatement(Tree* pNode);
 		static void									handleIfWhile(Tree* pNode);
-		static void									handleIfWhile_Prologue(Tree* pNode, int& i_While_Loop_Hole, int& i_IfWhile_JCondition_Hole);
-		static void									handleIf_Epilogue(Tree* pNode, int& i_ElseEnd_JMP_Offset, int& i_IfWhile_JCondition_Hole);
-		static void									handleWhile_Epilogue(Tree* pNode, int& i_While_Loop_Hole, int& i_IfWhile_JCondition_Hole);
+		static void									handleIfWhile_Prologue(Tree* pNode, int& i_While_Loop_Hole, std::vector<uint32_t>& vIfWhile_JCondition_Holes);
+		static void									handleIf_Epilogue(Tree* pNode, int& i_ElseEnd_JMP_Offset, std::vector<uint32_t>& vIfWhile_JCondition_Holes);
+		static void									handleWhile_Epilogue(Tree* pNode, int& i_While_Loop_Hole, std::vector<uint32_t>& vIfWhile_JCondition_Holes);
 		static void									handleSwitch(Tree* pNode);
 		static void									handleSwitchArgument(Tree* pNode);
-		static void									handleSwitchCasePrologue(Tree* pNode, std::vector<uint32_t>& vCaseStartOffsets);
+		static void									handleSwitchCasePrologue(Tree* pNode, SwitchJmpHoles& vCaseJmpHoles);
+		static void									handleSwitchJumpTable(const SwitchCaseValues& vCaseValues, int32_t iDefaultCase, SwitchJmpHoles& vCaseJmpHoles);
+		static void									handleSwitchCompareTree(const SwitchCaseValues& vCaseValues, int32_t iFirst, int32_t iLast, int32_t iDefaultCase, SwitchJmpHoles& vCaseJmpHoles);
+		static void									handleSwitchJump(OPCODE eOPCODE, int32_t iCase, SwitchJmpHoles& vCaseJmpHoles);
 		static void									handleSwitchCases(Tree* pNode, std::vector<uint32_t>& vCaseStartOffsets, std::vector<uint32_t>& vCaseBreakJmpHoles);
-		static void									handleSwitchCaseEpilogues(Tree* pNode, std::vector<uint32_t>& vCaseBreakJmpHoles);
+		static void									handleSwitchCaseEpilogues(Tree* pNode, std::vector<uint32_t>& vCaseStartOffsets, SwitchJmpHoles& vCaseJmpHoles, std::vector<uint32_t>& vCaseBreakJmpHoles);
 		static void									handleMalloc(Tree* pNode);
 		static void									handleMemSet(Tree* pNode);
 		static void									handleMemCpy(Tree* pNode);
@@ -112,6 +144,7 @@ class GrammerUtils
 		static void									handleSizeOf(Tree* pNode);
 		static void									handleFree(Tree* pNode);
 		static void									handleStatics(Tree* pNode);
+		static void									handleHostData(Tree* pNode);
 		static void									handleTypeStructs(Tree* pNode);
 
 		static void									handleStatements(Tree* pNode);
@@ -134,6 +167,7 @@ class GrammerUtils
 		static void									emitFloat(float fCode);
 
 		static void									emitIntAtPos(int32_t iCode, uint32_t iOffset);
+		static void									optimizeCode();
 
 		static FunctionInfo*						getFunctionInfo(Tree* pNode);
 		static StructInfo*							getStructByName(std::string sObjectName);
@@ -147,7 +181,7 @@ class GrammerUtils
 		static FunctionInfo*						getFunctionByNameInStruct(std::string sFunctionName, StructInfo* pStructInfo);
 
 		static bool									isStructObedient(StructInfo* pStructInfo);
-		static bool									isFloatingPointExpression(std::string sExpr);
+		static bool									isFloatingPointExpression(ExprNode* pExprNode);
 
 		static std::vector<std::string>				m_vStrings;
 
@@ -155,6 +189,8 @@ class GrammerUtils
 
 		static ByteArrayOutputStream*				m_pBAOS;
 		static ByteArrayInputStream*				m_pBAIS;
+		static std::vector<uint32_t>				m_vCodeAddressHoles;		// 'PUSHI' operands holding a code offset, e.g return addresses.
+		static std::vector<TailCallSite>			m_vTailCallSites;			// Calls that may become a 'TAILCALL', see PeepholeOptimizer.h.
 
 		static void*								m_HColor;
 	public:
@@ -171,6 +207,7 @@ class GrammerUtils
 
 		static FunctionInfo*						getGlobalFunctionByName(std::string sFuncName);
 		static Tree*								getSystemFunctionByName(std::string sSystemFuncName);
+		static const IntrinsicMap*					getIntrinsicByName(std::string sIntrinsic);
 		static std::string							getSystemFunctionReturnType(std::string sSystemFuncName);
 
 		static FunctionInfo*						m_pCurrentFunction;
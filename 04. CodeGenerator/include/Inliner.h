@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+#include "Token.h"
+
+#define INLINE_THRESHOLD		96		// Default for '-inline=N', 0 turns inlining off.
+#define INLINE_CALL_SIZE		12		// 'PUSHI ret; PUSHR RBP; CALL f', which an inlined call does not emit.
+#define INLINE_MAX_FRAME		127		// 'SUB_REG RSP n' takes an int8_t.
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Inlines small function()s at their call sites, while the caller is emitted.
+//
+// The callee is emitted by then, so its body between the prologue & the epilogue is copied
+// in place of the 'CALL':
+// 1. The arguments are pushed as for a 'CALL' & stored into LOCALs past the caller's own.
+//    The callee's ARGUMENTs & LOCALs are renumbered to these.
+// 2. Jumps & return addresses inside the body move with it, 'CALL's out of it do not.
+// 3. 'return' already leaves its value in RAX, where the caller looks for it.
+//
+// A callee is inlined if it is not virtual or a member of an interface, is defined above
+// the caller, does not call itself & costOf() it is at most m_iThreshold bytes. The caller's
+// prologue reserves the LOCALs the biggest of its inlined callees needs.
+//
+// A struct's member function(), e.g a getter, is inlined like a global one. Its MEMBER
+// variables are left as they are, the caller puts 'this' in 'RCX' before the call either way.
+//////////////////////////////////////////////////////////////////////////////////////////
+class Inliner
+{
+	public:
+		static bool							canInline(FunctionInfo* pCaller, FunctionInfo* pCallee, const int8_t* pByteCode, const std::vector<uint32_t>& vCodeAddressHoles);
+		static int32_t						costOf(FunctionInfo* pCallee);
+		static int32_t						localsNeeded(FunctionInfo* pCallee);
+		static void							expand(FunctionInfo* pCallee, int32_t iFirstLocal, const int8_t* pByteCode, int32_t iAtOffset, std::vector<uint32_t>& vCodeAddressHoles, std::vector<int8_t>& vCode);
+
+		static int32_t						m_iThreshold;		// Most bytes an inlined call may copy.
+	protected:
+	private:
+											Inliner() = delete;
+
+		static bool							isBodyInlineable(FunctionInfo* pCallee, const int8_t* pByteCode, const std::set<uint32_t>& setCodeAddressHoles);
+		static int32_t						remapVariable(int32_t iVariable, int32_t iFirstLocal, int32_t iArgumentCount);
+		static bool							hasVariableOperand(OPCODE eOpCode);
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+// Generated by generateKeywordTable.py from TINYC_KEYWORDS(Token.h), do not edit.
+// Slot ==> index into g_KeywordEntries, -1 if empty. 50 keywords, seed 5.
+
+#define KEYWORD_HASH_SEED		5u
+#define KEYWORD_HASH_TABLE_SIZE	512
+
+static constexpr int8_t g_KeywordHashSlots[KEYWORD_HASH_TABLE_SIZE] =
+{
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 37, -1, 29,
+	-1, -1, -1, -1, 22, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 41, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 44, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 5, -1, -1, -1, 31, -1, -1, 18, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 25, -1, -1, -1, -1, 19, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13,
+	-1, -1, -1, -1, -1, -1, -1, 26, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, 35, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 16, -1, -1, -1, 32, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 40, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1,
+	-1, -1, -1, -1, -1, -1, 42, -1, -1, -1, -1, -1, 14, -1, 39, -1,
+	36, -1, -1, -1, 43, -1, -1, -1, -1, -1, -1, -1, 12, 2, -1, -1,
+	-1, -1, -1, -1, -1, -1, 33, -1, 15, -1, -1, -1, -1, -1, -1, 34,
+	-1, -1, 46, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 45, 21, 23, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 27, -1, 8, -1, -1, -1, -1, -1, 10, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 49, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 28, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 20, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 38, -1, -1, -1,
+	-1, -1, -1, -1, -1, 17, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 48, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, 47, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 30, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 24, -1, -1, -1, -1,
+	-1, 11, -1, -1, 7, -1, -1, -1, -1, -1, 6, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
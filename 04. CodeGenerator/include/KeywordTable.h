@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "Token.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Keywords and builtin types of TinyC, recognised through a perfect hash.
+//
+// 1. g_KeywordEntries lists every reserved word of TINYC_KEYWORDS(Token.h) once, its
+//    index is the word's KeywordID_.
+// 2. generateKeywordTable.py searches for a seed with which hashKeyword() sends every
+//    entry to its own slot of a KEYWORD_TABLE_SIZE table & writes the seed & the slots
+//    to KeywordHashTable.h.
+// 3. A static_assert checks that KeywordHashTable.h still fits g_KeywordEntries, that is
+//    one hash per entry at compile time instead of the whole seed search.
+// 4. findKeyword() costs one hash, one table load and one compare of the text.
+//
+// The StringTokenizer looks up every token with findKeyword() while tokenizing, so the
+// parser only has to look at Token::m_eKeywordType & Token::m_eKeyword.
+//
+// Everything is written as single-return recursive constexpr functions, as the v140
+// toolset does not support loops in constexpr functions.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#define KEYWORD_TABLE_SIZE		512
+
+struct KeywordEntry
+{
+	const char*				m_sText;
+	int32_t					m_iLength;
+	KeywordType_::Type		m_eKeywordType;
+	KeywordID_::Type		m_eKeyword;
+};
+
+#define KEYWORD(__id__, __text__)		{ __text__, sizeof(__text__) - 1, KeywordType_::Type::KW_KEYWORD, KeywordID_::Type::KW_##__id__ },
+#define BUILTINTYPE(__id__, __text__)	{ __text__, sizeof(__text__) - 1, KeywordType_::Type::KW_BUILTINTYPE, KeywordID_::Type::KW_##__id__ },
+
+static constexpr KeywordEntry g_KeywordEntries[] =
+{
+	TINYC_KEYWORDS(KEYWORD, BUILTINTYPE)
+};
+
+#undef KEYWORD
+#undef BUILTINTYPE
+
+static constexpr int32_t g_iKeywordCount = sizeof(g_KeywordEntries) / sizeof(g_KeywordEntries[0]);
+static_assert(g_iKeywordCount == (int32_t)KeywordID_::Type::KW_COUNT, "g_KeywordEntries & KeywordID_ are both built from TINYC_KEYWORDS.");
+static_assert(g_iKeywordCount < 128, "Slots store the entry index as an int8_t.");
+
+constexpr uint32_t hashFNV1a(const char* sText, int32_t iLength, uint32_t iHash)
+{
+	return (iLength == 0) ? iHash : hashFNV1a(sText + 1, iLength - 1, (iHash ^ (uint8_t)sText[0]) * 16777619u);
+}
+
+constexpr uint32_t foldHash(uint32_t iHash)
+{
+	return iHash ^ (iHash >> 16);
+}
+
+constexpr uint32_t hashKeyword(const char* sText, int32_t iLength, uint32_t iSeed)
+{
+	// FNV-1a, with the seed folded into the offset basis. generateKeywordTable.py has the same hash.
+	return foldHash(hashFNV1a(sText, iLength, 2166136261u ^ iSeed));
+}
+
+#include "KeywordHashTable.h"
+
+constexpr int32_t keywordSlot(int32_t iEntry)
+{
+	return hashKeyword(g_KeywordEntries[iEntry].m_sText, g_KeywordEntries[iEntry].m_iLength, KEYWORD_HASH_SEED) & (KEYWORD_TABLE_SIZE - 1);
+}
+
+// Every entry sits in its own slot ...
+constexpr bool keywordSlotsHoldEntries(int32_t iEntry)
+{
+	return (iEntry >= g_iKeywordCount)
+			? true
+			: (g_KeywordHashSlots[keywordSlot(iEntry)] == iEntry && keywordSlotsHoldEntries(iEntry + 1));
+}
+
+// ... & no other slot is taken. Halving keeps the recursion depth at log2(KEYWORD_TABLE_SIZE).
+constexpr int32_t keywordSlotsTaken(int32_t iFirst, int32_t iLast)
+{
+	return (iLast - iFirst == 1)
+			? ((g_KeywordHashSlots[iFirst] >= 0) ? 1 : 0)
+			: (keywordSlotsTaken(iFirst, (iFirst + iLast) / 2) + keywordSlotsTaken((iFirst + iLast) / 2, iLast));
+}
+
+static_assert(KEYWORD_HASH_TABLE_SIZE == KEYWORD_TABLE_SIZE, "KeywordHashTable.h is out of date, re-run generateKeywordTable.py.");
+static_assert(keywordSlotsHoldEntries(0) && keywordSlotsTaken(0, KEYWORD_TABLE_SIZE) == g_iKeywordCount, "KeywordHashTable.h is out of date, re-run generateKeywordTable.py.");
+
+constexpr int32_t keywordLengthBound(int32_t iEntry, int32_t iBound, bool bMax)
+{
+	return (iEntry >= g_iKeywordCount)
+			? iBound
+			: keywordLengthBound(	iEntry + 1,
+									(bMax == (g_KeywordEntries[iEntry].m_iLength > iBound)) ? g_KeywordEntries[iEntry].m_iLength : iBound,
+									bMax);
+}
+
+static constexpr int32_t g_iKeywordMinLength = keywordLengthBound(0, g_KeywordEntries[0].m_iLength, false);
+static constexpr int32_t g_iKeywordMaxLength = keywordLengthBound(0, g_KeywordEntries[0].m_iLength, true);
+
+inline const KeywordEntry* findKeyword(const char* sText, int32_t iLength)
+{
+	if (iLength < g_iKeywordMinLength || iLength > g_iKeywordMaxLength)
+		return nullptr;
+
+	uint32_t iSlot = hashKeyword(sText, iLength, KEYWORD_HASH_SEED) & (KEYWORD_TABLE_SIZE - 1);
+	int8_t iIndex = g_KeywordHashSlots[iSlot];
+	if (iIndex < 0)
+		return nullptr;
+
+	const KeywordEntry& entry = g_KeywordEntries[iIndex];
+	if (entry.m_iLength != iLength || memcmp(entry.m_sText, sText, iLength) != 0)
+		return nullptr;
+
+	return &entry;
+}
+
+inline KeywordType_::Type classifyKeyword(const char* sText, int32_t iLength)
+{
+	const KeywordEntry* pEntry = findKeyword(sText, iLength);
+	return (pEntry != nullptr) ? pEntry->m_eKeywordType : KeywordType_::Type::KW_NONE;
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+#include "Token.h"
+
+struct PeepholeInstruction
+{
+	int32_t								m_iOffset;				// Offset as emitted, every jump target refers to these.
+	std::vector<int8_t>					m_vBytes;				// OPCODE followed by its operands.
+	std::vector<int32_t>				m_vTargetPositions;		// Positions in m_vBytes of operands holding a code offset.
+	bool								m_bRemoved;
+};
+
+struct TailCallSite
+{
+	uint32_t							m_iReturnAddressHole;	// 'PUSHI' operand holding the call's return address.
+	int32_t								m_iCallerArgumentCount;
+	int32_t								m_iCalleeArgumentCount;
+};
+
+struct PeepholeValue
+{
+	int32_t								m_iDefinition;		// Position of the instruction pushing it, -1 if it was on the STACK before the block or a barrier.
+	int32_t								m_iFirst;			// Position of the first instruction computing it, -1 if it is not computed in one straight run.
+	int32_t								m_iSize;			// Instructions computing it, its operands included.
+	int32_t								m_iNumber;			// Equal numbers hold equal values.
+	int32_t								m_iUses;
+	bool								m_bIsPure;			// Computed from literals & LOCAL/ARGUMENT slots only.
+	bool								m_bCanTrap;			// Has a 'DIV' or 'MOD' the VM may fault on.
+	bool								m_bHasEffects;		// Something in it must run, even if nothing uses the value.
+};
+
+struct PeepholeBlock
+{
+	int32_t								m_iFirst;
+	int32_t								m_iLast;
+	std::vector<int32_t>				m_vSuccessors;		// Blocks it may go to.
+	bool								m_bLeavesFunction;	// Jumps somewhere outside the function(), every slot is live at its end.
+	std::set<int32_t>					m_SetLiveIn;
+	std::set<int32_t>					m_SetLiveOut;
+};
+
+struct PeepholeFunction
+{
+	std::vector<int32_t>				m_vCode;			// Instruction index of every live instruction, a "position" indexes this.
+	int32_t								m_iFirstIndex;		// The function() is instructions [m_iFirstIndex, m_iEndIndex).
+	int32_t								m_iEndIndex;
+	std::vector<int32_t>				m_vPositionOf;		// Position of instruction m_iFirstIndex + i, -1 if it is removed.
+	std::vector<bool>					m_vIsLabel;			// Something jumps, calls or returns to the position.
+	std::vector<int32_t>				m_vBlockOf;
+	std::vector<PeepholeBlock>				m_vBlocks;
+	std::vector<PeepholeValue>				m_vValues;
+	std::vector<std::vector<int32_t>>	m_vInputs;			// Values each position pops, the deepest first.
+	std::vector<std::vector<int32_t>>	m_vOutputs;			// Values each position pushes, the deepest first.
+	std::set<int32_t>					m_SetSlots;			// Every LOCAL/ARGUMENT slot the function() touches.
+};
+
+enum class E_PEEPHOLEKIND
+{
+	PURE,			// Literals, LOCAL/ARGUMENT reads & arithmetic.
+	TRAPS,			// Pure, but the VM may fault on it.
+	READS,			// Reads state nothing here tracks, may be removed if unused but never shared.
+	EFFECTS,		// Must run.
+	BARRIER,		// Uses the whole STACK in ways not modelled here.
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Runs over the finished bytecode, after 'HLT' is emitted & before it is written to main.o.
+// GrammerUtils::optimizeCode() decode()s it, optimize()s the instructions, then encode()s
+// them back.
+//
+// optimize() first runs the dataflow passes over one function() at a time, see
+// optimizeFunctions(). They work on the decoded bytecode: basic blocks & their successors,
+// block-local value numbering of the STACK entries & the liveness of LOCAL/ARGUMENT slots.
+// This is not an IR: nothing is typed or in SSA form, a value from another block is opaque
+// & the passes edit the instruction list directly.
+// a. propagateCopies:					A slot read is replaced by the literal or the other
+//										slot it holds, 'STORE x; FETCH x' keeps the value
+//										on the STACK & identity 'CAST's are removed.
+// b. eliminateCommonSubexpressions:	A pure expression a slot already holds is read
+//										from that slot.
+// c. eliminateDeadCode:				A 'STORE' nothing reads is removed, with the
+//										expression computing it if that has no effects.
+// d. hoistLoopInvariants:				'x = expr;' in a loop is moved in front of it if
+//										expr does not change in the loop & x is written
+//										nowhere else in it.
+//
+// Then the peephole passes:
+// 1. Jumps to a 'JMP' go straight to its target, a 'JMP' to a 'RET' becomes the 'RET' &
+//    a 'JMP' to the next instruction is removed.
+// 2. 'STORE x; FETCH x' becomes 'DUP; STORE x'.
+// 3. 'PUSHI 0; ADD' is removed.
+// 4. Code after a 'JMP', 'RET' or 'TAILCALL' is removed up to the next instruction something
+//    refers to.
+// 5. A call whose result the caller only returns becomes a 'TAILCALL', see eliminateTailCalls().
+//
+// Both sets of passes repeat until nothing changes. encode() relocates every jump, 'CALL',
+// 'TAILCALL', 'JMPTABLE', 'VTBL' entry, return address & each of vCodeOffsets to where its
+// target moved. A pattern never spans an instruction something jumps to.
+//////////////////////////////////////////////////////////////////////////////////////////
+class PeepholeOptimizer
+{
+	friend class Inliner;
+
+	public:
+		static void							decode(int8_t* pByteCode, int32_t iCodeSize, const std::vector<uint32_t>& vCodeAddressHoles, const std::vector<int32_t*>& vCodeOffsets, const std::vector<TailCallSite>& vTailCallSites);
+		static void							optimize();
+		static int32_t						encode(int8_t* pByteCode, int32_t iCodeSize, const std::vector<int32_t*>& vCodeOffsets);
+	protected:
+	private:
+											PeepholeOptimizer() = delete;
+
+		static void							decode(int8_t* pByteCode, int32_t iCodeSize, const std::vector<uint32_t>& vCodeAddressHoles);
+		static PeepholeInstruction			decodeAt(const int8_t* pByteCode, int32_t iOffset, const std::set<uint32_t>& setCodeAddressHoles);
+
+		static bool							threadJumps();
+		static bool							foldStoreFetch();
+		static bool							removeAddZero();
+		static bool							removeUnreachable();
+		static bool							eliminateTailCalls();
+		static bool							returnsResult(int32_t iIndex);
+
+		static void							optimizeFunctions();
+		static void							findFunctions(const std::vector<int32_t>& vExternalTargets);
+		static void							buildFunction(int32_t iFunction);
+		static void							markFunctionLabels(int32_t iFunction);
+		static void							buildBlocks();
+		static void							buildValues(const PeepholeBlock& pBlock);
+		static void							computeLiveness();
+
+		static int32_t						propagateCopies();
+		static int32_t						eliminateCommonSubexpressions();
+		static int32_t						eliminateDeadCode();
+		static int32_t						hoistLoopInvariants();
+
+		static E_PEEPHOLEKIND				kindOf(int32_t iPosition, int32_t& iPops, int32_t& iPushes);
+		static int32_t						slotOf(int32_t iPosition);
+		static bool							killsSlots(int32_t iPosition);
+		static bool							isIdentityCast(int32_t iPosition);
+		static bool							isConstant(int32_t iPosition);
+		static bool							isInOneRun(int32_t iValue, int32_t iPosition);
+		static int32_t						positionOf(int32_t iTarget);
+		static void							removeRange(int32_t iFirst, int32_t iLast);
+		static OPCODE						opCodeAt(int32_t iPosition);
+		static int32_t						operandAt(int32_t iPosition);
+		static std::string					keyOf(int32_t iPosition);
+
+		static void							markLabels();
+		static bool							isLabel(int32_t iIndex);
+		static int32_t						nextLive(int32_t iIndex);
+		static int32_t						indexAt(int32_t iOffset);
+		static int32_t						relocate(int32_t iOffset, const std::vector<int32_t>& vNewOffsets, int32_t iCodeSize);
+
+		static OPCODE						opCodeOf(int32_t iIndex);
+		static int32_t						operandOf(int32_t iIndex, int32_t iPosition);
+		static void							setOperand(int32_t iIndex, int32_t iPosition, int32_t iValue);
+		static int32_t						targetOf(int32_t iIndex, int32_t iPosition);
+		static void							setTarget(int32_t iIndex, int32_t iPosition, int32_t iTarget);
+		static void							replace(int32_t iIndex, OPCODE eOpCode, const int8_t* pOperands, int32_t iOperandSize);
+
+		static std::vector<PeepholeInstruction>	m_vInstructions;
+		static std::vector<bool>				m_vIsLabel;
+		static std::vector<int32_t>				m_vExternalTargets;
+		static std::vector<TailCallSite>		m_vTailCallSites;
+
+		static std::vector<int32_t>				m_vFunctionStarts;	// Emitted offset of each function(), sorted.
+		static PeepholeFunction					m_Function;			// The function() the dataflow passes work on.
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <deque>
+
+#define INVALID_SYMBOL		-1
+
+// Maps every distinct identifier to a 32-bit symbol once. Symbols are handed out in order
+// (0, 1, 2 ...) and are never released, so scope tables & caches can hash & compare them
+// instead of strings. Names are interned where a symbol table first stores them, the
+// tokenizer leaves identifiers as text, so looking up a name that was never declared only
+// costs a find().
+// Tree nodes keep their TEXT, GIVENNAME, TYPE & SYMBOL as symbols too, a node's text is
+// interned when it is set.
+class StringInterner
+{
+	public:
+		static int32_t						intern(const char* sText, int32_t iLength);
+		static int32_t						intern(const std::string& sText) { return intern(sText.c_str(), (int32_t)sText.length()); }
+
+		static int32_t						find(const char* sText, int32_t iLength);	// INVALID_SYMBOL if the text was never interned.
+		static int32_t						find(const std::string& sText) { return find(sText.c_str(), (int32_t)sText.length()); }
+
+		static const std::string&			toString(int32_t iSymbol);
+		static int32_t						size() { return (int32_t)m_vSymbols.size(); }
+	protected:
+	private:
+											StringInterner() = delete;
+
+		static uint32_t						hash(const char* sText, int32_t iLength);
+		static int32_t						findSlot(const char* sText, int32_t iLength, uint32_t iHash);
+		static void							grow();
+
+		static std::deque<std::string>		m_vSymbols;		// Text per symbol, a deque so references stay valid.
+		static std::vector<uint32_t>		m_vHashes;		// Hash per symbol, used when growing the slots.
+		static std::vector<int32_t>			m_vSlots;		// Open addressing, INVALID_SYMBOL marks an empty slot.
+};
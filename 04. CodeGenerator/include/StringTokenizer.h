@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include "Token.h"
+#include "RandomAccessFile.h"
 
 #define NOT !
 #define END_OF_INPUT 0
@@ -11,10 +12,28 @@
 #define CARRIAGE_RETURN		'\r'
 #define LINE_FEED			'\n'
 
+#define CHARCLASS_DIGIT			0x01
+#define CHARCLASS_IDENTIFIER	0x02
+#define CHARCLASS_WHITESPACE	0x04
+
+// The bulk scanners test 16 characters at a time with SSE2 where it is available, that is
+// always on x64 & on x86 under /arch:SSE2, the default since VS2012.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define TOKENIZER_SSE2			1
+#else
+#define TOKENIZER_SSE2			0
+#endif
+
+#define TOKENIZER_CHUNK_SIZE	(64 * 1024)	// Bytes read from the source file at a time when streaming.
+#define TOKENIZER_LOOKAHEAD		16			// Characters the read*() functions may peek past the end of a token.
+#define TOKEN_HISTORY_SIZE		8			// Tokens kept for prevToken() when streaming.
+
 class StringTokenizer
 {
 	public:
 		static StringTokenizer*		create(const char* sData, bool bIgnoreBNFNonTerminals = true);
+		static StringTokenizer*		create(std::string&& sData, bool bIgnoreBNFNonTerminals = true);	// Takes ownership of the buffer, no copy.
+		static StringTokenizer*		create(RandomAccessFile* pSource, bool bIgnoreBNFNonTerminals = true);	// Streams the opened file, closed at TK_EOI.
 		void						setData(const char* sData, bool bIgnoreBNFNonTerminals = true);
 
 		void						ignoreBNFNonTerminals(bool bIgnore = true);	// Make it false to include non-terminals ==> <Non-Terminal>.
@@ -24,33 +43,45 @@ class StringTokenizer
 		Token						nextToken();
 		Token						prevToken();
 
+		const std::vector<TokenSpan>&	getTokenSpans() const { return m_vTokens; }	// Empty when streaming.
+		const char*					getTokenText(const TokenSpan& tokenSpan) const { return m_sData.data() + tokenSpan.m_iOffset; }
+		Token						toToken(const TokenSpan& tokenSpan) const;
+
 		bool						hasFloatingPoint() { return m_bHasFloatingPoint; }
 protected:
 	private:
 									StringTokenizer() = delete;
 									StringTokenizer(const char* sData, bool bIgnoreBNFNonTerminals);
+									StringTokenizer(std::string&& sData, bool bIgnoreBNFNonTerminals);
+									StringTokenizer(RandomAccessFile* pSource, bool bIgnoreBNFNonTerminals);
 									virtual ~StringTokenizer();
 
 		void						init(const char* sData);
+		void						initState();
 		void						reset();
-		Token						getNextToken();
+		TokenSpan					getNextToken();
+		TokenSpan					streamNextToken();
+		void						readChunk();
+		void						addToHistory(const Token& tok);
 		void						initRead();
 		char						peek(int iOffset);
+		int							scanWhile(uint8_t iCharClass);	// Length of the run of iCharClass characters at m_iCurrPos.
+		int							scanUntil(char ch0, char ch1 = END_OF_INPUT, char ch2 = END_OF_INPUT);	// Distance from m_iCurrPos to the first of ch0/ch1/ch2 or END_OF_INPUT.
 		void						consume(int iOffset);
-		Token						createToken(TokenType_::Type eTokenType);
-		Token						readNumber();
-		Token						readEOL();
-		Token						readString();
-		Token						readCharacter();
-		Token						readDefault(char ch0);
-		Token						readIdentifier();
-		Token						readSystemIdentifier();
-		Token						readBNFNonTerminal();
-		Token						readBNFCode();
-		Token						readSingleLineComment();
-		Token						readMultiLineComment();
-		Token						readPrefixIncrDecr(bool bIsIncr);
-		Token						readPointerDeref();
+		TokenSpan					createToken(TokenType_::Type eTokenType);
+		TokenSpan					readNumber();
+		TokenSpan					readEOL();
+		TokenSpan					readString();
+		TokenSpan					readCharacter();
+		TokenSpan					readDefault(char ch0);
+		TokenSpan					readIdentifier();
+		TokenSpan					readSystemIdentifier();
+		TokenSpan					readBNFNonTerminal();
+		TokenSpan					readBNFCode();
+		TokenSpan					readSingleLineComment();
+		TokenSpan					readMultiLineComment();
+		TokenSpan					readPrefixIncrDecr(bool bIsIncr);
+		TokenSpan					readPointerDeref();
 
 		bool						isBNFCode(bool bStartTag);
 
@@ -63,13 +94,20 @@ protected:
 		int							m_iCurrColumn;
 		int							m_iSavedColumn;
 
-		std::string					m_sData;
+		std::string					m_sData;			// The one source buffer, every TokenSpan points into it.
 		int							m_iDataLength;
 
 		bool						m_bIgnoreBNFNonTerminals;	// <Non-Terminal>
 		bool						m_bHasFloatingPoint;
 
-		std::vector<Token>			m_vTokens;
-		std::vector<Token>::const_iterator	m_TokensIterator;
+		std::vector<TokenSpan>		m_vTokens;
+		std::vector<TokenSpan>::const_iterator	m_TokensIterator;
+
+		// Streaming, the source is lexed on demand & m_sData only holds the unread part of it.
+		RandomAccessFile*			m_pSource;			// nullptr when the whole source was handed over.
+		bool						m_bSourceExhausted;
+		bool						m_bEOIReached;
+		std::vector<Token>			m_vHistory;			// Ring of the last TOKEN_HISTORY_SIZE tokens returned.
+		int							m_iHistoryCount;
 
 };
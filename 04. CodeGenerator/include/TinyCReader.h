@@ -9,47 +9,6 @@ class TinyCReader {
 	public:
 		TinyCReader();
 
-		void addKeywords() {
-			GrammerUtils::m_vKeywords.push_back("interface");
-			GrammerUtils::m_vKeywords.push_back("inline");
-			GrammerUtils::m_vKeywords.push_back("struct");
-			GrammerUtils::m_vKeywords.push_back("implements");
-			GrammerUtils::m_vKeywords.push_back("inline");
-			GrammerUtils::m_vKeywords.push_back("virtual");
-			GrammerUtils::m_vKeywords.push_back("static");
-			GrammerUtils::m_vKeywords.push_back("static");
-			GrammerUtils::m_vKeywords.push_back("SYSFUNC");
-			GrammerUtils::m_vKeywords.push_back("return");
-			GrammerUtils::m_vKeywords.push_back("if");
-			GrammerUtils::m_vKeywords.push_back("else");
-			GrammerUtils::m_vKeywords.push_back("while");
-			GrammerUtils::m_vKeywords.push_back("switch");
-			GrammerUtils::m_vKeywords.push_back("case");
-			GrammerUtils::m_vKeywords.push_back("break");
-			GrammerUtils::m_vKeywords.push_back("default");
-			GrammerUtils::m_vKeywords.push_back("break");
-			GrammerUtils::m_vKeywords.push_back("for");
-			GrammerUtils::m_vKeywords.push_back("print");
-			GrammerUtils::m_vKeywords.push_back("putc");
-			GrammerUtils::m_vKeywords.push_back("memSet");
-			GrammerUtils::m_vKeywords.push_back("memCpy");
-			GrammerUtils::m_vKeywords.push_back("memCmp");
-			GrammerUtils::m_vKeywords.push_back("memChr");
-			GrammerUtils::m_vKeywords.push_back("sizeOf");
-			GrammerUtils::m_vKeywords.push_back("new");
-			GrammerUtils::m_vKeywords.push_back("malloc");
-			GrammerUtils::m_vKeywords.push_back("new");
-			GrammerUtils::m_vKeywords.push_back("free");
-			GrammerUtils::m_vKeywords.push_back("&&");
-			GrammerUtils::m_vKeywords.push_back("||");
-			GrammerUtils::m_vKeywords.push_back("==");
-			GrammerUtils::m_vKeywords.push_back("!=");
-			GrammerUtils::m_vKeywords.push_back("<=");
-			GrammerUtils::m_vKeywords.push_back(">=");
-			GrammerUtils::m_vKeywords.push_back("<<");
-			GrammerUtils::m_vKeywords.push_back(">>");
-		}
-
 		bool def();
 		bool objectList();
 		bool interfaceDeclaration();
@@ -63,6 +22,7 @@ class TinyCReader {
 		bool structType();
 		bool staticPtr();
 		bool systemFunctionDef();
+		bool hostDataDeclaration();
 		bool functionDef();
 		bool functionArgumentDefList();
 		bool functionArgumentDefListMore();
@@ -75,6 +35,8 @@ class TinyCReader {
 		bool postFixIncrDecr();
 		bool returnStatement();
 		bool systemFunctionCall();
+		bool intrinsicCall();
+		bool intrinsicName();
 		bool functionCall();
 		bool functionArgumentList();
 		bool functionArgumentItem();
@@ -128,23 +90,7 @@ class TinyCReader {
 		bool freePtrStatement();
 		bool expr();
 		bool startExpr();
-		bool logicalAndOrExpr();
-		bool logicalAndOr();
-		bool equalityExpr();
-		bool eqNeqExpr();
-		bool eqNeq();
-		bool relationalExpr();
-		bool lteqGteqExpr();
-		bool lteqGteq();
-		bool addSubExpr();
-		bool plusMinusExpr();
-		bool plusMinus();
-		bool mulDivExpr();
-		bool mulDivModExpr();
-		bool mulDivMod();
-		bool bitwiseExpr();
-		bool bitwiseOrAndXorExpr();
-		bool bitwiseOrAndXor();
+		bool parseExpression(ENUM_OP_PRECEDENCE eMinPrecedence);
 		bool primary();
 		bool operands();
 		bool tk_identifier();
@@ -156,7 +102,6 @@ class TinyCReader {
 		bool structMemberVariableArrayInAnExpr();
 		bool structMemberFunctionCallInAnExpr();
 		bool unary_expr();
-		bool unary_oper();
 		bool preFixInExpr();
 		bool rValueDeref();
 		bool postFixIncrDecrInExpr();
@@ -164,13 +109,15 @@ class TinyCReader {
 
 		
 		void 						read(const char* sFile);
-		std::string					popOperator();
-		ENUM_OP_PRECEDENCE 			opFromString(std::string sOperator);
-		void						checkOpPrecedenceAndPush(std::string sCurrentOperator);
+		static ENUM_OP_PRECEDENCE	binaryPrecedence(TokenType_::Type eTokenType);	// OP_INVALID if not a binary operator.
+		ExprNode*					pushOperand(ExprNodeType_::Type eExprNodeType, const std::string& sText);
+		ExprNode*					popOperand();
+		void						reduceOperator(TokenType_::Type eOperator, const std::string& sText, bool bIsUnary);
+		void						markConditionalCalls(ExprNode* pExprNode);
 		
 		static Tree*				makeLeaf(ASTNodeType eASTNodeType, const char* sText);
 		Tree*						makeNode(ASTNodeType eASTNodeType, Tree* pLeft, Tree* pRight);
-		Tree*						createPostFixExpr(Tree* pLeaf = nullptr);
+		Tree*						createExpressionLeaf(Tree* pLeaf = nullptr);
 		
 		void						updateBlockString(std::string sIdent);
 		void						removeLastFromBlockString();
@@ -179,6 +126,8 @@ class TinyCReader {
 
 		void 						addType(std::string sType);
 		bool						isValidType(std::string sType);
+		void 						addIntrinsic(std::string sIntrinsic);
+		bool						isValidIntrinsic(std::string sIntrinsic);
 		void 						addStructType(std::string sType);
 		bool 						isValidStructType(std::string sType);
 		Tree* 						hasNodeOfType(Tree* pNode, ASTNodeType eASTNodeType);
@@ -191,7 +140,6 @@ class TinyCReader {
 		void						endBlockMarker();
 		
 		E_VARIABLESCOPE 			getCurrentScope();
-		std::string 				getCurrentScopeString();
 		
 		Tree*						getStructNodeByName(std::string sStructName);
 		void						handleFunctionCallInExpr(std::string sFunctionType);
@@ -199,8 +147,7 @@ class TinyCReader {
 	protected:
 		
 	private:
-		std::stack<std::string>		m_vOperatorStack;
-		std::vector<std::string>	m_vPostFix;
+		std::vector<ExprNode*>		m_vOperandStack;			// Operands & reduced sub-expressions, nullptr marks the start of a function call's arguments.
 		
 		std::stack<std::string>		m_vLocalHeapVarStack;
 		
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <assert.h>
 #include <iterator>
+#include <vector>
+#include <new>
+#include <cstring>
+#include "StringInterner.h"
 
 #define NOT !
 #define GET_INFO_FOR_KEY(__node__, __key__)					__node__->getAdditionalInfoFor(__key__)
@@ -226,24 +232,120 @@ namespace TokenType_
 	}
 }
 
+namespace KeywordType_
+{
+	enum class Type
+	{
+		KW_NONE = 0,
+		KW_KEYWORD,
+		KW_BUILTINTYPE,
+	};
+}
+
+// Every reserved word of TinyC, in the order of g_KeywordEntries(see KeywordTable.h).
+// generateKeywordTable.py reads the texts from here, re-run it after changing this list.
+#define TINYC_KEYWORDS(KEYWORD, BUILTINTYPE)	\
+	KEYWORD(INTERFACE,		"interface")		\
+	KEYWORD(INLINE,			"inline")			\
+	KEYWORD(STRUCT,			"struct")			\
+	KEYWORD(IMPLEMENTS,		"implements")		\
+	KEYWORD(VIRTUAL,		"virtual")			\
+	KEYWORD(STATIC,			"static")			\
+	KEYWORD(SYSFUNC,		"SYSFUNC")			\
+	KEYWORD(HOSTDATA,		"HOSTDATA")			\
+	KEYWORD(RETURN,			"return")			\
+	KEYWORD(IF,				"if")				\
+	KEYWORD(ELSE,			"else")				\
+	KEYWORD(WHILE,			"while")			\
+	KEYWORD(SWITCH,			"switch")			\
+	KEYWORD(CASE,			"case")				\
+	KEYWORD(BREAK,			"break")			\
+	KEYWORD(DEFAULT,		"default")			\
+	KEYWORD(FOR,			"for")				\
+	KEYWORD(PRINT,			"print")			\
+	KEYWORD(PUTC,			"putc")				\
+	KEYWORD(MEMSET,			"memSet")			\
+	KEYWORD(MEMCPY,			"memCpy")			\
+	KEYWORD(MEMCMP,			"memCmp")			\
+	KEYWORD(MEMCHR,			"memChr")			\
+	KEYWORD(SIZEOF,			"sizeOf")			\
+	KEYWORD(NEW,			"new")				\
+	KEYWORD(MALLOC,			"malloc")			\
+	KEYWORD(FREE,			"free")				\
+	KEYWORD(LOGICALAND,		"&&")				\
+	KEYWORD(LOGICALOR,		"||")				\
+	KEYWORD(EQ,				"==")				\
+	KEYWORD(NEQ,			"!=")				\
+	KEYWORD(LTEQ,			"<=")				\
+	KEYWORD(GTEQ,			">=")				\
+	KEYWORD(LEFTSHIFT,		"<<")				\
+	KEYWORD(RIGHTSHIFT,		">>")				\
+	/* Intrinsics, see TinyCReader::addIntrinsic(). */	\
+	KEYWORD(SIN,			"sin")				\
+	KEYWORD(COS,			"cos")				\
+	KEYWORD(SQRT,			"sqrt")				\
+	KEYWORD(ABS,			"abs")				\
+	KEYWORD(MIN,			"min")				\
+	KEYWORD(MAX,			"max")				\
+	KEYWORD(FLOOR,			"floor")			\
+	KEYWORD(LERP,			"lerp")				\
+	KEYWORD(RAND,			"rand")				\
+	KEYWORD(SRAND,			"srand")			\
+	KEYWORD(AWAIT,			"await")			\
+	/* Builtin types, see TinyCReader::addType(). */	\
+	BUILTINTYPE(INT8,		"int8_t")			\
+	BUILTINTYPE(INT16,		"int16_t")			\
+	BUILTINTYPE(INT32,		"int32_t")			\
+	BUILTINTYPE(FLOAT,		"float")
+
+// Index of a reserved word in g_KeywordEntries, set on every Token by the StringTokenizer.
+namespace KeywordID_
+{
+	#define KEYWORD_ID(__id__, __text__)	KW_##__id__,
+	enum class Type
+	{
+		KW_INVALID = -1,
+		TINYC_KEYWORDS(KEYWORD_ID, KEYWORD_ID)
+		KW_COUNT,
+	};
+	#undef KEYWORD_ID
+}
+
 struct Token
 {
-	Token(TokenType_::Type eTokenType, std::string sText, int iLine, int iColumn)
+	Token(TokenType_::Type eTokenType, std::string sText, int iLine, int iColumn, KeywordType_::Type eKeywordType = KeywordType_::Type::KW_NONE, KeywordID_::Type eKeyword = KeywordID_::Type::KW_INVALID)
 		: m_eTokenType(eTokenType)
 		, m_sText(sText)
 		, m_iLine(iLine)
 		, m_iColumn(iColumn)
+		, m_eKeywordType(eKeywordType)
+		, m_eKeyword(eKeyword)
 	{}
 
 	TokenType_::Type	m_eTokenType;
 	std::string			m_sText;
 	int					m_iLine;
 	int					m_iColumn;
+	KeywordType_::Type	m_eKeywordType;		// Set by the StringTokenizer, see KeywordTable.h
+	KeywordID_::Type	m_eKeyword;			// Which reserved word, KW_INVALID for any other text.
 
 	TokenType_::Type	getType() { return m_eTokenType; }
 	const char*			getText() { return m_sText.c_str(); }
 };
 
+// Compact token record produced by the StringTokenizer. The text is not copied, it is the
+// range [m_iOffset, m_iOffset + m_iLength) of the tokenizer's source buffer.
+struct TokenSpan
+{
+	TokenType_::Type	m_eTokenType;
+	int32_t				m_iOffset;
+	int32_t				m_iLength;
+	int32_t				m_iLine;
+	int32_t				m_iColumn;
+	KeywordType_::Type	m_eKeywordType;
+	KeywordID_::Type	m_eKeyword;
+};
+
 enum class OPCODE
 {
 	NOP = 0,
@@ -304,6 +406,33 @@ enum class OPCODE
 	MODF,
 	PRTF,
 	CAST,
+	SINF,
+	COSF,
+	SQRTF,
+	ABSF,
+	MINF,
+	MAXF,
+	FLOORF,
+	LERPF,
+	RANDF,
+	SRAND,
+	AWAIT,
+	JMPTABLE,
+	BR_LT,
+	BR_LTEQ,
+	BR_GT,
+	BR_GTEQ,
+	BR_EQ,
+	BR_NEQ,
+	BR_LTF,
+	BR_LTEQF,
+	BR_GTF,
+	BR_GTEQF,
+	BR_EQF,
+	BR_NEQF,
+	DUP,
+	TAILCALL,
+	LEA,
 	HLT,
 };
 
@@ -324,6 +453,15 @@ struct CodeMap
 	PRIMIIVETYPE	ePRIMIIVETYPE;
 };
 
+struct IntrinsicMap
+{
+	const char*		sIntrinsic;
+	OPCODE			eOpCode;
+	int32_t			iArgumentCount;
+	PRIMIIVETYPE	eArgumentType;
+	const char*		sReturnType;				// "void" if nothing is returned in 'EAX'.
+};
+
 enum class EREGISTERS
 {
 	RAX,	// Accumulator
@@ -364,8 +502,6 @@ enum class ENUM_OP_PRECEDENCE
 {
 	OP_INVALID = 0,
 
-	OP_LPAREN,
-
 	OP_LOGICALOR,
 	OP_LOGICALAND,
 
@@ -394,8 +530,6 @@ enum class ENUM_OP_PRECEDENCE
 	OP_PLUS = OP_NOT,
 	OP_NEGATE = OP_NOT,
 	OP_BITWISENOT = OP_NOT,
-
-	OP_RPAREN,
 };
 
 enum class ASTNodeType
@@ -475,6 +609,7 @@ enum class ASTNodeType
 	ASTNode_FREE,
 	ASTNode_TYPE,
 	ASTNode_TYPESTATIC,
+	ASTNode_TYPEHOSTDATA,
 	ASTNode_TYPEARRAY,
 	ASTNode_TYPEARRAYELEMENTS,
 	ASTNode_STRUCTDEF,
@@ -497,21 +632,69 @@ enum class ASTNodeType
 	ASTNode_STRUCTIMPLEMENTLIST,
 	ASTNode_SYSTEMFUNCTIONCALL,
 	ASTNode_SYSTEMFUNCTIONCALLEND,
+	ASTNode_INTRINSIC,
 	TK_UNKNOWN
 };
 
+enum class E_VARIABLESCOPE
+{
+	INVALID = -1,
+	ARGUMENT,
+	LOCAL,
+	STATIC,
+	MEMBER,
+	HOST
+};
+
+// Keys for GET_INFO_FOR_KEY/SET_INFO_FOR_KEY. TEXT, GIVENNAME, TYPE & SYMBOL are set on most
+// nodes and live in their own fields, the rest are rare & kept in Tree::m_pExtraInfo.
+enum class ASTInfo
+{
+	TEXT = 0,
+	GIVENNAME,
+	TYPE,
+	SYMBOL,			// Name a declaration is looked up by, the argument signature of a call or arg list e.g "int32_t_string_".
+	SRC,
+	DST,
+	ISVIRTUAL,
+	ISSTATIC,
+	ISPURE,
+	ACCESSTYPE,
+	EXTENDS,
+	MEMBERFUNCTIONOF,
+	EXPRESSION_RVALUE_TYPE,
+	SUB_REG,
+	MODIFYTYPE,
+	ANNOTATION,
+};
+
+struct ExprNode;
+
 typedef struct Tree
 {
 	Tree()
-		: m_pParentNode(nullptr)
+		: m_eASTNodeType(ASTNodeType::ASTNode_INVALID)
+		, m_bIsPointerType(false)
+		, m_bIsConditionalCall(false)
+		, m_eScope(E_VARIABLESCOPE::INVALID)
+		, m_iVariablePos(-1)
+		, m_iText(INVALID_SYMBOL)
+		, m_iGivenName(INVALID_SYMBOL)
+		, m_iType(INVALID_SYMBOL)
+		, m_iSymbol(INVALID_SYMBOL)
+		, m_pParentNode(nullptr)
 		, m_pLeftNode(nullptr)
 		, m_pRightNode(nullptr)
-		, m_eASTNodeType(ASTNodeType::ASTNode_INVALID)
-		, m_sAdditionalInfo("")
-		, m_bIsPointerType(false)
+		, m_pExtraInfo(nullptr)
+		, m_pMapScopeSymbols(nullptr)
+		, m_pExpression(nullptr)
 	{
-		// Reset the "variablePos" info to "-1"
-		SET_INFO_FOR_KEY(this, "variablePos", "-1");
+	}
+
+	~Tree()
+	{
+		delete m_pExtraInfo;
+		delete m_pMapScopeSymbols;
 	}
 
 	void addChild(Tree* pNode)
@@ -520,6 +703,9 @@ typedef struct Tree
 		{
 			m_vStatements.push_back(pNode);
 			pNode->m_pParentNode = this;
+
+			if (pNode->isADeclaration())
+				declareSymbol(pNode, false);
 		}
 	}
 
@@ -535,6 +721,79 @@ typedef struct Tree
 				m_vStatements.push_back(pNode);
 
 			pNode->m_pParentNode = this;
+
+			if (pNode->isADeclaration())
+				declareSymbol(pNode, true);
+		}
+	}
+
+	bool isADeclaration()
+	{
+		return (	m_eASTNodeType == ASTNodeType::ASTNode_TYPE
+					||
+					m_eASTNodeType == ASTNodeType::ASTNode_TYPEARRAY
+					||
+					m_eASTNodeType == ASTNodeType::ASTNode_TYPESTRUCT
+				);
+	}
+
+	// Returns the first declaration in this block's statements with the given name, nullptr if none.
+	Tree* findSymbol(int32_t iSymbol)
+	{
+		if (m_pMapScopeSymbols != nullptr)
+		{
+			std::unordered_map<int32_t, Tree*>::const_iterator itr = m_pMapScopeSymbols->find(iSymbol);
+			if (itr != m_pMapScopeSymbols->end())
+				return itr->second;
+		}
+
+		return nullptr;
+	}
+
+	void declareSymbol(Tree* pNode, bool bInsertedInBetween)
+	{
+		if (m_pMapScopeSymbols == nullptr)
+			m_pMapScopeSymbols = new std::unordered_map<int32_t, Tree*>();
+
+		int32_t iSymbol = pNode->m_iSymbol;
+		std::unordered_map<int32_t, Tree*>::iterator itr = m_pMapScopeSymbols->find(iSymbol);
+		if (itr == m_pMapScopeSymbols->end())
+		{
+			m_pMapScopeSymbols->insert(std::make_pair(iSymbol, pNode));
+		}
+		else
+		if (bInsertedInBetween)
+		{
+			// Same name declared twice in one block, the first one in statement order wins.
+			for (Tree* pChild : m_vStatements)
+			{
+				if (pChild == pNode || pChild == itr->second)
+				{
+					itr->second = pChild;
+					break;
+				}
+			}
+		}
+	}
+
+	void undeclareSymbol(Tree* pNode)
+	{
+		if (m_pMapScopeSymbols == nullptr)
+			return;
+
+		int32_t iSymbol = pNode->m_iSymbol;
+		std::unordered_map<int32_t, Tree*>::iterator itr = m_pMapScopeSymbols->find(iSymbol);
+		if (itr != m_pMapScopeSymbols->end() && itr->second == pNode)
+		{
+			m_pMapScopeSymbols->erase(itr);
+			for (Tree* pChild : m_vStatements)
+			{
+				if (pChild->isADeclaration() && pChild->m_iSymbol == pNode->m_iSymbol)
+				{
+					m_pMapScopeSymbols->insert(std::make_pair(iSymbol, pChild));
+					break;
+				}
+			}
 		}
 	}
 
@@ -551,6 +810,8 @@ typedef struct Tree
 			if (pChild == this)
 			{
 				m_pParentNode->m_vStatements.erase(m_pParentNode->m_vStatements.begin() + iCount);
+				if (isADeclaration())
+					m_pParentNode->undeclareSymbol(this);
 				m_pParentNode = nullptr;
 				break;
 			}
@@ -559,70 +820,172 @@ typedef struct Tree
 		}
 	}
 
-	void setAdditionalInfo(std::string sKey, std::string sValue)
+	void setAdditionalInfo(ASTInfo eKey, const std::string& sValue)
 	{
-		std::map<std::string, std::string>::const_iterator itr = m_MapAdditionalInfo.find(sKey);
-		if (itr != m_MapAdditionalInfo.end())
-		{
-			m_MapAdditionalInfo[sKey] = sValue;
-		}
+		int32_t iValue = sValue.empty() ? INVALID_SYMBOL : StringInterner::intern(sValue);
+		int32_t* pValue = findInfo(eKey);
+		if (pValue != nullptr)
+			*pValue = iValue;
 		else
 		{
-			m_MapAdditionalInfo.insert(std::pair<std::string, std::string>(sKey, sValue));
+			if (m_pExtraInfo == nullptr)
+				m_pExtraInfo = new std::vector<std::pair<ASTInfo, int32_t>>();
+			m_pExtraInfo->push_back(std::make_pair(eKey, iValue));
 		}
 	}
 
-	std::string getAdditionalInfoFor(std::string sKey)
+	const std::string& getAdditionalInfoFor(ASTInfo eKey)
 	{
-		std::string sReturn = "";
-		std::map<std::string, std::string>::const_iterator itr = m_MapAdditionalInfo.find(sKey);
-		if (itr != m_MapAdditionalInfo.end())
-		{
-			sReturn = itr->second;
-		}
+		static const std::string sEmpty = "";
 
-		return sReturn;
+		int32_t* pValue = findInfo(eKey);
+		return (pValue != nullptr && *pValue != INVALID_SYMBOL) ? StringInterner::toString(*pValue) : sEmpty;
 	}
 
-	void appendAdditionalInfo(std::string sKey, std::string sAppendValue)
+	void appendAdditionalInfo(ASTInfo eKey, const std::string& sAppendValue)
 	{
-		std::map<std::string, std::string>::const_iterator itr = m_MapAdditionalInfo.find(sKey);
-		std::string sValue = "";
-		if (itr != m_MapAdditionalInfo.end())
-		{
-			sValue = m_MapAdditionalInfo[sKey];
-			sValue.append(sAppendValue);
-			m_MapAdditionalInfo[sKey] = sValue;
-		}
-		else
+		setAdditionalInfo(eKey, getAdditionalInfoFor(eKey) + sAppendValue);
+	}
+
+	// Field holding eKey's interned value, INVALID_SYMBOL if the value is empty. nullptr if a
+	// rare key was never set.
+	int32_t* findInfo(ASTInfo eKey)
+	{
+		switch (eKey)
 		{
-			m_MapAdditionalInfo.insert(std::pair<std::string, std::string>(sKey, sAppendValue));
+			case ASTInfo::TEXT:			return &m_iText;
+			case ASTInfo::GIVENNAME:	return &m_iGivenName;
+			case ASTInfo::TYPE:			return &m_iType;
+			case ASTInfo::SYMBOL:		return &m_iSymbol;
+			default:
+			{
+				if (m_pExtraInfo != nullptr)
+				{
+					for (std::pair<ASTInfo, int32_t>& extraInfo : *m_pExtraInfo)
+					{
+						if (extraInfo.first == eKey)
+							return &extraInfo.second;
+					}
+				}
+			}
+			break;
 		}
+
+		return nullptr;
 	}
 
 	ASTNodeType			m_eASTNodeType;
+	bool				m_bIsPointerType;
+	bool				m_bIsConditionalCall;	// Hoisted call emitted where the expression uses it, e.g on the right of '&&' or '||'.
+	E_VARIABLESCOPE		m_eScope;
+	int32_t				m_iVariablePos;		// Scope in the upper 16 bits & position in the lower 16 bits, -1 until resolved.
 
-	std::vector<Tree*>	m_vStatements;
-	std::string			m_sAdditionalInfo;
+	// Interned, see StringInterner. Read & written through GET_INFO_FOR_KEY/SET_INFO_FOR_KEY.
+	int32_t				m_iText;
+	int32_t				m_iGivenName;
+	int32_t				m_iType;
+	int32_t				m_iSymbol;
 
-	bool				m_bIsPointerType;
+	std::vector<Tree*>	m_vStatements;
 
 	Tree*				m_pParentNode;
 	Tree*				m_pLeftNode;
 	Tree*				m_pRightNode;
 
-	std::map<std::string, std::string>	m_MapAdditionalInfo;
+	std::vector<std::pair<ASTInfo, int32_t>>*	m_pExtraInfo;		// Rare keys, created on first use.
+	std::unordered_map<int32_t, Tree*>*	m_pMapScopeSymbols;	// Declarations of this block by their SYMBOL, created on first declaration.
+	ExprNode*			m_pExpression;		// Root of an ASTNode_EXPRESSION's rvalue, nullptr if it is empty.
 } Tree;
 
-enum class E_VARIABLESCOPE
+namespace ExprNodeType_
 {
-	INVALID = -1,
-	ARGUMENT,
-	LOCAL,
-	STATIC,
-	MEMBER
+	enum class Type
+	{
+		EXPR_INTEGER = 0,	// m_sText is the literal, characters are already converted to their value.
+		EXPR_FLOAT,			// m_sText is the literal.
+		EXPR_VARIABLE,		// m_sText is the fully qualified variable name.
+		EXPR_MEMBER,		// m_sText is the object(or "this") & m_sMemberName the member variable.
+		EXPR_DEREF,			// m_sText is the pointer variable & m_pLeft the index.
+		EXPR_UNARY,			// m_eOperator applied to m_pLeft.
+		EXPR_BINARY,		// m_eOperator applied to m_pLeft & m_pRight.
+	};
+}
+
+// A node of an rvalue expression, built by the TinyCReader while it parses the expression.
+// Code generation walks it in post order, which is the order the operands & operators have
+// to be pushed onto the VM stack.
+struct ExprNode
+{
+	ExprNode()
+		: m_eExprNodeType(ExprNodeType_::Type::EXPR_INTEGER)
+		, m_eOperator(TokenType_::Type::TK_UNKNOWN)
+		, m_pLeft(nullptr)
+		, m_pRight(nullptr)
+		, m_pCallNode(nullptr)
+	{}
+
+	ExprNodeType_::Type		m_eExprNodeType;
+	TokenType_::Type		m_eOperator;
+	std::string				m_sText;
+	std::string				m_sMemberName;
+	ExprNode*				m_pLeft;
+	ExprNode*				m_pRight;
+	Tree*					m_pCallNode;	// EXPR_VARIABLE only, the temporary holding a hoisted function call's result.
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Every node of a compilation is placement-new'ed into fixed size blocks, so creating a
+// node does not hit the heap. All nodes are destroyed at once by release(), after which
+// no pointer handed out may be used.
+//////////////////////////////////////////////////////////////////////////////////////////
+#define NODE_ARENA_BLOCK_SIZE	1024
+
+template<typename T>
+class NodeArena
+{
+	public:
+		static T*						allocate()
+		{
+			if (m_vBlocks.empty() || m_iUsedInLastBlock == NODE_ARENA_BLOCK_SIZE)
+			{
+				m_vBlocks.push_back(static_cast<T*>(::operator new(sizeof(T) * NODE_ARENA_BLOCK_SIZE)));
+				m_iUsedInLastBlock = 0;
+			}
+
+			m_iAllocatedCount++;
+			return new (m_vBlocks.back() + m_iUsedInLastBlock++) T();
+		}
+
+		static int64_t					allocatedCount() { return m_iAllocatedCount; }	// Every node handed out, release() does not reset it.
+
+		static void						release()
+		{
+			for (size_t iBlock = 0; iBlock < m_vBlocks.size(); iBlock++)
+			{
+				int32_t iUsed = (iBlock + 1 == m_vBlocks.size()) ? m_iUsedInLastBlock : NODE_ARENA_BLOCK_SIZE;
+				for (int32_t i = 0; i < iUsed; i++)
+					m_vBlocks[iBlock][i].~T();
+
+				::operator delete(m_vBlocks[iBlock]);
+			}
+
+			m_vBlocks.clear();
+			m_iUsedInLastBlock = 0;
+		}
+	protected:
+	private:
+		static std::vector<T*>			m_vBlocks;
+		static int32_t					m_iUsedInLastBlock;
+		static int64_t					m_iAllocatedCount;
+};
+
+template<typename T> std::vector<T*>	NodeArena<T>::m_vBlocks;
+template<typename T> int32_t			NodeArena<T>::m_iUsedInLastBlock = 0;
+template<typename T> int64_t			NodeArena<T>::m_iAllocatedCount = 0;
+
+typedef NodeArena<Tree>					TreeArena;
+typedef NodeArena<ExprNode>				ExprArena;
+
 enum class E_FUNCTIONCALLTYPE
 {
 	INVALID = -1,
@@ -650,6 +1013,9 @@ static std::string toString(E_VARIABLESCOPE eE_VARIABLESCOPE)
 	case E_VARIABLESCOPE::MEMBER:
 		sE_VARIABLESCOPE = "MEMBER";
 		break;
+	case E_VARIABLESCOPE::HOST:
+		sE_VARIABLESCOPE = "HOST";
+		break;
 	}
 
 	return sE_VARIABLESCOPE;
@@ -662,16 +1028,19 @@ static E_VARIABLESCOPE toScope(std::string sE_VARIABLESCOPE)
 	else if (sE_VARIABLESCOPE == "LOCAL") return E_VARIABLESCOPE::LOCAL;
 	else if (sE_VARIABLESCOPE == "STATIC") return E_VARIABLESCOPE::STATIC;
 	else if (sE_VARIABLESCOPE == "MEMBER") return E_VARIABLESCOPE::MEMBER;
+	else if (sE_VARIABLESCOPE == "HOST") return E_VARIABLESCOPE::HOST;
 }
 
-static std::map<std::string, Tree*>		m_MapVariableToASTNodeCache;
+// Shared by all functions & structs on purpose: "pStatic = new T();" also declares a local of the
+// same name, which only resolves to the static because an earlier function cached that name.
+static std::unordered_map<int32_t, Tree*>	m_MapVariableToASTNodeCache;
 
 typedef struct InterfaceInfo
 {
 	InterfaceInfo(Tree* pNode)
 	: m_pNode(pNode)
 	{
-		m_sInterfaceName = GET_INFO_FOR_KEY(pNode, "text");
+		m_sInterfaceName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 	}
 
 	void updateInterfaceList(std::map<std::string, InterfaceInfo*> mapGlobalInterfaces)
@@ -683,7 +1052,7 @@ typedef struct InterfaceInfo
 		{
 			for (Tree* pStringNode : pStructImplementsListNode->m_vStatements)
 			{
-				std::string sInterfaceName = GET_INFO_FOR_KEY(pStringNode, "text");
+				std::string sInterfaceName = GET_INFO_FOR_KEY(pStringNode, ASTInfo::TEXT);
 				InterfaceInfo* pInterfaceInfo = mapGlobalInterfaces[sInterfaceName];
 				assert(pInterfaceInfo != nullptr);
 				if (pInterfaceInfo != nullptr)
@@ -734,7 +1103,7 @@ typedef struct StructInfo
 	, m_iVTableOffset(-1)
 	, m_bHasVTable(false)
 	{
-		m_sStructName = GET_INFO_FOR_KEY(pNode, "text");
+		m_sStructName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 
 		scanStructForMemberVariables(pNode);
 	}
@@ -783,7 +1152,7 @@ typedef struct StructInfo
 	void updateParent(std::map<std::string, StructInfo*> mapGlobalStructs)
 	{
 		// Check if it inherits any Parent Struct
-		std::string sStructParentName = GET_INFO_FOR_KEY(m_pNode, "extends");
+		std::string sStructParentName = GET_INFO_FOR_KEY(m_pNode, ASTInfo::EXTENDS);
 		if (NOT sStructParentName.empty())
 		{
 			StructInfo* pParentStructInfo = mapGlobalStructs[sStructParentName];
@@ -804,7 +1173,7 @@ typedef struct StructInfo
 		{
 			for (Tree* pStringNode : pStructImplementsListNode->m_vStatements)
 			{
-				std::string sInterfaceName = GET_INFO_FOR_KEY(pStringNode, "text");
+				std::string sInterfaceName = GET_INFO_FOR_KEY(pStringNode, ASTInfo::TEXT);
 				InterfaceInfo* pInterfaceInfo = mapGlobalInterfaces[sInterfaceName];
 				assert(pInterfaceInfo != nullptr);
 				if (pInterfaceInfo != nullptr)
@@ -850,7 +1219,7 @@ typedef struct StructInfo
 		bool bFound = false;
 		for (Tree* pMemberVar : m_vMemberVariables)
 		{
-			if (GET_INFO_FOR_KEY(pMemberVar, "givenName") == sVariableName)
+			if (GET_INFO_FOR_KEY(pMemberVar, ASTInfo::GIVENNAME) == sVariableName)
 			{
 				bFound = true;
 				break;
@@ -869,17 +1238,18 @@ typedef struct StructInfo
 	Tree* getMemberVariableASTNode(const char* sVariableName)
 	{
 		Tree* pASTNode = nullptr;
-		std::map<std::string, Tree*>::const_iterator itr = m_MapVariableToASTNodeCache.find(sVariableName);
+		int32_t iSymbol = StringInterner::intern(sVariableName, (int32_t)strlen(sVariableName));
+		std::unordered_map<int32_t, Tree*>::const_iterator itr = m_MapVariableToASTNodeCache.find(iSymbol);
 		if (itr != m_MapVariableToASTNodeCache.end())
 		{
-			pASTNode = m_MapVariableToASTNodeCache[sVariableName];
+			pASTNode = itr->second;
 		}
 		else
 		{
 			short iShortPosition = 0;
 			for (Tree* pMemberVar : m_vMemberVariables) // Starts with index 0
 			{
-				if (GET_INFO_FOR_KEY(pMemberVar, "givenName") == sVariableName)
+				if (GET_INFO_FOR_KEY(pMemberVar, ASTInfo::GIVENNAME) == sVariableName)
 				{
 					pASTNode = pMemberVar;
 					break;
@@ -897,12 +1267,11 @@ typedef struct StructInfo
 			if (pASTNode != nullptr)
 			{
 				// While scanning for the variable, find its position in the respective block & set it.
-				std::string sVariablePos = GET_INFO_FOR_KEY(pASTNode, "variablePos");
-				if (sVariablePos == "-1")
+				if (pASTNode->m_iVariablePos == -1)
 				{
 					int32_t iPositionOperand = 0;
 					E_VARIABLESCOPE eVARIABLESCOPE = E_VARIABLESCOPE::INVALID;
-					eVARIABLESCOPE = toScope(GET_INFO_FOR_KEY(pASTNode, "scope"));
+					eVARIABLESCOPE = pASTNode->m_eScope;
 					assert(eVARIABLESCOPE != E_VARIABLESCOPE::INVALID);
 
 					if (eVARIABLESCOPE == E_VARIABLESCOPE::MEMBER && m_bHasVTable)
@@ -912,12 +1281,10 @@ typedef struct StructInfo
 					iPositionOperand <<= sizeof(int16_t) * 8;
 					iPositionOperand |= (iShortPosition & 0x0000FFFF);
 
-					char sVariablePosFound[255] = { 0 };
-					_itoa(iPositionOperand, sVariablePosFound, 10);
-					SET_INFO_FOR_KEY(pASTNode, "variablePos", sVariablePosFound);
+					pASTNode->m_iVariablePos = iPositionOperand;
 				}
 
-				m_MapVariableToASTNodeCache[sVariableName] = pASTNode;
+				m_MapVariableToASTNodeCache[iSymbol] = pASTNode;
 			}
 		}
 
@@ -932,8 +1299,7 @@ typedef struct StructInfo
 		assert(pASTNode != nullptr);
 		if (pASTNode != nullptr)
 		{
-			std::string sVariablePos = GET_INFO_FOR_KEY(pASTNode, "variablePos");
-			iPositionOperand = atoi(sVariablePos.c_str());
+			iPositionOperand = pASTNode->m_iVariablePos;
 		}
 
 		return iPositionOperand;
@@ -967,12 +1333,16 @@ typedef struct FunctionInfo
 	FunctionInfo(Tree* pNode, int iOffset)
 	: m_pNode(pNode)
 	, m_iStartOffsetInCode(iOffset)
-	, m_sFunctionName(GET_INFO_FOR_KEY(pNode, "text"))
+	, m_sFunctionName(GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT))
 	, m_pFunctionReturnType(pNode->m_pLeftNode)
 	, m_pFunctionArguments(pNode->m_pRightNode)
 	, m_pParentStructInfo(nullptr)
 	, m_pParentInterfaceInfo(nullptr)
 	, m_iPositionInVTABLE(-1)
+	, m_iBodyOffsetInCode(-1)
+	, m_iEpilogueOffsetInCode(-1)
+	, m_iInlineLocalCount(0)
+	, m_iStackObjectSlots(0)
 	{
 		scanFunctionForLocals(pNode);
 		scanFunctionForArguments(pNode);
@@ -1077,13 +1447,13 @@ typedef struct FunctionInfo
 
 	bool isUniqueLocalVariable(Tree* pNode)
 	{
-		std::string sNodeGivenName = GET_INFO_FOR_KEY(pNode, "givenName");
-		std::string sNodeText = GET_INFO_FOR_KEY(pNode, "text");
+		std::string sNodeGivenName = GET_INFO_FOR_KEY(pNode, ASTInfo::GIVENNAME);
+		std::string sNodeText = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 
 		for (Tree* pChild : m_vLocalVariables)
 		{
-			std::string sChildGivenName = GET_INFO_FOR_KEY(pChild, "givenName");
-			std::string sChildText = GET_INFO_FOR_KEY(pChild, "text");
+			std::string sChildGivenName = GET_INFO_FOR_KEY(pChild, ASTInfo::GIVENNAME);
+			std::string sChildText = GET_INFO_FOR_KEY(pChild, ASTInfo::TEXT);
 			if (	sNodeGivenName == sChildGivenName
 					&&
 					sNodeText == sChildText
@@ -1098,10 +1468,11 @@ typedef struct FunctionInfo
 	Tree* getLocalVariableASTNode(std::string sVariableName)
 	{
 		Tree* pASTNode = nullptr;
-		std::map<std::string, Tree*>::const_iterator itr = m_MapVariableToASTNodeCache.find(sVariableName);
-		if (itr != m_MapVariableToASTNodeCache.end())
+		int32_t iSymbol = StringInterner::intern(sVariableName);
+		std::unordered_map<int32_t, Tree*>::const_iterator itr = m_MapVariableToASTNodeCache.find(iSymbol);
+		if (itr != m_MapVariableToASTNodeCache.end() && isCachedNodeMine(itr->second))
 		{
-			pASTNode = m_MapVariableToASTNodeCache[sVariableName];
+			pASTNode = itr->second;
 		}
 		else
 		{
@@ -1112,7 +1483,7 @@ typedef struct FunctionInfo
 			for (Tree* pLocalVar : m_vLocalVariables) // Starts with index 1
 			{
 				iShortPosition++;
-				if (GET_INFO_FOR_KEY(pLocalVar, "text") == sVariableName)
+				if (GET_INFO_FOR_KEY(pLocalVar, ASTInfo::TEXT) == sVariableName)
 				{
 					pASTNode = pLocalVar;
 					bFound = true;
@@ -1126,7 +1497,7 @@ typedef struct FunctionInfo
 				iShortPosition = 0;
 				for (Tree* pArgVar : m_vArguments) // Starts with index 0
 				{
-					if (GET_INFO_FOR_KEY(pArgVar, "text") == sVariableName)
+					if (GET_INFO_FOR_KEY(pArgVar, ASTInfo::TEXT) == sVariableName)
 					{
 						pASTNode = pArgVar;
 						bFound = true;
@@ -1143,7 +1514,7 @@ typedef struct FunctionInfo
 				iShortPosition = 0;
 				for (Tree* pMemberVar : m_pParentStructInfo->m_vMemberVariables) // Starts with index 0
 				{
-					if (GET_INFO_FOR_KEY(pMemberVar, "text") == sVariableName)
+					if (GET_INFO_FOR_KEY(pMemberVar, ASTInfo::TEXT) == sVariableName)
 					{
 						pASTNode = pMemberVar;
 						bFound = true;
@@ -1157,16 +1528,24 @@ typedef struct FunctionInfo
 			// Check for 'Static'
 			if (NOT bFound)
 			{
-				iShortPosition = 0;
-				for (Tree* pStaticVar : m_vStaticVariables) // Starts with index 0
+				int32_t iIndex = findStaticVariable(iSymbol);
+				if (iIndex >= 0) // Starts with index 0
 				{
-					if (GET_INFO_FOR_KEY(pStaticVar, "text") == sVariableName)
-					{
-						pASTNode = pStaticVar;
-						break;
-					}
+					pASTNode = m_vStaticVariables[iIndex];
+					iShortPosition = iIndex;
+					bFound = true;
+				}
+			}
 
-					iShortPosition++;
+			// Check for 'Host Data', read-only fields mapped by the host into VM memory.
+			if (NOT bFound)
+			{
+				int32_t iIndex = findHostVariable(iSymbol);
+				if (iIndex >= 0) // Starts with index 0
+				{
+					pASTNode = m_vHostVariables[iIndex];
+					iShortPosition = iIndex;
+					bFound = true;
 				}
 			}
 
@@ -1174,12 +1553,11 @@ typedef struct FunctionInfo
 			if (pASTNode != nullptr)
 			{
 				// While scanning for the variable, find its position in the respective block & set it.
-				std::string sVariablePos = GET_INFO_FOR_KEY(pASTNode, "variablePos");
-				if (sVariablePos == "-1")
+				if (pASTNode->m_iVariablePos == -1)
 				{
 					int32_t iPositionOperand = 0;
 					E_VARIABLESCOPE eVARIABLESCOPE = E_VARIABLESCOPE::INVALID;
-					eVARIABLESCOPE = toScope(GET_INFO_FOR_KEY(pASTNode, "scope"));
+					eVARIABLESCOPE = pASTNode->m_eScope;
 					assert(eVARIABLESCOPE != E_VARIABLESCOPE::INVALID);
 
 					if (eVARIABLESCOPE == E_VARIABLESCOPE::MEMBER && m_pParentStructInfo->m_bHasVTable)
@@ -1189,18 +1567,32 @@ typedef struct FunctionInfo
 					iPositionOperand <<= sizeof(int16_t) * 8;
 					iPositionOperand |= (iShortPosition & 0x0000FFFF);
 
-					char sVariablePosFound[255] = { 0 };
-					_itoa(iPositionOperand, sVariablePosFound, 10);
-					SET_INFO_FOR_KEY(pASTNode, "variablePos", sVariablePosFound);
+					pASTNode->m_iVariablePos = iPositionOperand;
 				}
 
-				m_MapVariableToASTNodeCache[sVariableName] = pASTNode;
+				m_MapVariableToASTNodeCache[iSymbol] = pASTNode;
 			}
 		}
 
 		return pASTNode;
 	}
 
+	// A struct's member function() & a global one of the same name qualify their arguments alike,
+	// an ARGUMENT cached by the other one is not ours.
+	bool isCachedNodeMine(Tree* pASTNode)
+	{
+		if (pASTNode->m_eScope != E_VARIABLESCOPE::ARGUMENT)
+			return true;
+
+		for (Tree* pArgVar : m_vArguments)
+		{
+			if (pArgVar == pASTNode)
+				return true;
+		}
+
+		return false;
+	}
+
 	int32_t getLocalVariablePosition(std::string sLocalVariableName)
 	{
 		int32_t iPositionOperand = 0;
@@ -1209,8 +1601,7 @@ typedef struct FunctionInfo
 		assert(pASTNode != nullptr);
 		if (pASTNode != nullptr)
 		{
-			std::string sVariablePos = GET_INFO_FOR_KEY(pASTNode, "variablePos");
-			iPositionOperand = atoi(sVariablePos.c_str());
+			iPositionOperand = pASTNode->m_iVariablePos;
 		}
 
 		return iPositionOperand;
@@ -1224,12 +1615,26 @@ typedef struct FunctionInfo
 		assert(pVariableASTNode != nullptr);
 		if (pVariableASTNode != nullptr)
 		{
-			sType = GET_INFO_FOR_KEY(pVariableASTNode, "type");
+			sType = GET_INFO_FOR_KEY(pVariableASTNode, ASTInfo::TYPE);
 		}
 
 		return sType;
 	}
 
+	bool IsLocalVariableAHostData(std::string sLocalVariableName)
+	{
+		bool bIsHostData = false;
+
+		Tree* pVariableASTNode = getLocalVariableASTNode(sLocalVariableName);
+		assert(pVariableASTNode != nullptr);
+		if (pVariableASTNode != nullptr)
+		{
+			bIsHostData = (pVariableASTNode->m_eScope == E_VARIABLESCOPE::HOST);
+		}
+
+		return bIsHostData;
+	}
+
 	bool IsLocalVariableAPointerType(std::string sLocalVariableName)
 	{
 		bool bIsPointerType = false;
@@ -1256,17 +1661,36 @@ typedef struct FunctionInfo
 
 	static void addStaticVariable(Tree* pNode)
 	{
-		bool bIsNew = true;
-		for (Tree* pStaticVar : m_vStaticVariables)
+		int32_t iSymbol = StringInterner::intern(GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT));
+		if (findStaticVariable(iSymbol) < 0)
 		{
-			if (GET_INFO_FOR_KEY(pNode, "text") == GET_INFO_FOR_KEY(pStaticVar, "text")) {
-				bIsNew = false;
-				break;
-			}
+			m_MapStaticVariableIndex[iSymbol] = m_vStaticVariables.size();
+			m_vStaticVariables.push_back(pNode);
 		}
+	}
 
-		if (bIsNew)
-			m_vStaticVariables.push_back(pNode);
+	static void addHostVariable(Tree* pNode)
+	{
+		int32_t iSymbol = StringInterner::intern(GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT));
+		if (findHostVariable(iSymbol) < 0)
+		{
+			m_MapHostVariableIndex[iSymbol] = m_vHostVariables.size();
+			m_vHostVariables.push_back(pNode);
+		}
+	}
+
+	// Index into m_vStaticVariables, -1 if there is no static by that name.
+	static int32_t findStaticVariable(int32_t iSymbol)
+	{
+		std::unordered_map<int32_t, int32_t>::const_iterator itr = m_MapStaticVariableIndex.find(iSymbol);
+		return (itr != m_MapStaticVariableIndex.end()) ? itr->second : -1;
+	}
+
+	// Index into m_vHostVariables, -1 if there is no host field by that name.
+	static int32_t findHostVariable(int32_t iSymbol)
+	{
+		std::unordered_map<int32_t, int32_t>::const_iterator itr = m_MapHostVariableIndex.find(iSymbol);
+		return (itr != m_MapHostVariableIndex.end()) ? itr->second : -1;
 	}
 
 	void setParentStruct(StructInfo* pStructInfo)
@@ -1275,7 +1699,7 @@ typedef struct FunctionInfo
 
 		// Check for "virtual"
 		{
-			std::string sVirtual = GET_INFO_FOR_KEY(m_pNode, "isVirtual");
+			std::string sVirtual = GET_INFO_FOR_KEY(m_pNode, ASTInfo::ISVIRTUAL);
 			if (NOT pStructInfo->m_bHasVTable && sVirtual == "virtual")
 			{
 				pStructInfo->m_bHasVTable = true;
@@ -1300,10 +1724,19 @@ typedef struct FunctionInfo
 	std::vector<Tree*>				m_vArguments;
 
 	static std::vector<Tree*>		m_vStaticVariables;
+	static std::vector<Tree*>		m_vHostVariables;
+	static std::unordered_map<int32_t, int32_t>	m_MapStaticVariableIndex;	// By interned name.
+	static std::unordered_map<int32_t, int32_t>	m_MapHostVariableIndex;		// By interned name.
 	StructInfo*						m_pParentStructInfo;
 	InterfaceInfo*					m_pParentInterfaceInfo;
 
 	int32_t							m_iPositionInVTABLE;
+
+	int32_t							m_iBodyOffsetInCode;		// After the prologue.
+	int32_t							m_iEpilogueOffsetInCode;	// -1 till the function() is emitted.
+	int32_t							m_iInlineLocalCount;		// LOCALs after m_vLocalVariables, reserved for the function()s inlined into this one.
+	int32_t							m_iStackObjectSlots;		// LOCALs after those, holding the objects that never escape this function().
+	std::unordered_map<Tree*, int32_t>	m_MapStackObjects;		// Object LOCAL ==> the LOCAL its memory starts @, see EscapeAnalysis.h.
 } FunctionInfo;
 
 static int32_t calculateVirtualFunctionCount(StructInfo* pStructInfo)
@@ -1318,7 +1751,7 @@ static int32_t calculateVirtualFunctionCount(StructInfo* pStructInfo)
 			if (pFunctionInfo != nullptr)
 			{
 				Tree* pNode = pFunctionInfo->m_pNode;
-				std::string sVirtual = GET_INFO_FOR_KEY(pNode, "isVirtual");
+				std::string sVirtual = GET_INFO_FOR_KEY(pNode, ASTInfo::ISVIRTUAL);
 				if (NOT sVirtual.empty())
 				{
 					pStructInfo->m_iVirtualFunctionCount++;
@@ -0,0 +1,376 @@
+#include "ConstantFolder.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+ExprNode* ConstantFolder::fold(ExprNode* pExprNode, bool bIsFP)
+{
+	if (pExprNode == nullptr)
+		return nullptr;
+
+	ExprNode* pLeft = fold(pExprNode->m_pLeft, bIsFP);
+	ExprNode* pRight = fold(pExprNode->m_pRight, bIsFP);
+
+	switch (pExprNode->m_eExprNodeType)
+	{
+		case ExprNodeType_::Type::EXPR_UNARY:
+			return foldUnary(pExprNode, pLeft, bIsFP);
+		case ExprNodeType_::Type::EXPR_BINARY:
+			return foldBinary(pExprNode, pLeft, pRight, bIsFP);
+	}
+
+	// Literals, variables & member accesses, or a deref whose index may have been folded.
+	if (pLeft != pExprNode->m_pLeft || pRight != pExprNode->m_pRight)
+		return makeCopy(pExprNode, pLeft, pRight);
+
+	return pExprNode;
+}
+
+bool ConstantFolder::castConstant(ExprNode* pExprNode, PRIMIIVETYPE eLVal_PRIMIIVETYPE, int32_t& iValue, float& fValue)
+{
+	//////////////////////////////////////////////////////////////////////
+	// The 'CAST' the VM would apply before storing a literal rvalue,
+	// see VirtualMachine::cast(). false if it is not a literal or the
+	// conversion is not defined.
+	//////////////////////////////////////////////////////////////////////
+	if (NOT isLiteral(pExprNode))
+		return false;
+
+	int32_t iRValue = 0;
+	if (pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_FLOAT)
+	{
+		float fRValue = (float)atof(pExprNode->m_sText.c_str());
+		if (eLVal_PRIMIIVETYPE == PRIMIIVETYPE::FLOAT)
+		{
+			fValue = fRValue;
+			return true;
+		}
+
+		if (NOT (fRValue > -2147483904.0f && fRValue < 2147483648.0f))
+			return false;
+
+		iRValue = (int32_t)fRValue;
+	}
+	else
+	{
+		iRValue = atoi(pExprNode->m_sText.c_str());
+	}
+
+	switch (eLVal_PRIMIIVETYPE)
+	{
+		case PRIMIIVETYPE::INT_8:
+			iValue = (int8_t)iRValue;
+			return true;
+		case PRIMIIVETYPE::INT_16:
+			iValue = (int16_t)iRValue;
+			return true;
+		case PRIMIIVETYPE::INT_32:
+			iValue = iRValue;
+			return true;
+		case PRIMIIVETYPE::FLOAT:
+			fValue = (float)iRValue;
+			return true;
+	}
+
+	return false;
+}
+
+ExprNode* ConstantFolder::foldUnary(ExprNode* pExprNode, ExprNode* pOperand, bool bIsFP)
+{
+	if (NOT bIsFP && pOperand != nullptr && pOperand->m_eExprNodeType == ExprNodeType_::Type::EXPR_INTEGER)
+	{
+		int32_t iOperand = atoi(pOperand->m_sText.c_str());
+		switch (pExprNode->m_eOperator)
+		{
+			case TokenType_::Type::TK_NEGATE:
+				return makeInteger((int32_t)(0u - (uint32_t)iOperand));
+			case TokenType_::Type::TK_BITWISENOT:
+				return makeInteger(~iOperand);
+			case TokenType_::Type::TK_NOT:
+				return makeInteger((iOperand > 0) ? 0 : 1);		// As the VM's '_NOT' does.
+		}
+	}
+
+	if (pOperand != pExprNode->m_pLeft)
+		return makeCopy(pExprNode, pOperand, nullptr);
+
+	return pExprNode;
+}
+
+ExprNode* ConstantFolder::foldBinary(ExprNode* pExprNode, ExprNode* pLeft, ExprNode* pRight, bool bIsFP)
+{
+	if (isLiteral(pLeft) && isLiteral(pRight))
+	{
+		if (bIsFP)
+		{
+			float fResult = 0.0f;
+			if (foldFloat(pExprNode->m_eOperator, (float)atof(pLeft->m_sText.c_str()), (float)atof(pRight->m_sText.c_str()), fResult))
+				return makeFloat(fResult);
+		}
+		else
+		{
+			int32_t iResult = 0;
+			if (foldInt(pExprNode->m_eOperator, atoi(pLeft->m_sText.c_str()), atoi(pRight->m_sText.c_str()), iResult))
+				return makeInteger(iResult);
+		}
+	}
+
+	return simplify(pExprNode, pLeft, pRight, bIsFP);
+}
+
+ExprNode* ConstantFolder::simplify(ExprNode* pExprNode, ExprNode* pLeft, ExprNode* pRight, bool bIsFP)
+{
+	if (bIsFP)
+	{
+		switch (pExprNode->m_eOperator)
+		{
+			case TokenType_::Type::TK_MUL:
+			{
+				if (isLiteralOf(pRight, 1, bIsFP))
+					return pLeft;
+				if (isLiteralOf(pLeft, 1, bIsFP))
+					return pRight;
+			}
+			break;
+			case TokenType_::Type::TK_DIV:
+			{
+				if (isLiteralOf(pRight, 1, bIsFP))
+					return pLeft;
+			}
+			break;
+			case TokenType_::Type::TK_SUB:
+			{
+				if (isLiteralOf(pRight, 0, bIsFP))
+					return pLeft;
+			}
+			break;
+		}
+	}
+	else
+	{
+		switch (pExprNode->m_eOperator)
+		{
+			case TokenType_::Type::TK_ADD:
+			case TokenType_::Type::TK_BITWISEOR:
+			case TokenType_::Type::TK_BITWISEXOR:
+			{
+				if (isLiteralOf(pRight, 0, bIsFP))
+					return pLeft;
+				if (isLiteralOf(pLeft, 0, bIsFP))
+					return pRight;
+			}
+			break;
+			case TokenType_::Type::TK_SUB:
+			case TokenType_::Type::TK_BITWISELEFTSHIFT:
+			case TokenType_::Type::TK_BITWISERIGHTSHIFT:
+			{
+				if (isLiteralOf(pRight, 0, bIsFP))
+					return pLeft;
+			}
+			break;
+			case TokenType_::Type::TK_DIV:
+			{
+				if (isLiteralOf(pRight, 1, bIsFP))
+					return pLeft;
+			}
+			break;
+			case TokenType_::Type::TK_MUL:
+			{
+				if (isLiteralOf(pRight, 1, bIsFP))
+					return pLeft;
+				if (isLiteralOf(pLeft, 1, bIsFP))
+					return pRight;
+			}
+			// Fall through, 'x * 0' is 0 like 'x & 0'.
+			case TokenType_::Type::TK_BITWISEAND:
+			{
+				if (isLiteralOf(pRight, 0, bIsFP) && NOT hasConditionalCall(pLeft))
+					return pRight;
+				if (isLiteralOf(pLeft, 0, bIsFP) && NOT hasConditionalCall(pRight))
+					return pLeft;
+			}
+			break;
+			case TokenType_::Type::TK_LOGICALAND:
+			{
+				if (isLiteralOf(pLeft, 0, bIsFP))
+					return makeInteger(0);
+			}
+			break;
+			case TokenType_::Type::TK_LOGICALOR:
+			{
+				if (isLiteral(pLeft) && NOT isLiteralOf(pLeft, 0, bIsFP))
+					return makeInteger(1);
+			}
+			break;
+		}
+	}
+
+	if (pLeft != pExprNode->m_pLeft || pRight != pExprNode->m_pRight)
+		return makeCopy(pExprNode, pLeft, pRight);
+
+	return pExprNode;
+}
+
+bool ConstantFolder::foldInt(TokenType_::Type eOperator, int32_t iLeft, int32_t iRight, int32_t& iResult)
+{
+	switch (eOperator)
+	{
+		case TokenType_::Type::TK_MUL:
+			iResult = (int32_t)((uint32_t)iLeft * (uint32_t)iRight);
+			return true;
+		case TokenType_::Type::TK_DIV:
+		case TokenType_::Type::TK_MOD:
+		{
+			if (iRight == 0 || (iLeft == INT32_MIN && iRight == -1))
+				return false;
+
+			iResult = (eOperator == TokenType_::Type::TK_DIV) ? (iLeft / iRight) : (iLeft % iRight);
+			return true;
+		}
+		case TokenType_::Type::TK_ADD:
+			iResult = (int32_t)((uint32_t)iLeft + (uint32_t)iRight);
+			return true;
+		case TokenType_::Type::TK_SUB:
+			iResult = (int32_t)((uint32_t)iLeft - (uint32_t)iRight);
+			return true;
+		case TokenType_::Type::TK_LT:
+			iResult = (iLeft < iRight);
+			return true;
+		case TokenType_::Type::TK_LTEQ:
+			iResult = (iLeft <= iRight);
+			return true;
+		case TokenType_::Type::TK_GT:
+			iResult = (iLeft > iRight);
+			return true;
+		case TokenType_::Type::TK_GTEQ:
+			iResult = (iLeft >= iRight);
+			return true;
+		case TokenType_::Type::TK_EQ:
+			iResult = (iLeft == iRight);
+			return true;
+		case TokenType_::Type::TK_NEQ:
+			iResult = (iLeft != iRight);
+			return true;
+		case TokenType_::Type::TK_LOGICALAND:
+			iResult = (iLeft != 0 && iRight != 0);
+			return true;
+		case TokenType_::Type::TK_LOGICALOR:
+			iResult = (iLeft != 0 || iRight != 0);
+			return true;
+		case TokenType_::Type::TK_BITWISEAND:
+			iResult = (iLeft & iRight);
+			return true;
+		case TokenType_::Type::TK_BITWISEOR:
+			iResult = (iLeft | iRight);
+			return true;
+		case TokenType_::Type::TK_BITWISEXOR:
+			iResult = (iLeft ^ iRight);
+			return true;
+		case TokenType_::Type::TK_BITWISELEFTSHIFT:
+		case TokenType_::Type::TK_BITWISERIGHTSHIFT:
+		{
+			if (iRight < 0 || iRight > 31)
+				return false;
+
+			iResult = (eOperator == TokenType_::Type::TK_BITWISELEFTSHIFT) ? (int32_t)((uint32_t)iLeft << iRight) : (iLeft >> iRight);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ConstantFolder::foldFloat(TokenType_::Type eOperator, float fLeft, float fRight, float& fResult)
+{
+	switch (eOperator)
+	{
+		case TokenType_::Type::TK_MUL:
+			fResult = fLeft * fRight;
+			break;
+		case TokenType_::Type::TK_DIV:
+			fResult = fLeft / fRight;
+			break;
+		case TokenType_::Type::TK_MOD:
+			fResult = std::fmod(fLeft, fRight);
+			break;
+		case TokenType_::Type::TK_ADD:
+			fResult = fLeft + fRight;
+			break;
+		case TokenType_::Type::TK_SUB:
+			fResult = fLeft - fRight;
+			break;
+		default:
+			return false;
+	}
+
+	return std::isfinite(fResult);
+}
+
+bool ConstantFolder::isLiteral(ExprNode* pExprNode)
+{
+	return	pExprNode != nullptr
+			&&
+			(pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_INTEGER || pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_FLOAT);
+}
+
+bool ConstantFolder::isLiteralOf(ExprNode* pExprNode, int32_t iValue, bool bIsFP)
+{
+	if (NOT isLiteral(pExprNode))
+		return false;
+
+	if (bIsFP)
+	{
+		float fLiteral = (float)atof(pExprNode->m_sText.c_str());
+		return (fLiteral == (float)iValue && NOT std::signbit(fLiteral));		// 'x - -0.0' is not x for x = -0.0
+	}
+
+	return (pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_INTEGER && atoi(pExprNode->m_sText.c_str()) == iValue);
+}
+
+bool ConstantFolder::hasConditionalCall(ExprNode* pExprNode)
+{
+	if (pExprNode == nullptr)
+		return false;
+
+	if (pExprNode->m_pCallNode != nullptr && pExprNode->m_pCallNode->m_bIsConditionalCall)
+		return true;
+
+	return hasConditionalCall(pExprNode->m_pLeft) || hasConditionalCall(pExprNode->m_pRight);
+}
+
+ExprNode* ConstantFolder::makeInteger(int32_t iValue)
+{
+	ExprNode* pLiteral = ExprArena::allocate();
+	{
+		pLiteral->m_eExprNodeType = ExprNodeType_::Type::EXPR_INTEGER;
+		pLiteral->m_sText = std::to_string(iValue);
+	}
+
+	return pLiteral;
+}
+
+ExprNode* ConstantFolder::makeFloat(float fValue)
+{
+	char sValue[32] = { 0 };
+	sprintf_s(sValue, "%.9g", fValue);			// 9 digits read back as the same float.
+
+	ExprNode* pLiteral = ExprArena::allocate();
+	{
+		pLiteral->m_eExprNodeType = ExprNodeType_::Type::EXPR_FLOAT;
+		pLiteral->m_sText = sValue;
+	}
+
+	return pLiteral;
+}
+
+ExprNode* ConstantFolder::makeCopy(ExprNode* pExprNode, ExprNode* pLeft, ExprNode* pRight)
+{
+	ExprNode* pCopy = ExprArena::allocate();
+	{
+		*pCopy = *pExprNode;
+		pCopy->m_pLeft = pLeft;
+		pCopy->m_pRight = pRight;
+	}
+
+	return pCopy;
+}
@@ -0,0 +1,217 @@
+#include "Devirtualizer.h"
+#include <assert.h>
+
+std::map<std::string, std::string>				Devirtualizer::m_MapParents;
+std::map<std::string, std::set<std::string>>	Devirtualizer::m_MapVirtuals;
+
+void Devirtualizer::scanHierarchy(Tree* pRootNode)
+{
+	m_MapParents.clear();
+	m_MapVirtuals.clear();
+
+	if (pRootNode == nullptr)
+		return;
+
+	for (Tree* pNode : pRootNode->m_vStatements)
+	{
+		if (pNode->m_eASTNodeType != ASTNodeType::ASTNode_STRUCTDEF)
+			continue;
+
+		std::string sStructName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
+		m_MapParents[sStructName] = GET_INFO_FOR_KEY(pNode, ASTInfo::EXTENDS);
+
+		std::set<std::string>& setVirtuals = m_MapVirtuals[sStructName];
+		for (Tree* pChild : pNode->m_vStatements)
+		{
+			if (pChild->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONDEF
+				&&
+				GET_INFO_FOR_KEY(pChild, ASTInfo::ISVIRTUAL) == "virtual"
+			) {
+				setVirtuals.insert(GET_INFO_FOR_KEY(pChild, ASTInfo::TEXT) + "(" + GET_INFO_FOR_KEY(pChild->m_pRightNode, ASTInfo::SYMBOL) + ")");
+			}
+		}
+	}
+}
+
+FunctionInfo* Devirtualizer::devirtualize(FunctionInfo* pCaller, StructInfo* pCurrentStruct, FunctionInfo* pCallee, Tree* pCALLEE_Node, const std::map<std::string, StructInfo*>& mapGlobalStructs)
+{
+	//////////////////////////////////////////////////////////////////////
+	// 1. The type the object is known to have, if any.
+	// 2. Else the static type, if nothing below it overrides the callee.
+	// 3. The function() that type's VTABLE holds, found up the hierarchy.
+	//////////////////////////////////////////////////////////////////////
+	if (pCallee == nullptr || pCALLEE_Node == nullptr)
+		return nullptr;
+
+	if (GET_INFO_FOR_KEY(pCallee->m_pNode, ASTInfo::ISVIRTUAL) != "virtual")
+		return nullptr;
+
+	std::string sKey = keyOf(pCallee);
+
+	// 1.
+	std::string sType = exactTypeOf(pCaller, pCurrentStruct, pCALLEE_Node->m_pParentNode);
+
+	// 2.
+	if (sType.empty())
+	{
+		std::string sStaticType = staticTypeOf(pCurrentStruct, pCallee, pCALLEE_Node);
+		if (NOT sStaticType.empty() && NOT isOverridden(sStaticType, sKey))
+			sType = sStaticType;
+	}
+
+	// 3.
+	int32_t iDepth = 0;
+	while (NOT sType.empty())
+	{
+		std::map<std::string, std::set<std::string>>::const_iterator itrVirtuals = m_MapVirtuals.find(sType);
+		if (itrVirtuals != m_MapVirtuals.end() && itrVirtuals->second.count(sKey) > 0)
+			break;
+
+		std::map<std::string, std::string>::const_iterator itrParent = m_MapParents.find(sType);
+		sType = (itrParent != m_MapParents.end()) ? itrParent->second : "";
+
+		assert(++iDepth < 256);
+		if (iDepth >= 256)
+			return nullptr;
+	}
+
+	if (sType.empty())
+		return nullptr;
+
+	std::map<std::string, StructInfo*>::const_iterator itrStruct = mapGlobalStructs.find(sType);
+	if (itrStruct == mapGlobalStructs.end() || itrStruct->second == nullptr)
+		return nullptr;
+
+	for (void* pVoidPtr : itrStruct->second->m_vMemberFunctions)
+	{
+		FunctionInfo* pFunctionInfo = (FunctionInfo*)pVoidPtr;
+		if (pFunctionInfo != nullptr
+			&&
+			GET_INFO_FOR_KEY(pFunctionInfo->m_pNode, ASTInfo::ISVIRTUAL) == "virtual"
+			&&
+			keyOf(pFunctionInfo) == sKey
+		) {
+			return pFunctionInfo;
+		}
+	}
+
+	// Not emitted yet.
+	return nullptr;
+}
+
+std::string Devirtualizer::exactTypeOf(FunctionInfo* pCaller, StructInfo* pCurrentStruct, Tree* pMemberAccessNode)
+{
+	if (pMemberAccessNode == nullptr || pMemberAccessNode->m_eASTNodeType != ASTNodeType::ASTNode_MEMBERACCESS)
+		return "";
+
+	std::string sAccessType = GET_INFO_FOR_KEY(pMemberAccessNode, ASTInfo::ACCESSTYPE);
+	std::string sObjectName = GET_INFO_FOR_KEY(pMemberAccessNode, ASTInfo::TEXT);
+
+	// 'Parent::f()', 'ECX' is moved to the Parent's part of 'this', see handleStructMemberAccess().
+	if (sAccessType == "static")
+	{
+		if (pCurrentStruct != nullptr && pCurrentStruct->m_sStructName != sObjectName)
+			return sObjectName;
+
+		return "";
+	}
+
+	if (sAccessType != "object" || sObjectName == "this" || pCaller == nullptr)
+		return "";
+
+	// Arguments, MEMBERs & statics may hold anything below their type.
+	bool bIsLocalObject = false;
+	for (Tree* pLocalVar : pCaller->m_vLocalVariables)
+	{
+		if (GET_INFO_FOR_KEY(pLocalVar, ASTInfo::TEXT) == sObjectName)
+		{
+			bIsLocalObject = (pLocalVar->m_eASTNodeType == ASTNodeType::ASTNode_TYPESTRUCT);
+			break;
+		}
+	}
+
+	std::string sType = "";
+	if (NOT bIsLocalObject || NOT isAssignedOnlyByNew(pCaller->m_pNode, sObjectName, sType))
+		return "";
+
+	return sType;
+}
+
+std::string Devirtualizer::staticTypeOf(StructInfo* pCurrentStruct, FunctionInfo* pCallee, Tree* pCALLEE_Node)
+{
+	std::string sType = GET_INFO_FOR_KEY(pCALLEE_Node, ASTInfo::MEMBERFUNCTIONOF);
+	if (NOT sType.empty())
+		return sType;
+
+	// 'this->f()' or 'f()' in a member function().
+	if (pCurrentStruct != nullptr)
+		return pCurrentStruct->m_sStructName;
+
+	if (pCallee->m_pParentStructInfo != nullptr)
+		return pCallee->m_pParentStructInfo->m_sStructName;
+
+	return "";
+}
+
+bool Devirtualizer::isOverridden(const std::string& sStructName, const std::string& sKey)
+{
+	std::map<std::string, std::set<std::string>>::const_iterator itrVirtuals = m_MapVirtuals.begin();
+	for (; itrVirtuals != m_MapVirtuals.end(); ++itrVirtuals)
+	{
+		if (itrVirtuals->first == sStructName || itrVirtuals->second.count(sKey) == 0)
+			continue;
+
+		// Is it below sStructName ?
+		std::string sType = itrVirtuals->first;
+		for (int32_t iDepth = 0; NOT sType.empty() && iDepth < 256; iDepth++)
+		{
+			std::map<std::string, std::string>::const_iterator itrParent = m_MapParents.find(sType);
+			sType = (itrParent != m_MapParents.end()) ? itrParent->second : "";
+
+			if (sType == sStructName)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+bool Devirtualizer::isAssignedOnlyByNew(Tree* pNode, const std::string& sVariableName, std::string& sType)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Every 'new' of sVariableName in pNode makes the same type, which is
+	// left in sType, & it is never assigned anything else.
+	//////////////////////////////////////////////////////////////////////
+	if (pNode == nullptr)
+		return true;
+
+	if (GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) == sVariableName)
+	{
+		if (pNode->m_eASTNodeType == ASTNodeType::ASTNode_ASSIGN)
+			return false;
+
+		if (pNode->m_eASTNodeType == ASTNodeType::ASTNode_TYPESTRUCT)
+		{
+			std::string sNewType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
+			if (NOT sType.empty() && sType != sNewType)
+				return false;
+
+			sType = sNewType;
+		}
+	}
+
+	for (Tree* pChild : pNode->m_vStatements)
+	{
+		if (NOT isAssignedOnlyByNew(pChild, sVariableName, sType))
+			return false;
+	}
+
+	return isAssignedOnlyByNew(pNode->m_pLeftNode, sVariableName, sType)
+			&&
+			isAssignedOnlyByNew(pNode->m_pRightNode, sVariableName, sType);
+}
+
+std::string Devirtualizer::keyOf(FunctionInfo* pFunctionInfo)
+{
+	return pFunctionInfo->m_sFunctionName + "(" + GET_INFO_FOR_KEY(pFunctionInfo->m_pFunctionArguments, ASTInfo::SYMBOL) + ")";
+}
@@ -0,0 +1,250 @@
+#include "EscapeAnalysis.h"
+#include <assert.h>
+
+std::map<std::string, std::vector<Tree*>>	EscapeAnalysis::m_MapFunctions;
+std::set<std::string>						EscapeAnalysis::m_SetMemberFunctions;
+std::set<std::string>						EscapeAnalysis::m_SetVisiting;
+
+void EscapeAnalysis::scanFunctions(Tree* pRootNode)
+{
+	m_MapFunctions.clear();
+	m_SetMemberFunctions.clear();
+	m_SetVisiting.clear();
+
+	if (pRootNode == nullptr)
+		return;
+
+	for (Tree* pNode : pRootNode->m_vStatements)
+	{
+		switch (pNode->m_eASTNodeType)
+		{
+			case ASTNodeType::ASTNode_FUNCTIONDEF:
+			{
+				m_MapFunctions[GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT)].push_back(pNode);
+			}
+			break;
+			case ASTNodeType::ASTNode_STRUCTDEF:
+			case ASTNodeType::ASTNode_INTERFACEDEF:
+			{
+				for (Tree* pChild : pNode->m_vStatements)
+				{
+					if (pChild->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONDEF)
+						m_SetMemberFunctions.insert(GET_INFO_FOR_KEY(pChild, ASTInfo::TEXT));
+				}
+			}
+			break;
+		}
+	}
+}
+
+int32_t EscapeAnalysis::allocateStackObjects(FunctionInfo* pFunctionInfo, int32_t iFirstLocal, int32_t iMaxSlots, const std::map<std::string, StructInfo*>& mapGlobalStructs)
+{
+	//////////////////////////////////////////////////////////////////////
+	// 1. Every object LOCAL, in the order it is declared, which is made
+	//    once & never escapes.
+	// 2. Its memory takes sizeOf(STRUCT) / 4 LOCALs, while they fit.
+	// 3. The last of them is the lowest address, the members go up from
+	//    there as they do on the HEAP.
+	//////////////////////////////////////////////////////////////////////
+	pFunctionInfo->m_MapStackObjects.clear();
+
+	int32_t iSlots = 0;
+	for (Tree* pLocalVar : pFunctionInfo->m_vLocalVariables)
+	{
+		// 1.
+		if (pLocalVar->m_eASTNodeType != ASTNodeType::ASTNode_TYPESTRUCT || pLocalVar->m_eScope != E_VARIABLESCOPE::LOCAL)
+			continue;
+
+		std::map<std::string, StructInfo*>::const_iterator itrStruct = mapGlobalStructs.find(GET_INFO_FOR_KEY(pLocalVar, ASTInfo::TYPE));
+		if (itrStruct == mapGlobalStructs.end() || itrStruct->second == nullptr)
+			continue;
+
+		// 'pStatic = new T()' is read as a LOCAL of the static's name.
+		std::string sVariableName = GET_INFO_FOR_KEY(pLocalVar, ASTInfo::TEXT);
+		if (FunctionInfo::findStaticVariable(StringInterner::intern(sVariableName)) >= 0)
+			continue;
+
+		int32_t iDefinitions = 0;
+		if (escapes(pFunctionInfo->m_pNode, sVariableName, false, iDefinitions) || iDefinitions != 1)
+			continue;
+
+		// 2.
+		int32_t iObjectSlots = (itrStruct->second->sizeOf() + sizeof(int32_t) - 1) / sizeof(int32_t);
+		if (iObjectSlots <= 0 || iSlots + iObjectSlots > iMaxSlots)
+			continue;
+
+		// 3.
+		iSlots += iObjectSlots;
+		pFunctionInfo->m_MapStackObjects[pLocalVar] = iFirstLocal + iSlots - 1;
+	}
+
+	return iSlots;
+}
+
+bool EscapeAnalysis::escapes(Tree* pNode, const std::string& sVariableName, bool bIsArgument, int32_t& iDefinitions)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Walks pNode for any use of sVariableName the rules in the header do
+	// not allow. A function()'s own return type & ARGUMENTs are skipped.
+	//////////////////////////////////////////////////////////////////////
+	if (pNode == nullptr)
+		return false;
+
+	if (GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) == sVariableName)
+	{
+		switch (pNode->m_eASTNodeType)
+		{
+			case ASTNodeType::ASTNode_TYPESTRUCT:
+				iDefinitions++;
+			break;
+			case ASTNodeType::ASTNode_ASSIGN:
+			case ASTNodeType::ASTNode_MEMBERACCESS:
+			case ASTNodeType::ASTNode_MEMBERACCESSDEREF:
+			{
+				// 'p->member = ...' assigns the member, not p.
+				if (GET_INFO_FOR_KEY(pNode, ASTInfo::ACCESSTYPE) != "object")
+					return true;
+			}
+			break;
+			case ASTNodeType::ASTNode_FREE:
+			{
+				if (bIsArgument)
+					return true;
+			}
+			break;
+			default:
+				return true;
+		}
+	}
+
+	// 'memset(p, ...)' & alike.
+	if (GET_INFO_FOR_KEY(pNode, ASTInfo::SRC) == sVariableName || GET_INFO_FOR_KEY(pNode, ASTInfo::DST) == sVariableName)
+		return true;
+
+	if (pNode->m_eASTNodeType == ASTNodeType::ASTNode_EXPRESSION)
+	{
+		ExprNode* pExpression = pNode->m_pExpression;
+		Tree* pParentNode = pNode->m_pParentNode;
+		if (pExpression != nullptr
+			&&
+			pExpression->m_eExprNodeType == ExprNodeType_::Type::EXPR_VARIABLE
+			&&
+			pExpression->m_sText == sVariableName
+			&&
+			pParentNode != nullptr && pParentNode->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONCALL
+		) {
+			if (escapesAsArgument(pParentNode, pNode))
+				return true;
+		}
+		else
+		if (escapesInExpression(pExpression, sVariableName, bIsArgument, iDefinitions))
+			return true;
+	}
+
+	for (Tree* pChild : pNode->m_vStatements)
+	{
+		if (escapes(pChild, sVariableName, bIsArgument, iDefinitions))
+			return true;
+	}
+
+	if (pNode->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONDEF)
+		return false;
+
+	return escapes(pNode->m_pLeftNode, sVariableName, bIsArgument, iDefinitions)
+			||
+			escapes(pNode->m_pRightNode, sVariableName, bIsArgument, iDefinitions);
+}
+
+bool EscapeAnalysis::escapesInExpression(ExprNode* pExprNode, const std::string& sVariableName, bool bIsArgument, int32_t& iDefinitions)
+{
+	if (pExprNode == nullptr)
+		return false;
+
+	switch (pExprNode->m_eExprNodeType)
+	{
+		case ExprNodeType_::Type::EXPR_VARIABLE:
+		{
+			if (pExprNode->m_sText == sVariableName)
+				return true;
+
+			// A call hoisted out of '&&' or '||' may only be found here.
+			if (pExprNode->m_pCallNode != nullptr && escapes(pExprNode->m_pCallNode, sVariableName, bIsArgument, iDefinitions))
+				return true;
+		}
+		break;
+		case ExprNodeType_::Type::EXPR_DEREF:
+		{
+			if (pExprNode->m_sText == sVariableName)
+				return true;
+		}
+		break;
+	}
+
+	// 'p->member' reads the member, not p.
+	return escapesInExpression(pExprNode->m_pLeft, sVariableName, bIsArgument, iDefinitions)
+			||
+			escapesInExpression(pExprNode->m_pRight, sVariableName, bIsArgument, iDefinitions);
+}
+
+bool EscapeAnalysis::escapesAsArgument(Tree* pFunctionCallNode, Tree* pArgNode)
+{
+	//////////////////////////////////////////////////////////////////////
+	// 1. Only a global function(), a member one may be 'virtual' or share
+	//    its name with the global one the call lands on.
+	// 2. The ARGUMENT pArgNode lands in must stay in every definition the
+	//    call may pick. A recursive call takes it to stay till shown not to.
+	//////////////////////////////////////////////////////////////////////
+	std::string sFunctionName = GET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::TEXT);
+
+	// 1.
+	if (NOT GET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::MEMBERFUNCTIONOF).empty() || m_SetMemberFunctions.count(sFunctionName) > 0)
+		return true;
+
+	Tree* pParentNode = pFunctionCallNode->m_pParentNode;
+	if (pParentNode != nullptr && pParentNode->m_eASTNodeType == ASTNodeType::ASTNode_MEMBERACCESS)
+		return true;
+
+	std::map<std::string, std::vector<Tree*>>::const_iterator itrFunctions = m_MapFunctions.find(sFunctionName);
+	if (itrFunctions == m_MapFunctions.end())
+		return true;
+
+	int32_t iArgument = -1, iArgCount = 0;
+	for (Tree* pChild : pFunctionCallNode->m_vStatements)
+	{
+		if (pChild->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONCALLEND)
+			continue;
+
+		if (pChild == pArgNode)
+			iArgument = iArgCount;
+		iArgCount++;
+	}
+
+	assert(iArgument >= 0);
+	if (iArgument < 0)
+		return true;
+
+	// 2.
+	bool bFound = false;
+	for (Tree* pFunctionNode : itrFunctions->second)
+	{
+		Tree* pArgListNode = pFunctionNode->m_pRightNode;
+		if (pArgListNode == nullptr || pArgListNode->m_vStatements.size() != iArgCount)
+			continue;
+
+		bFound = true;
+		std::string sArgumentName = GET_INFO_FOR_KEY(pArgListNode->m_vStatements[iArgument], ASTInfo::TEXT);
+		std::string sKey = sFunctionName + "(" + sArgumentName + ")";
+		if (m_SetVisiting.count(sKey) > 0)
+			continue;
+
+		m_SetVisiting.insert(sKey);
+		int32_t iDefinitions = 0;
+		bool bEscapes = escapes(pFunctionNode, sArgumentName, true, iDefinitions);
+		m_SetVisiting.erase(sKey);
+
+		if (bEscapes)
+			return true;
+	}
+
+	return NOT bFound;
+}
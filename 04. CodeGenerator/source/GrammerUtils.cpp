@@ -2,19 +2,26 @@
 #include "ByteArrayOutputStream.h"
 #include "ByteArrayInputStream.h"
 #include <assert.h>
+#include <algorithm>
+#include <set>
 #include "TinyCReader.h"
+#include "KeywordTable.h"
+#include "ConstantFolder.h"
+#include "Inliner.h"
+#include "Devirtualizer.h"
+#include "EscapeAnalysis.h"
+#include "PeepholeOptimizer.h"
 #include <windows.h>
 
 Token									GrammerUtils::m_pToken(TokenType_::Type::TK_UNKNOWN, "", -1, -1);
 Token									GrammerUtils::m_pPrevToken(TokenType_::Type::TK_UNKNOWN, "", -1, -1);
 Token									GrammerUtils::m_pSavedToken(TokenType_::Type::TK_UNKNOWN, "", -1, -1);
 
-std::vector<std::string>				GrammerUtils::m_vKeywords;
-std::vector<std::string>				GrammerUtils::m_vTypes;
-std::vector<std::string>				GrammerUtils::m_vUserDefinedTypes;
-std::vector<std::string>				GrammerUtils::m_vUserDefinedInterfaces;
-std::vector<std::string>				GrammerUtils::m_vUserDefinedFunctions;
-std::vector<std::string>				GrammerUtils::m_vUserDefinedVariables;
+std::vector<std::string>				GrammerUtils::m_vIntrinsics;
+std::unordered_set<int32_t>				GrammerUtils::m_SetUserDefinedTypes;
+std::unordered_set<int32_t>				GrammerUtils::m_SetUserDefinedInterfaces;
+std::unordered_set<int32_t>				GrammerUtils::m_SetUserDefinedFunctions;
+std::unordered_set<int32_t>				GrammerUtils::m_SetUserDefinedVariables;
 
 StringTokenizer*						GrammerUtils::m_pStrTok = NULL;
 int										GrammerUtils::iTabCount = 0;
@@ -29,8 +36,14 @@ StructInfo*								GrammerUtils::m_pCurrentStruct;
 InterfaceInfo*							GrammerUtils::m_pCurrentInterface;
 ByteArrayOutputStream*					GrammerUtils::m_pBAOS;
 ByteArrayInputStream*					GrammerUtils::m_pBAIS;
+std::vector<uint32_t>					GrammerUtils::m_vCodeAddressHoles;
+std::vector<TailCallSite>				GrammerUtils::m_vTailCallSites;
 
 std::vector<Tree*>						FunctionInfo::m_vStaticVariables;
+std::vector<Tree*>						FunctionInfo::m_vHostVariables;
+std::unordered_map<int32_t, int32_t>	FunctionInfo::m_MapStaticVariableIndex;
+std::unordered_map<int32_t, int32_t>	FunctionInfo::m_MapHostVariableIndex;
+
 HANDLE									GrammerUtils::m_HColor;
 
 #define VERBOSE		1
@@ -55,6 +68,7 @@ HANDLE									GrammerUtils::m_HColor;
 
 #define GET_VARIABLE_POSITION(__VAR__NAME__)			m_pCurrentFunction->getLocalVariablePosition(__VAR__NAME__)
 #define IS_VARIABLE_POINTER_TYPE(__VAR_NAME__)			m_pCurrentFunction->IsLocalVariableAPointerType(__VAR_NAME__)
+#define IS_VARIABLE_HOSTDATA(__VAR_NAME__)				m_pCurrentFunction->IsLocalVariableAHostData(__VAR_NAME__)
 #define GET_VARIABLE_NODETYPE(__VAR_NAME__)				m_pCurrentFunction->getLocalVariableNodeType(__VAR_NAME__)
 
 #define IS_STATEMENT_INSIDE_FUNCTION					if(m_pCurrentFunction != nullptr)
@@ -131,9 +145,52 @@ CodeMap opCodeMap[] =
 	{ "PRTF",		OPCODE::PRTF,		1,  PRIMIIVETYPE::INT_8 },
 	{ "CAST",		OPCODE::CAST,		3,  PRIMIIVETYPE::INT_8 },
 
+	{ "SINF",		OPCODE::SINF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "COSF",		OPCODE::COSF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "SQRTF",		OPCODE::SQRTF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "ABSF",		OPCODE::ABSF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "MINF",		OPCODE::MINF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "MAXF",		OPCODE::MAXF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "FLOORF",		OPCODE::FLOORF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "LERPF",		OPCODE::LERPF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "RANDF",		OPCODE::RANDF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "SRAND",		OPCODE::SRAND,		1,  PRIMIIVETYPE::INT_8 },
+	{ "AWAIT",		OPCODE::AWAIT,		1,  PRIMIIVETYPE::INT_8 },
+	{ "JMPTABLE",	OPCODE::JMPTABLE,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LT",		OPCODE::BR_LT,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LTEQ",	OPCODE::BR_LTEQ,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GT",		OPCODE::BR_GT,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GTEQ",	OPCODE::BR_GTEQ,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_EQ",		OPCODE::BR_EQ,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_NEQ",		OPCODE::BR_NEQ,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LTF",		OPCODE::BR_LTF,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LTEQF",	OPCODE::BR_LTEQF,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GTF",		OPCODE::BR_GTF,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GTEQF",	OPCODE::BR_GTEQF,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_EQF",		OPCODE::BR_EQF,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_NEQF",	OPCODE::BR_NEQF,	2,  PRIMIIVETYPE::INT_32 },
+	{ "DUP",		OPCODE::DUP,		1,  PRIMIIVETYPE::INT_8 },
+	{ "TAILCALL",	OPCODE::TAILCALL,	3,  PRIMIIVETYPE::INT_32 },
+	{ "LEA",		OPCODE::LEA,		2,  PRIMIIVETYPE::INT_32 },
+
 	{ "HLT",		OPCODE::HLT,		1,  PRIMIIVETYPE::INT_8 },
 };
 
+IntrinsicMap intrinsicMap[] =
+{
+	{ "sin",		OPCODE::SINF,		1,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "cos",		OPCODE::COSF,		1,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "sqrt",		OPCODE::SQRTF,		1,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "abs",		OPCODE::ABSF,		1,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "min",		OPCODE::MINF,		2,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "max",		OPCODE::MAXF,		2,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "floor",		OPCODE::FLOORF,		1,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "lerp",		OPCODE::LERPF,		3,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "rand",		OPCODE::RANDF,		0,	PRIMIIVETYPE::FLOAT,	"float" },
+	{ "srand",		OPCODE::SRAND,		1,	PRIMIIVETYPE::INT_32,	"void" },
+	{ "await",		OPCODE::AWAIT,		1,	PRIMIIVETYPE::INT_32,	"int32_t" },
+};
+
 RegisterMap registerMap[]
 {
 	{ "RAX", EREGISTERS::RAX },	// Accumulator
@@ -231,74 +288,32 @@ std::ostream& operator<<(std::ostream& os, color c)
 #endif
 bool GrammerUtils::isABuiltInType(const char* cStr)
 {
-	std::string sStr = cStr;
-	for (std::string sType : m_vTypes)
-	{
-		if (sType == sStr)
-			return true;
-	}
-
-	return false;
+	return (classifyKeyword(cStr, strlen(cStr)) == KeywordType_::Type::KW_BUILTINTYPE);
 }
 
 bool GrammerUtils::isAKeyword(const char* cStr)
 {
-	std::string sStr = cStr;
-	for (std::string sType : m_vKeywords)
-	{
-		if (sType == sStr)
-			return true;
-	}
-
-	return false;
+	return (classifyKeyword(cStr, strlen(cStr)) == KeywordType_::Type::KW_KEYWORD);
 }
 
 bool GrammerUtils::isAUserDefinedType(const char* cStr)
 {
-	std::string sStr = cStr;
-	for (std::string sType : m_vUserDefinedTypes)
-	{
-		if (sType == sStr)
-			return true;
-	}
-
-	return false;
+	return (m_SetUserDefinedTypes.find(StringInterner::find(cStr, (int32_t)strlen(cStr))) != m_SetUserDefinedTypes.end());
 }
 
 bool GrammerUtils::isAUserDefinedInterface(const char* cStr)
 {
-	std::string sStr = cStr;
-	for (std::string sType : m_vUserDefinedInterfaces)
-	{
-		if (sType == sStr)
-			return true;
-	}
-
-	return false;
+	return (m_SetUserDefinedInterfaces.find(StringInterner::find(cStr, (int32_t)strlen(cStr))) != m_SetUserDefinedInterfaces.end());
 }
 
 bool GrammerUtils::isAUserDefinedFunction(const char* cStr)
 {
-	std::string sStr = cStr;
-	for (std::string sType : m_vUserDefinedFunctions)
-	{
-		if (sType == sStr)
-			return true;
-	}
-
-	return false;
+	return (m_SetUserDefinedFunctions.find(StringInterner::find(cStr, (int32_t)strlen(cStr))) != m_SetUserDefinedFunctions.end());
 }
 
 bool GrammerUtils::isAUserDefinedVariable(const char* cStr)
 {
-	std::string sStr = cStr;
-	for (std::string sType : m_vUserDefinedVariables)
-	{
-		if (sType == sStr)
-			return true;
-	}
-
-	return false;
+	return (m_SetUserDefinedVariables.find(StringInterner::find(cStr, (int32_t)strlen(cStr))) != m_SetUserDefinedVariables.end());
 }
 
 void GrammerUtils::init()
@@ -313,21 +328,13 @@ bool GrammerUtils::read(const char* sFile)
 	bSuccess = pRaf->openForRead(sFile);
 	if (bSuccess)
 	{
-		unsigned long iLength = pRaf->length();
-		char* sBuff = new char[iLength + strlen("\r\n") + 1];
-		memset(sBuff, 0, iLength);
-
-		unsigned long iBytesRead = pRaf->read(sBuff);
-		if (iBytesRead > 0)
-		{
-			m_pStrTok = StringTokenizer::create(sBuff);
-			m_pStrTok->tokenize();
-		}
-
-		delete[] sBuff;
-		sBuff = nullptr;
+		// The tokenizer reads the file a chunk at a time while the parser asks for tokens, so
+		// neither the whole source nor a token list for all of it is ever held in memory.
+		// It closes the file once it reaches the end.
+		m_pStrTok = StringTokenizer::create(pRaf);
 	}
-	pRaf->close();
+	else
+		pRaf->close();
 
 	return bSuccess;
 }
@@ -354,7 +361,7 @@ bool GrammerUtils::match(TokenType_::Type eTokenType, int TYPE)
 {
 	TokenType_::Type eCurrentTokenType = m_pToken.getType();
 
-	bool bIsAMatch = (eCurrentTokenType == eTokenType && !isOneOfTheKeywords(m_pToken.getText()));
+	bool bIsAMatch = (eCurrentTokenType == eTokenType && m_pToken.m_eKeywordType != KeywordType_::Type::KW_KEYWORD);
 	if (bIsAMatch)
 	{
 		m_pPrevToken = m_pToken;
@@ -364,11 +371,9 @@ bool GrammerUtils::match(TokenType_::Type eTokenType, int TYPE)
 	return bIsAMatch;
 }
 
-bool GrammerUtils::match(std::string sText, int TYPE)
+bool GrammerUtils::match(KeywordID_::Type eKeyword, int TYPE)
 {
-	std::string sCurrentTokenText = m_pToken.getText();
-
-	bool bIsAMatch = (sCurrentTokenText == sText);
+	bool bIsAMatch = (m_pToken.m_eKeyword == eKeyword);
 	if (bIsAMatch)
 	{
 		m_pPrevToken = m_pToken;
@@ -378,24 +383,33 @@ bool GrammerUtils::match(std::string sText, int TYPE)
 	return bIsAMatch;
 }
 
-bool GrammerUtils::match(char ch, int TYPE)
+bool GrammerUtils::match(const std::string& sText, int TYPE)
 {
-	return match(std::string(1, ch), TYPE);
+	bool bIsAMatch = (m_pToken.m_sText == sText);
+	if (bIsAMatch)
+	{
+		m_pPrevToken = m_pToken;
+		getNextToken();
+	}
+
+	return bIsAMatch;
 }
 
-bool GrammerUtils::isOneOfTheKeywords(std::string sKeyword)
+bool GrammerUtils::match(char ch, int TYPE)
 {
-	bool bYes = false;
-	for (std::string sInBuiltKeyword : m_vKeywords)
+	bool bIsAMatch = (m_pToken.m_sText.length() == 1 && m_pToken.m_sText[0] == ch);
+	if (bIsAMatch)
 	{
-		if (sInBuiltKeyword == sKeyword)
-		{
-			bYes = true;
-			break;
-		}
+		m_pPrevToken = m_pToken;
+		getNextToken();
 	}
 
-	return bYes;
+	return bIsAMatch;
+}
+
+bool GrammerUtils::isOneOfTheKeywords(const std::string& sKeyword)
+{
+	return (classifyKeyword(sKeyword.c_str(), sKeyword.length()) == KeywordType_::Type::KW_KEYWORD);
 }
 
 void GrammerUtils::printTabs()
@@ -423,9 +437,9 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 	{
 		case ASTNodeType::ASTNode_INTERFACEDEF:
 		{
-			std::cout << "interface" << " " << GET_INFO_FOR_KEY(pNode, "text");
+			std::cout << "interface" << " " << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 
-			std::string sExtends = GET_INFO_FOR_KEY(pNode, "extends");
+			std::string sExtends = GET_INFO_FOR_KEY(pNode, ASTInfo::EXTENDS);
 			if (NOT sExtends.empty())
 			{
 				std::cout << " : " << sExtends;
@@ -439,10 +453,10 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_STRUCTDEF:
 		{
-			std::cout << "struct" << " " << GET_INFO_FOR_KEY(pNode, "text");
+			std::cout << "struct" << " " << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 
 			// extends "parent struct"
-			std::string sExtends = GET_INFO_FOR_KEY(pNode, "extends");
+			std::string sExtends = GET_INFO_FOR_KEY(pNode, ASTInfo::EXTENDS);
 			if (NOT sExtends.empty())
 			{
 				std::cout << " : " << sExtends;
@@ -457,7 +471,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 					std::string sInterfaceList = "";
 					for (Tree* pStringNode : pStructImplementsListNode->m_vStatements)
 					{
-						std::string sInterfaceName = GET_INFO_FOR_KEY(pStringNode, "text");
+						std::string sInterfaceName = GET_INFO_FOR_KEY(pStringNode, ASTInfo::TEXT);
 						sInterfaceList.append(sInterfaceName);
 						sInterfaceList.append(", ");
 					}
@@ -478,15 +492,15 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_MEMBERACCESS:
 		{
-			std::string sAccessType = GET_INFO_FOR_KEY(pNode, "accessType");
+			std::string sAccessType = GET_INFO_FOR_KEY(pNode, ASTInfo::ACCESSTYPE);
 			if (sAccessType == "static")
 			{
-				std::cout << GET_INFO_FOR_KEY(pNode, "text") << "::";
+				std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << "::";
 			}
 			else
 			if (sAccessType == "object")
 			{
-				std::cout << GET_INFO_FOR_KEY(pNode, "text") << "->";
+				std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << "->";
 			}
 
 			if (pNode->m_vStatements.size() > 0)
@@ -508,8 +522,15 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		case ASTNodeType::ASTNode_TYPESTATIC:
 		{
 			std::cout << "static" << " ";
-			std::string sType = GET_INFO_FOR_KEY(pNode, "type");
-			std::cout << sType << "* " << GET_INFO_FOR_KEY(pNode, "text") << ";" << std::endl;
+			std::string sType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
+			std::cout << sType << "* " << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << ";" << std::endl;
+		}
+		break;
+		case ASTNodeType::ASTNode_TYPEHOSTDATA:
+		{
+			std::cout << "HOSTDATA" << " ";
+			std::string sType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
+			std::cout << sType << " " << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << ";" << std::endl;
 		}
 		break;
 		case ASTNodeType::ASTNode_FUNCTIONDEF:
@@ -517,20 +538,20 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 			Tree* pReturnTypeNode = pNode->m_pLeftNode;
 			Tree* pArgListNode = pNode->m_pRightNode;
 
-			if (GET_INFO_FOR_KEY(pNode, "isVirtual") == "virtual")
+			if (GET_INFO_FOR_KEY(pNode, ASTInfo::ISVIRTUAL) == "virtual")
 				std::cout << "virtual" << " ";
 
-			std::cout << GET_INFO_FOR_KEY(pReturnTypeNode, "text") << " " << GET_INFO_FOR_KEY(pNode, "text") << "(";
+			std::cout << GET_INFO_FOR_KEY(pReturnTypeNode, ASTInfo::TEXT) << " " << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << "(";
 
 			// Arg List
 			for (Tree* pArgNode : pArgListNode->m_vStatements)
 			{
-				std::cout << GET_INFO_FOR_KEY(pArgNode, "type") << " " << pArgNode->m_sAdditionalInfo << ", ";
+				std::cout << GET_INFO_FOR_KEY(pArgNode, ASTInfo::TYPE) << " " << GET_INFO_FOR_KEY(pArgNode, ASTInfo::SYMBOL) << ", ";
 			}
 
 			std::cout << ")";
 
-			if (GET_INFO_FOR_KEY(pNode, "isPure") == "pure")
+			if (GET_INFO_FOR_KEY(pNode, ASTInfo::ISPURE) == "pure")
 			{
 				std::cout << " = 0;" << std::endl;
 				bProcessChildren = false;
@@ -547,9 +568,10 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_FUNCTIONCALL:
 		case ASTNodeType::ASTNode_SYSTEMFUNCTIONCALL:
+		case ASTNodeType::ASTNode_INTRINSIC:
 		{
 			std::cout	<< ((eASTNodeType == ASTNodeType::ASTNode_SYSTEMFUNCTIONCALL) ? "$_":"")
-						<< GET_INFO_FOR_KEY(pNode, "text") << "(";
+						<< GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << "(";
 
 			std::vector<Tree*>* vStatements = &pNode->m_vStatements;
 			for (Tree* pChildNode : *vStatements)
@@ -559,7 +581,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 							pChildNode->m_eASTNodeType == ASTNodeType::ASTNode_SYSTEMFUNCTIONCALLEND
 						)
 				)
-					std::cout << GET_INFO_FOR_KEY(pChildNode, "text") << ", ";
+					std::cout << getExpressionText(pChildNode) << ", ";
 			}
 			std::cout << ");" << std::endl;
 
@@ -568,10 +590,10 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_TYPE:
 		{
-			std::cout << GET_INFO_FOR_KEY(pNode, "type");
+			std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
 			std::cout << (pNode->m_bIsPointerType ? "*" : "");
 			std::cout << " ";
-			std::cout << GET_INFO_FOR_KEY(pNode, "text");
+			std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 			std::cout << " = ";
 
 			Tree* pExpressionNode = pNode->m_pLeftNode;
@@ -584,12 +606,12 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 						if (pChild->m_eASTNodeType == ASTNodeType::ASTNode_MEMBERACCESS)
 							printAST(pChild, false);
 						else
-							std::cout << GET_INFO_FOR_KEY(pChild, "text") << " ";
+							std::cout << getExpressionText(pChild) << " ";
 					}
 				}
 				else
 					if (pExpressionNode != nullptr)
-						std::cout << GET_INFO_FOR_KEY(pExpressionNode, "text");
+						std::cout << getExpressionText(pExpressionNode);
 			}
 		}
 		break;
@@ -598,10 +620,10 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 			Tree* pArraySizeLeaf = pNode->m_pLeftNode;
 			Tree* pArrayElementsLeaf = pNode->m_pRightNode;
 
-			std::cout << GET_INFO_FOR_KEY(pNode, "type") << " " << pNode->m_sAdditionalInfo << "[";
+			std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE) << " " << GET_INFO_FOR_KEY(pNode, ASTInfo::SYMBOL) << "[";
 			if (pArraySizeLeaf != nullptr)
 			{
-				std::cout << GET_INFO_FOR_KEY(pArraySizeLeaf, "text");
+				std::cout << GET_INFO_FOR_KEY(pArraySizeLeaf, ASTInfo::TEXT);
 			}
 
 			std::cout << "]";
@@ -613,7 +635,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 
 				for (Tree* pArrayElement : pArrayElementsLeaf->m_vStatements)
 				{
-					std::cout << " " << GET_INFO_FOR_KEY(pArrayElement, "text") << ",";
+					std::cout << " " << getExpressionText(pArrayElement) << ",";
 				}
 
 				std::cout << "}";
@@ -624,14 +646,14 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_TYPESTRUCT:
 		{
-			std::string sStructType = GET_INFO_FOR_KEY(pNode, "type");
-			std::cout << sStructType << "* " << GET_INFO_FOR_KEY(pNode, "text") << " = new " << sStructType << "(";
+			std::string sStructType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
+			std::cout << sStructType << "* " << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << " = new " << sStructType << "(";
 
 			Tree* pConstructorCallNode = pNode->m_vStatements[0];
 			for (Tree* pChild : pConstructorCallNode->m_vStatements)
 			{
 				if(pChild->m_eASTNodeType != ASTNodeType::ASTNode_CONSTRUCTORCALLEND)
-					std::cout << GET_INFO_FOR_KEY(pChild, "text") << ",";
+					std::cout << getExpressionText(pChild) << ",";
 			}
 
 			std::cout << ")";
@@ -645,7 +667,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 			std::cout << "malloc" << "(";
 
 			Tree* pExpressionNode = pNode->m_pLeftNode;
-			std::cout << GET_INFO_FOR_KEY(pExpressionNode, "text");
+			std::cout << getExpressionText(pExpressionNode);
 
 			std::cout << ");" << std::endl;
 		}
@@ -653,13 +675,13 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		case ASTNodeType::ASTNode_PREDECR:
 		case ASTNodeType::ASTNode_PREINCR:
 		{
-			std::cout << ((eASTNodeType == ASTNodeType::ASTNode_PREDECR) ? "--" : "++") << GET_INFO_FOR_KEY(pNode, "text") << ";" << std::endl;
+			std::cout << ((eASTNodeType == ASTNodeType::ASTNode_PREDECR) ? "--" : "++") << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << ";" << std::endl;
 		}
 		break;
 		case ASTNodeType::ASTNode_POSTDECR:
 		case ASTNodeType::ASTNode_POSTINCR:
 		{
-			std::cout << GET_INFO_FOR_KEY(pNode, "text") << ((eASTNodeType == ASTNodeType::ASTNode_POSTDECR) ? "--" : "++") << ";" << std::endl;
+			std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << ((eASTNodeType == ASTNodeType::ASTNode_POSTDECR) ? "--" : "++") << ";" << std::endl;
 		}
 		break;
 		case ASTNodeType::ASTNode_ASSIGN:
@@ -682,27 +704,27 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 			{
 				case ASTNodeType::ASTNode_IDENTIFIER:
 				{
-					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, "text");
+					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::TEXT);
 				}
 				break;
 				case ASTNodeType::ASTNode_DEREF:
 				case ASTNodeType::ASTNode_DEREFARRAY:
 				{
 					std::cout << "@";
-					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, "text");
+					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::TEXT);
 				}
 				break;
 				case ASTNodeType::ASTNode_MEMBERACCESS:
 				{
-					std::cout << GET_INFO_FOR_KEY(pNode, "text");
+					std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 					std::cout << "->";
-					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, "text");
+					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::TEXT);
 
 					bPrintExpressionChilds = false;
 				}
 				break;
 				default:
-					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, "text");
+					std::cout << GET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::TEXT);
 				break;
 			}
 
@@ -715,7 +737,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 				}
 			}
 			else
-				std::cout << " = " << GET_INFO_FOR_KEY(pExpressionNode, "text") << ";" << std::endl;
+				std::cout << " = " << getExpressionText(pExpressionNode) << ";" << std::endl;
 
 			// PostFix
 			if (pExpressionNode->m_pRightNode != nullptr)
@@ -733,7 +755,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_IF:
 		{
-			std::cout << "if" << "(" << GET_INFO_FOR_KEY(pLeftNode, "text") << ")" << std::endl;
+			std::cout << "if" << "(" << getExpressionText(pLeftNode) << ")" << std::endl;
 			printTabs();
 			std::cout << "{" << std::endl;
 
@@ -762,7 +784,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 				}
 			}
 
-			std::cout << "while" << "(" << GET_INFO_FOR_KEY(pLeftNode, "text") << ")" << std::endl;
+			std::cout << "while" << "(" << getExpressionText(pLeftNode) << ")" << std::endl;
 			printTabs();
 			std::cout << "{" << std::endl;
 
@@ -771,7 +793,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_SWITCH:
 		{
-			std::cout << "switch" << "(" << GET_INFO_FOR_KEY(pNode->m_pLeftNode, "text") << ")" << std::endl;
+			std::cout << "switch" << "(" << getExpressionText(pNode->m_pLeftNode) << ")" << std::endl;
 			printTabs();
 			std::cout << "{" << std::endl;
 
@@ -780,7 +802,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_SWITCHCASE:
 		{
-			std::cout << "case" << " " << GET_INFO_FOR_KEY(pNode, "text") << ":" << std::endl;
+			std::cout << "case" << " " << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << ":" << std::endl;
 			iTabCount++;
 		}
 		break;
@@ -806,7 +828,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 				if (bIsString)
 					std::cout << "\"";
 
-				std::cout << GET_INFO_FOR_KEY(pChildNode, "text");
+				std::cout << getExpressionText(pChildNode);
 
 				if (bIsString)
 					std::cout << "\"";
@@ -824,7 +846,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 			std::vector<Tree*>* vStatements = &pNode->m_vStatements;
 			for (Tree* pChildNode : *vStatements)
 			{
-				std::cout << GET_INFO_FOR_KEY(pChildNode, "text");
+				std::cout << getExpressionText(pChildNode);
 			}
 			std::cout << ");" << std::endl;
 
@@ -833,13 +855,13 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_STRING:
 		{
-			std::cout << GET_INFO_FOR_KEY(pNode, "text") << " ";
+			std::cout << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << " ";
 			bProcessChildren = false;
 		}
 		break;
 		case ASTNodeType::ASTNode_EXPRESSION:
 		{
-			std::cout << GET_INFO_FOR_KEY(pNode, "text") << " ";
+			std::cout << getExpressionText(pNode) << " ";
 			bProcessChildren = false;
 		}
 		break;
@@ -850,7 +872,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 			std::vector<Tree*>* vStatements = &pNode->m_vStatements;
 			for (Tree* pChildNode : *vStatements)
 			{
-				std::cout << GET_INFO_FOR_KEY(pChildNode, "text") << ", ";
+				std::cout << getExpressionText(pChildNode) << ", ";
 			}
 			std::cout << ";" << std::endl;
 
@@ -859,7 +881,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_FREE:
 		{
-			std::cout << "free" << "(" << GET_INFO_FOR_KEY(pNode, "text") << ")";
+			std::cout << "free" << "(" << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) << ")";
 			std::cout << ";" << std::endl;
 
 			bProcessChildren = false;
@@ -867,15 +889,15 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_MEMSET:
 		{
-			std::cout << "memSet" << "(" << GET_INFO_FOR_KEY(pNode, "text");
+			std::cout << "memSet" << "(" << GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 
 			Tree* pValueExpressionLeaf = pNode->m_pLeftNode;
 			Tree* pSizeExpressionLeaf = pNode->m_pRightNode;
 
 			assert(pValueExpressionLeaf != nullptr);
 			assert(pSizeExpressionLeaf != nullptr);
-			std::cout << GET_INFO_FOR_KEY(pValueExpressionLeaf, "text") << ", ";
-			std::cout << GET_INFO_FOR_KEY(pSizeExpressionLeaf, "text");
+			std::cout << getExpressionText(pValueExpressionLeaf) << ", ";
+			std::cout << getExpressionText(pSizeExpressionLeaf);
 
 			std::cout << ");" << std::endl;
 
@@ -884,11 +906,11 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_MEMCPY:
 		{
-			std::cout << "memCpy" << "(" << GET_INFO_FOR_KEY(pNode, "src") << ", " << GET_INFO_FOR_KEY(pNode, "dst") << ", ";
+			std::cout << "memCpy" << "(" << GET_INFO_FOR_KEY(pNode, ASTInfo::SRC) << ", " << GET_INFO_FOR_KEY(pNode, ASTInfo::DST) << ", ";
 
 			Tree* pSizeExpressionLeaf = pNode->m_pRightNode;
 			assert(pSizeExpressionLeaf != nullptr);
-			std::cout << GET_INFO_FOR_KEY(pSizeExpressionLeaf, "text");
+			std::cout << getExpressionText(pSizeExpressionLeaf);
 
 			std::cout << ");" << std::endl;
 
@@ -897,11 +919,11 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_MEMCMP:
 		{
-			std::cout << "memCmp" << "(" << GET_INFO_FOR_KEY(pNode, "src") << ", " << GET_INFO_FOR_KEY(pNode, "dst") << ", ";
+			std::cout << "memCmp" << "(" << GET_INFO_FOR_KEY(pNode, ASTInfo::SRC) << ", " << GET_INFO_FOR_KEY(pNode, ASTInfo::DST) << ", ";
 
 			Tree* pSizeExpressionLeaf = pNode->m_pRightNode;
 			assert(pSizeExpressionLeaf != nullptr);
-			std::cout << GET_INFO_FOR_KEY(pSizeExpressionLeaf, "text");
+			std::cout << getExpressionText(pSizeExpressionLeaf);
 
 			std::cout << ");" << std::endl;
 
@@ -910,7 +932,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 		break;
 		case ASTNodeType::ASTNode_MEMCHR:
 		{
-			std::cout << "memChr" << "(" << GET_INFO_FOR_KEY(pNode, "src") << ", ";
+			std::cout << "memChr" << "(" << GET_INFO_FOR_KEY(pNode, ASTInfo::SRC) << ", ";
 
 			Tree* pValueExpressionLeaf = pNode->m_pLeftNode;
 			assert(pValueExpressionLeaf != nullptr);
@@ -918,7 +940,7 @@ void GrammerUtils::printAST(Tree* pNode, bool bPrintTabs/* = true*/)
 			Tree* pSizeExpressionLeaf = pNode->m_pRightNode;
 			assert(pSizeExpressionLeaf != nullptr);
 
-			std::cout << GET_INFO_FOR_KEY(pValueExpressionLeaf, "text") << ", " << GET_INFO_FOR_KEY(pSizeExpressionLeaf, "text");
+			std::cout << getExpressionText(pValueExpressionLeaf) << ", " << getExpressionText(pSizeExpressionLeaf);
 
 			std::cout << ");" << std::endl;
 
@@ -1044,6 +1066,9 @@ void GrammerUtils::generateCode(Tree* pRootNode)
 	populateStrings(pRootNode, m_vStrings);
 	int iStrings = m_vStrings.size();
 
+	Devirtualizer::scanHierarchy(pRootNode);
+	EscapeAnalysis::scanFunctions(pRootNode);
+
 	int iOffset = 0;
 	{
 		//////////////////////////////////////////////////////////////////////////////
@@ -1054,6 +1079,7 @@ void GrammerUtils::generateCode(Tree* pRootNode)
 			// RET
 			EMIT_BYTE(OPCODE::PUSHI);
 			iMainRetAddressHole = CURRENT_OFFSET;
+			m_vCodeAddressHoles.push_back(iMainRetAddressHole);
 			EMIT_INT(0);
 
 			// EBP
@@ -1099,10 +1125,64 @@ void GrammerUtils::generateCode(Tree* pRootNode)
 		}
 		//////////////////////////////////////////////////////////////////////////////
 
+		//////////////////////////////////////////////////////////////////////////////
+		optimizeCode();
+		//////////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////////
+		// Exported function() names, the host looks them up by name.
+		std::map<std::string, FunctionInfo*>::const_iterator itrFunc = m_MapGlobalFunctions.begin();
+		for (; itrFunc != m_MapGlobalFunctions.end(); ++itrFunc)
+		{
+			addString(itrFunc->second->m_sFunctionName, m_vStrings);
+		}
+		//////////////////////////////////////////////////////////////////////////////
+
 		printAssembly(m_iByteCode, m_vStrings);
 	}
 }
 
+void GrammerUtils::optimizeCode()
+{
+	//////////////////////////////////////////////////////////////////////////////
+	// The finished code goes through each stage in turn, every function() start &
+	// VTABLE offset is relocated along with the code.
+	// 1. Decode it into instructions, see PeepholeOptimizer.h.
+	// 2. Dataflow passes over each function(), then peephole passes over the
+	//    whole code.
+	// 3. Encode the live instructions back.
+	std::vector<int32_t*> vCodeOffsets;
+
+	std::map<std::string, FunctionInfo*>::const_iterator itrFunc = m_MapGlobalFunctions.begin();
+	for (; itrFunc != m_MapGlobalFunctions.end(); ++itrFunc)
+	{
+		vCodeOffsets.push_back(&itrFunc->second->m_iStartOffsetInCode);
+	}
+
+	std::map<std::string, StructInfo*>::const_iterator itrStruct = m_MapGlobalStructs.begin();
+	for (; itrStruct != m_MapGlobalStructs.end(); ++itrStruct)
+	{
+		StructInfo* pStructInfo = itrStruct->second;
+		for (void* vpFunctionInfo : pStructInfo->m_vMemberFunctions)
+		{
+			vCodeOffsets.push_back(&((FunctionInfo*)vpFunctionInfo)->m_iStartOffsetInCode);
+		}
+
+		if (pStructInfo->m_bHasVTable)
+			vCodeOffsets.push_back(&pStructInfo->m_iVTableOffset);
+	}
+
+	// 1.
+	PeepholeOptimizer::decode(m_iByteCode, CURRENT_OFFSET, m_vCodeAddressHoles, vCodeOffsets, m_vTailCallSites);
+
+	// 2.
+	PeepholeOptimizer::optimize();
+
+	// 3.
+	int32_t iCodeSize = PeepholeOptimizer::encode(m_iByteCode, CURRENT_OFFSET, vCodeOffsets);
+	m_pBAOS->setCurrentOffset(iCodeSize);
+}
+
 void GrammerUtils::populateStrings(Tree* pParentNode, std::vector<std::string>& sVector)
 {
 	if (pParentNode != nullptr)
@@ -1123,14 +1203,15 @@ void GrammerUtils::populateStrings(Tree* pParentNode, std::vector<std::string>&
 				}
 				break;
 				case ASTNodeType::ASTNode_SYSTEMFUNCTIONCALL:
+				case ASTNodeType::ASTNode_TYPEHOSTDATA:
 				{
-					addString(GET_INFO_FOR_KEY(pNode, "text"), sVector);
+					addString(GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT), sVector);
 				}
 				break;
 				case ASTNodeType::ASTNode_STRING:
 				case ASTNodeType::ASTNode_CHARACTER:
 				{
-					addString(GET_INFO_FOR_KEY(pNode, "text"), sVector);
+					addString(GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT), sVector);
 				}
 				break;
 				case ASTNodeType::ASTNode_IF:
@@ -1165,7 +1246,7 @@ void GrammerUtils::populateStrings(Tree* pParentNode, std::vector<std::string>&
 	}
 }
 
-void GrammerUtils::addString(std::string& sText, std::vector<std::string>& vVector)
+void GrammerUtils::addString(const std::string& sText, std::vector<std::string>& vVector)
 {
 	if (vVector.size() > 0)
 	{
@@ -1224,6 +1305,11 @@ void GrammerUtils::populateCode(Tree* pNode)
 				handleStatics(pNode);
 			}
 			break;
+			case ASTNodeType::ASTNode_TYPEHOSTDATA:
+			{
+				handleHostData(pNode);
+			}
+			break;
 			case ASTNodeType::ASTNode_TYPESTRUCT:
 			{
 				handleTypeStructs(pNode);
@@ -1255,6 +1341,12 @@ void GrammerUtils::populateCode(Tree* pNode)
 				handleSystemFunctionCall(pNode);
 			}
 			break;
+			case ASTNodeType::ASTNode_INTRINSIC:
+			{
+				handleIntrinsic(pNode);
+				bProcessStatements = false;					// Since we are processing the arguments in "handleIntrinsic()"
+			}
+			break;
 			case ASTNodeType::ASTNode_MEMBERACCESS:
 			{
 				handleStructMemberAccess(pNode);
@@ -1308,7 +1400,7 @@ void GrammerUtils::populateCode(Tree* pNode)
 			{
 				IS_STATEMENT_INSIDE_FUNCTION
 				{
-					if (NOT pNode->m_bIsPointerType)
+					if (NOT pNode->m_bIsPointerType && NOT pNode->m_bIsConditionalCall)	// A conditional call is emitted by emitExpression().
 						handlePrimitiveInt(pNode);
 				}
 			}
@@ -1476,6 +1568,7 @@ void GrammerUtils::emit(OPCODE eOPCODE, int iOperand)
 		case OPCODE::FREE:
 		case OPCODE::STA:
 		case OPCODE::LDA:
+		case OPCODE::LEA:
 		{
 #if (VERBOSE == 1)
 			std::cout << CURRENT_OFFSET << ". " << opCodeMap[(int)eOPCODE].sOpCode << " ";
@@ -1553,6 +1646,17 @@ void GrammerUtils::emit(OPCODE eOPCODE, int iOperand)
 		case OPCODE::MEMCMP:
 		case OPCODE::MEMCHR:
 		case OPCODE::RET:
+		case OPCODE::SINF:
+		case OPCODE::COSF:
+		case OPCODE::SQRTF:
+		case OPCODE::ABSF:
+		case OPCODE::MINF:
+		case OPCODE::MAXF:
+		case OPCODE::FLOORF:
+		case OPCODE::LERPF:
+		case OPCODE::RANDF:
+		case OPCODE::SRAND:
+		case OPCODE::AWAIT:
 		{
 #if (VERBOSE == 1)
 			std::cout << CURRENT_OFFSET << ". " << opCodeMap[(int)eOPCODE].sOpCode << std::endl;
@@ -1586,7 +1690,7 @@ void GrammerUtils::handleInterfaceDef(Tree* pNode)
 	if (m_pCurrentInterface != nullptr)
 	{
 		// Save in Global Map
-		std::string sInterfaceName = GET_INFO_FOR_KEY(pNode, "text");
+		std::string sInterfaceName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 		m_MapGlobalInterfaces[sInterfaceName] = m_pCurrentInterface;
 
 		m_pCurrentInterface->updateInterfaceList(m_MapGlobalInterfaces);
@@ -1604,7 +1708,7 @@ void GrammerUtils::handleStructDef(Tree* pNode)
 	if (m_pCurrentStruct != nullptr)
 	{
 		// Save in Global Map
-		std::string sStructName = GET_INFO_FOR_KEY(pNode, "text");
+		std::string sStructName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 		m_MapGlobalStructs[sStructName] = m_pCurrentStruct;
 
 		m_pCurrentStruct->updateParent(m_MapGlobalStructs);
@@ -1674,12 +1778,12 @@ void GrammerUtils::addVirtualFunctionsFromParentStruct(StructInfo* pCurrentStruc
 			FunctionInfo* pCURRENTSTRUCT_FunctionInfo = (FunctionInfo*)pCurrentStruct->m_vMemberFunctions.at(i);
 			if (pCURRENTSTRUCT_FunctionInfo != nullptr)
 			{
-				std::string sVirtual = GET_INFO_FOR_KEY(pCURRENTSTRUCT_FunctionInfo->m_pNode, "isVirtual");
+				std::string sVirtual = GET_INFO_FOR_KEY(pCURRENTSTRUCT_FunctionInfo->m_pNode, ASTInfo::ISVIRTUAL);
 				if (sVirtual == "virtual")
 				{
 					Tree* pCURRENTSTRUCT_FUNC_ArgListNode = pCURRENTSTRUCT_FunctionInfo->m_pFunctionArguments;
 					int pCURRENTSTRUCT_FUNC_ArgCount = pCURRENTSTRUCT_FUNC_ArgListNode->m_vStatements.size();
-					std::string pCURRENTSTRUCT_FUNC_Signature = pCURRENTSTRUCT_FUNC_ArgListNode->m_sAdditionalInfo;
+					std::string pCURRENTSTRUCT_FUNC_Signature = GET_INFO_FOR_KEY(pCURRENTSTRUCT_FUNC_ArgListNode, ASTInfo::SYMBOL);
 
 					bool bFound = false;
 					for (int32_t j = 0; j < vVirtualFunctions.size(); j++)
@@ -1687,7 +1791,7 @@ void GrammerUtils::addVirtualFunctionsFromParentStruct(StructInfo* pCurrentStruc
 						FunctionInfo* pADDEDFunctionInfo = (FunctionInfo*)vVirtualFunctions.at(j);
 						Tree* pADDEDFUNC_ArgListNode = pADDEDFunctionInfo->m_pFunctionArguments;
 						int iADDEDFUNC_ArgCount = pADDEDFUNC_ArgListNode->m_vStatements.size();
-						std::string sADDEDFUNC_Signature = pADDEDFUNC_ArgListNode->m_sAdditionalInfo;
+						std::string sADDEDFUNC_Signature = GET_INFO_FOR_KEY(pADDEDFUNC_ArgListNode, ASTInfo::SYMBOL);
 
 						bFound = (	pCURRENTSTRUCT_FunctionInfo->m_sFunctionName == pADDEDFunctionInfo->m_sFunctionName
 									&&
@@ -1746,19 +1850,19 @@ Tree* GrammerUtils::createASTForArrayType(Tree* pASTArrayTypeSrc)
 	Tree* pPrimTypeArrayNode = nullptr;
 	if (pASTArrayTypeSrc != nullptr)
 	{
-		pPrimTypeArrayNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_TYPEARRAY, GET_INFO_FOR_KEY(pASTArrayTypeSrc, "text").c_str());
+		pPrimTypeArrayNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_TYPEARRAY, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::TEXT).c_str());
 		{
-			pPrimTypeArrayNode->m_sAdditionalInfo.append(pASTArrayTypeSrc->m_sAdditionalInfo);
+			APPEND_INFO_FOR_KEY(pPrimTypeArrayNode, ASTInfo::SYMBOL, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::SYMBOL));
 			pPrimTypeArrayNode->m_bIsPointerType = true;
-			SET_INFO_FOR_KEY(pPrimTypeArrayNode, "type", GET_INFO_FOR_KEY(pASTArrayTypeSrc, "type"));
-			SET_INFO_FOR_KEY(pPrimTypeArrayNode, "givenName", GET_INFO_FOR_KEY(pASTArrayTypeSrc, "givenName"));
-			SET_INFO_FOR_KEY(pPrimTypeArrayNode, "scope", GET_INFO_FOR_KEY(pASTArrayTypeSrc, "scope"));
+			SET_INFO_FOR_KEY(pPrimTypeArrayNode, ASTInfo::TYPE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::TYPE));
+			SET_INFO_FOR_KEY(pPrimTypeArrayNode, ASTInfo::GIVENNAME, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::GIVENNAME));
+			pPrimTypeArrayNode->m_eScope = pASTArrayTypeSrc->m_eScope;
 			pPrimTypeArrayNode->m_pParentNode = nullptr;
 
 			////////////////////////////////////////
 			// Optional Array Size
 			{
-				std::string sArraySize = GET_INFO_FOR_KEY(pASTArrayTypeSrc->m_pLeftNode, "text");
+				std::string sArraySize = GET_INFO_FOR_KEY(pASTArrayTypeSrc->m_pLeftNode, ASTInfo::TEXT);
 				Tree* pArraySizeLeaf = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_INTEGER, sArraySize.c_str());
 				{
 					pPrimTypeArrayNode->m_pLeftNode = pArraySizeLeaf;
@@ -1779,11 +1883,11 @@ Tree* GrammerUtils::createASTForArrayType(Tree* pASTArrayTypeSrc)
 				Tree* pSrcArrayElementsNode = pASTArrayTypeSrc->m_pRightNode;
 				if (pSrcArrayElementsNode != nullptr)
 				{
-					SET_INFO_FOR_KEY(pArrayElementsLeaf, "text", GET_INFO_FOR_KEY(pSrcArrayElementsNode, "text"));
+					SET_INFO_FOR_KEY(pArrayElementsLeaf, ASTInfo::TEXT, GET_INFO_FOR_KEY(pSrcArrayElementsNode, ASTInfo::TEXT));
 					for (Tree* pExpressionsLeaf : pSrcArrayElementsNode->m_vStatements)
 					{
 						Tree* pExpressionArrayElementLeaf = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_EXPRESSION, "");
-						SET_INFO_FOR_KEY(pExpressionArrayElementLeaf, "text", GET_INFO_FOR_KEY(pExpressionsLeaf, "text"));
+						pExpressionArrayElementLeaf->m_pExpression = pExpressionsLeaf->m_pExpression;	// Expression trees are never modified, hence shared.
 
 						pArrayElementsLeaf->addChild(pExpressionArrayElementLeaf);
 					}
@@ -1800,11 +1904,11 @@ Tree* GrammerUtils::createASTForPointerType(Tree* pASTArrayTypeSrc)
 	Tree* pPrimTypePointerNode = nullptr;
 	if (pASTArrayTypeSrc != nullptr)
 	{
-		pPrimTypePointerNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_TYPE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, "text").c_str());
+		pPrimTypePointerNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_TYPE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::TEXT).c_str());
 		{
-			pPrimTypePointerNode->m_sAdditionalInfo.append(pASTArrayTypeSrc->m_sAdditionalInfo);
+			APPEND_INFO_FOR_KEY(pPrimTypePointerNode, ASTInfo::SYMBOL, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::SYMBOL));
 			pPrimTypePointerNode->m_bIsPointerType = true;
-			SET_INFO_FOR_KEY(pPrimTypePointerNode, "type", GET_INFO_FOR_KEY(pASTArrayTypeSrc, "type"));
+			SET_INFO_FOR_KEY(pPrimTypePointerNode, ASTInfo::TYPE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::TYPE));
 			pPrimTypePointerNode->m_pParentNode = nullptr;
 		}
 	}
@@ -1817,10 +1921,10 @@ Tree* GrammerUtils::createASTForType(Tree* pASTArrayTypeSrc)
 	Tree* pPrimTypeNode = nullptr;
 	if (pASTArrayTypeSrc != nullptr)
 	{
-		pPrimTypeNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_TYPE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, "text").c_str());
+		pPrimTypeNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_TYPE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::TEXT).c_str());
 		{
-			pPrimTypeNode->m_sAdditionalInfo.append(pASTArrayTypeSrc->m_sAdditionalInfo);
-			SET_INFO_FOR_KEY(pPrimTypeNode, "type", GET_INFO_FOR_KEY(pASTArrayTypeSrc, "type"));
+			APPEND_INFO_FOR_KEY(pPrimTypeNode, ASTInfo::SYMBOL, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::SYMBOL));
+			SET_INFO_FOR_KEY(pPrimTypeNode, ASTInfo::TYPE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::TYPE));
 
 			// =
 			// Optional RHS(Expression)
@@ -1829,8 +1933,16 @@ Tree* GrammerUtils::createASTForType(Tree* pASTArrayTypeSrc)
 				pPrimTypeNode->m_pLeftNode = pExpressionLeftLeaf;
 				pExpressionLeftLeaf->m_pParentNode = pPrimTypeNode;
 
-				std::string sExpression = (pASTArrayTypeSrc->m_pLeftNode == nullptr) ? "0" : GET_INFO_FOR_KEY(pASTArrayTypeSrc->m_pLeftNode, "text");
-				SET_INFO_FOR_KEY(pExpressionLeftLeaf, "text", sExpression);
+				if (pASTArrayTypeSrc->m_pLeftNode == nullptr)
+				{
+					ExprNode* pZeroNode = ExprArena::allocate();
+					pZeroNode->m_eExprNodeType = ExprNodeType_::Type::EXPR_INTEGER;
+					pZeroNode->m_sText = "0";
+
+					pExpressionLeftLeaf->m_pExpression = pZeroNode;
+				}
+				else
+					pExpressionLeftLeaf->m_pExpression = pASTArrayTypeSrc->m_pLeftNode->m_pExpression;
 			}
 		}
 	}
@@ -1843,7 +1955,7 @@ Tree* GrammerUtils::createFreeASTForArrayType(Tree* pASTArrayTypeSrc)
 	Tree* pFreeTypeNode = nullptr;
 	if (pASTArrayTypeSrc != nullptr)
 	{
-		pFreeTypeNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_FREE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, "text").c_str());
+		pFreeTypeNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_FREE, GET_INFO_FOR_KEY(pASTArrayTypeSrc, ASTInfo::TEXT).c_str());
 	}
 
 	return pFreeTypeNode;
@@ -1898,18 +2010,18 @@ Tree* GrammerUtils::createThisFunctionCallWithoutArguments(const char* sFunction
 {
 	Tree* pMemberFunctionCall = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_MEMBERACCESS, "this");
 	{
-		SET_INFO_FOR_KEY(pMemberFunctionCall, "text", "this");
-		SET_INFO_FOR_KEY(pMemberFunctionCall, "givenName", "this");
-		SET_INFO_FOR_KEY(pMemberFunctionCall, "accessType", "object");
+		SET_INFO_FOR_KEY(pMemberFunctionCall, ASTInfo::TEXT, "this");
+		SET_INFO_FOR_KEY(pMemberFunctionCall, ASTInfo::GIVENNAME, "this");
+		SET_INFO_FOR_KEY(pMemberFunctionCall, ASTInfo::ACCESSTYPE, "object");
 
 		Tree* pFunctionCallNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_FUNCTIONCALL, sFunctionName);
 		{
-			SET_INFO_FOR_KEY(pFunctionCallNode, "text", sFunctionName);
+			SET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::TEXT, sFunctionName);
 			pMemberFunctionCall->addChild(pFunctionCallNode);
 
 			Tree* pFunctionCallEndNode = CREATE_NODE_OF_AST(ASTNodeType::ASTNode_FUNCTIONCALLEND, sFunctionName);
 			{
-				SET_INFO_FOR_KEY(pFunctionCallEndNode, "text", sFunctionName);
+				SET_INFO_FOR_KEY(pFunctionCallEndNode, ASTInfo::TEXT, sFunctionName);
 				pFunctionCallNode->addChild(pFunctionCallEndNode);
 			}
 		}
@@ -2012,7 +2124,7 @@ void GrammerUtils::addASTForStructMemberVariableConstruction(FunctionInfo* pFunc
 				iVal |= (iStructSize & 0x0000FFFF);
 				char sOperand[255] = { 0 };
 				_itoa(iVal, sOperand, 10);
-				SET_INFO_FOR_KEY(pMemberFunctionCall, "SUB_REG", sOperand);
+				SET_INFO_FOR_KEY(pMemberFunctionCall, ASTInfo::SUB_REG, sOperand);
 			}
 			/////////////////////////////////////////////////////////////////////////
 
@@ -2085,7 +2197,7 @@ void GrammerUtils::addASTForStructMemberVariableDestruction(FunctionInfo* pFunct
 				iVal |= (iStructSize & 0x0000FFFF);
 				char sOperand[255] = { 0 };
 				_itoa(iVal, sOperand, 10);
-				SET_INFO_FOR_KEY(pMemberFunctionCall, "SUB_REG", sOperand);
+				SET_INFO_FOR_KEY(pMemberFunctionCall, ASTInfo::SUB_REG, sOperand);
 			}
 			/////////////////////////////////////////////////////////////////////////
 
@@ -2106,7 +2218,7 @@ void GrammerUtils::handleStructConstructorOrDestructor(FunctionInfo* pFunctionIn
 	if (sFunctionName == sStructName)									// Check if the current function name indeed is the 'Constructor'.
 	{
 		// Constructor without Arguments
-		if(pFunctionInfo->m_pFunctionArguments->m_sAdditionalInfo.empty())
+		if(GET_INFO_FOR_KEY(pFunctionInfo->m_pFunctionArguments, ASTInfo::SYMBOL).empty())
 			m_pCurrentStruct->m_bHasConstructor = true;
 		addASTForStructMemberVariableConstruction(pFunctionInfo);
 	}
@@ -2120,7 +2232,7 @@ void GrammerUtils::handleStructConstructorOrDestructor(FunctionInfo* pFunctionIn
 
 void GrammerUtils::handleFunctionDef(Tree* pNode)
 {
-	std::string sFuncName = GET_INFO_FOR_KEY(pNode, "text");
+	std::string sFuncName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 	Tree* pReturnTypeNode = pNode->m_pLeftNode;
 	Tree* pArgListNode = pNode->m_pRightNode;
 
@@ -2146,17 +2258,98 @@ void GrammerUtils::handleFunctionDef(Tree* pNode)
 		}
 
 		m_pCurrentFunction->updateFunctionSignature();
+
+		foldConstants(pNode);
+	}
+}
+
+void GrammerUtils::foldConstants(Tree* pNode)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Runs once per function, before any of its code is emitted.
+	// 1. 'sizeOf()' is known by now, its hoisted temporary is replaced by
+	//    the size & is never emitted.
+	// 2. The expression is folded as int or 'float', whichever it is now.
+	//    The result is dropped if folding changed that, e.g 'x * 1.0'
+	//    with an int 'x' is still evaluated as 'float'.
+	//////////////////////////////////////////////////////////////////////
+	if (pNode == nullptr)
+		return;
+
+	if (pNode->m_pExpression != nullptr)
+	{
+		// 1.
+		foldSizeOf(pNode->m_pExpression);
+
+		// 2.
+		bool bIsFP = isFloatingPointExpression(pNode->m_pExpression);
+		ExprNode* pFolded = ConstantFolder::fold(pNode->m_pExpression, bIsFP);
+		if (isFloatingPointExpression(pFolded) == bIsFP)
+			pNode->m_pExpression = pFolded;
+	}
+
+	foldConstants(pNode->m_pLeftNode);
+	foldConstants(pNode->m_pRightNode);
+	for (Tree* pChild : pNode->m_vStatements)
+		foldConstants(pChild);
+}
+
+void GrammerUtils::foldSizeOf(ExprNode* pExprNode)
+{
+	if (pExprNode == nullptr)
+		return;
+
+	Tree* pCallNode = pExprNode->m_pCallNode;
+	if (pCallNode != nullptr && pCallNode->m_pLeftNode != nullptr && pCallNode->m_pLeftNode->m_vStatements.size() == 1)
+	{
+		Tree* pSizeOfNode = pCallNode->m_pLeftNode->m_vStatements[0];
+		if (pSizeOfNode->m_eASTNodeType == ASTNodeType::ASTNode_SIZEOF && pSizeOfNode->m_pLeftNode != nullptr)
+		{
+			int32_t iSize = sizeOf(GET_INFO_FOR_KEY(pSizeOfNode->m_pLeftNode, ASTInfo::TEXT));
+			if (iSize > 0)
+			{
+				pExprNode->m_eExprNodeType = ExprNodeType_::Type::EXPR_INTEGER;
+				pExprNode->m_sText = std::to_string(iSize);
+				pCallNode->m_bIsConditionalCall = true;		// Emitted where it is used, which is nowhere now.
+			}
+		}
+	}
+
+	foldSizeOf(pExprNode->m_pLeft);
+	foldSizeOf(pExprNode->m_pRight);
+}
+
+bool GrammerUtils::emitConstantRValue(Tree* pExpressionNode, PRIMIIVETYPE eLVal_PRIMIIVETYPE)
+{
+	// A literal rvalue is cast now, so the value is pushed as stored & no 'CAST' is emitted.
+	if (pExpressionNode == nullptr || NOT pExpressionNode->m_vStatements.empty())
+		return false;
+
+	int32_t iValue = 0;
+	float fValue = 0.0f;
+	if (NOT ConstantFolder::castConstant(pExpressionNode->m_pExpression, eLVal_PRIMIIVETYPE, iValue, fValue))
+		return false;
+
+	if (eLVal_PRIMIIVETYPE == PRIMIIVETYPE::FLOAT)
+	{
+		EMIT_1F(OPCODE::PUSHF, fValue);
+	}
+	else
+	{
+		EMIT_1(OPCODE::PUSHI, iValue);
 	}
+
+	return true;
 }
 
 void GrammerUtils::handleFunctionStart(Tree* pNode)
 {
 #if (VERBOSE == 1)
-	bool bHasVirtual = NOT GET_INFO_FOR_KEY(m_pCurrentFunction->m_pNode, "isVirtual").empty();
+	bool bHasVirtual = NOT GET_INFO_FOR_KEY(m_pCurrentFunction->m_pNode, ASTInfo::ISVIRTUAL).empty();
 
 	std::cout << "<___________________" << m_pCurrentFunction->m_sFunctionName << "___________________>" << std::endl;
 	std::cout	<< (bHasVirtual ? "virtual ":"")
-				<< m_pCurrentFunction->m_pFunctionReturnType->getAdditionalInfoFor("text") << " "
+				<< m_pCurrentFunction->m_pFunctionReturnType->getAdditionalInfoFor(ASTInfo::TEXT) << " "
 				<< ((m_pCurrentStruct != nullptr) ? (m_pCurrentStruct->m_sStructName + "::") : "") 
 				<< m_pCurrentFunction->m_sFunctionName;
 	std::cout << "(";
@@ -2165,25 +2358,49 @@ void GrammerUtils::handleFunctionStart(Tree* pNode)
 		for (int i = 0; i < m_pCurrentFunction->m_pFunctionArguments->m_vStatements.size(); i++)
 		{
 			Tree* pArgNode = m_pCurrentFunction->m_pFunctionArguments->m_vStatements.at(i);
-			std::cout << GET_INFO_FOR_KEY(pArgNode, "text") << ", ";
+			std::cout << GET_INFO_FOR_KEY(pArgNode, ASTInfo::TEXT) << ", ";
 		}
 	}
 
 	std::cout << ")" << std::endl;
 #endif
 
+	// Stack Frame: LOCALs for the function()s inlined into this one go after its own, see Inliner.h.
+	//		- Calls in a member function() may resolve to other members, those are not inlined.
+	int32_t iInlineLocalCount = 0;
+	if (m_pCurrentStruct == nullptr && m_pCurrentInterface == nullptr)
+		iInlineLocalCount = countInlineLocals(m_pCurrentFunction->m_pNode);
+	if (m_pCurrentFunction->getLocalVariableCount() + iInlineLocalCount > INLINE_MAX_FRAME)
+		iInlineLocalCount = INLINE_MAX_FRAME - m_pCurrentFunction->getLocalVariableCount();
+	if (iInlineLocalCount < 0)
+		iInlineLocalCount = 0;
+	m_pCurrentFunction->m_iInlineLocalCount = iInlineLocalCount;
+
+	// Stack Frame: Objects that never leave the function() go after those, see EscapeAnalysis.h.
+	int32_t iFirstObjectLocal = m_pCurrentFunction->getLocalVariableCount() + iInlineLocalCount + 1;
+	int32_t iMaxObjectSlots = INLINE_MAX_FRAME - (iFirstObjectLocal - 1);
+	if (iMaxObjectSlots > ESCAPE_MAX_STACK_SLOTS)
+		iMaxObjectSlots = ESCAPE_MAX_STACK_SLOTS;
+	m_pCurrentFunction->m_iStackObjectSlots = EscapeAnalysis::allocateStackObjects(m_pCurrentFunction, iFirstObjectLocal, iMaxObjectSlots, m_MapGlobalStructs);
+
 	// Stack Frame: Subtract local variable count from ESP.
-	if(m_pCurrentFunction->getLocalVariableCount() > 0)
-		EMIT_2(OPCODE::SUB_REG, EREGISTERS::RSP, -m_pCurrentFunction->getLocalVariableCount());
+	int32_t iLocalCount = m_pCurrentFunction->getLocalVariableCount() + m_pCurrentFunction->m_iInlineLocalCount + m_pCurrentFunction->m_iStackObjectSlots;
+	if(iLocalCount > 0)
+		EMIT_2(OPCODE::SUB_REG, EREGISTERS::RSP, -iLocalCount);
+
+	m_pCurrentFunction->m_iBodyOffsetInCode = CURRENT_OFFSET;
 }
 
 void GrammerUtils::handleFunctionEnd(Tree* pNode)
 {
+	m_pCurrentFunction->m_iEpilogueOffsetInCode = CURRENT_OFFSET;
+
 	///////////////////////////////////////////////////////////
 	// STACK FRAME - EPILOGUE
 	// 1. Stack Frame: Add local variable count from ESP.
-	if (m_pCurrentFunction->getLocalVariableCount() > 0)
-		EMIT_2(OPCODE::SUB_REG, EREGISTERS::RSP, m_pCurrentFunction->getLocalVariableCount());
+	int32_t iLocalCount = m_pCurrentFunction->getLocalVariableCount() + m_pCurrentFunction->m_iInlineLocalCount + m_pCurrentFunction->m_iStackObjectSlots;
+	if (iLocalCount > 0)
+		EMIT_2(OPCODE::SUB_REG, EREGISTERS::RSP, iLocalCount);
 
 	// 2. Stack Frame: Add argument count from ESP.
 	if (m_pCurrentFunction->getArgumentsCount() > 0)
@@ -2195,7 +2412,7 @@ void GrammerUtils::handleFunctionEnd(Tree* pNode)
 	// 4. Return Execution to the 'Caller'
 	EMIT_1(OPCODE::RET, 0);
 
-	if (GET_INFO_FOR_KEY(m_pCurrentFunction->m_pFunctionReturnType, "text") != "void")
+	if (GET_INFO_FOR_KEY(m_pCurrentFunction->m_pFunctionReturnType, ASTInfo::TEXT) != "void")
 	{
 		////// Push the already Popped Return Value in EAX onto the stack.
 		EMIT_1(OPCODE::PUSHR, EREGISTERS::RAX);
@@ -2210,16 +2427,16 @@ FunctionInfo* GrammerUtils::getFunctionInfo(Tree* pNode)
 	FunctionInfo* pRETURN_FunctionInfo = nullptr;
 
 	std::string sType = "";
-	std::string sFuncCallee = GET_INFO_FOR_KEY(pNode, "text");
+	std::string sFuncCallee = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 	Tree* pParent_FunctionCall = pNode->m_pParentNode;
 	if (pParent_FunctionCall != nullptr)
 	{
-		std::string sCallee_Signature = pParent_FunctionCall->m_sAdditionalInfo;
+		std::string sCallee_Signature = GET_INFO_FOR_KEY(pParent_FunctionCall, ASTInfo::SYMBOL);
 		int32_t iCallee_ArgCount = pParent_FunctionCall->m_vStatements.size() - 1;
 
 		//////////////////////////////////////////////////////////
 		// 1. Check if the function() is in a STRUCT.
-		sType = GET_INFO_FOR_KEY(pParent_FunctionCall, "memberFunctionOf");
+		sType = GET_INFO_FOR_KEY(pParent_FunctionCall, ASTInfo::MEMBERFUNCTIONOF);
 		if (NOT sType.empty())
 		{
 LABEL1:
@@ -2236,7 +2453,7 @@ LABEL1:
 							std::string sFUNCDEF_Name = pFunctionInfo->m_sFunctionName;
 							Tree* pFUNCDEF_ArgListNode = pFunctionInfo->m_pFunctionArguments;
 							int iFUNCDEF_ArgCount = pFUNCDEF_ArgListNode->m_vStatements.size();
-							std::string sFUNCDEF_Signature = pFUNCDEF_ArgListNode->m_sAdditionalInfo;
+							std::string sFUNCDEF_Signature = GET_INFO_FOR_KEY(pFUNCDEF_ArgListNode, ASTInfo::SYMBOL);
 
 							if (sFuncCallee == sFUNCDEF_Name
 								&&
@@ -2276,7 +2493,7 @@ LABEL1:
 					std::string sFUNCDEF_Name = pFunctionInfo->m_sFunctionName;
 					Tree* pFUNCDEF_ArgListNode = pFunctionInfo->m_pFunctionArguments;
 					int iFUNCDEF_ArgCount = pFUNCDEF_ArgListNode->m_vStatements.size();
-					std::string sFUNCDEF_Signature = pFUNCDEF_ArgListNode->m_sAdditionalInfo;
+					std::string sFUNCDEF_Signature = GET_INFO_FOR_KEY(pFUNCDEF_ArgListNode, ASTInfo::SYMBOL);
 
 					if (sFuncCallee == sFUNCDEF_Name
 						&&
@@ -2311,7 +2528,7 @@ void GrammerUtils::handleSystemFunctionCall(Tree* pNode)
 {
 	// Get Callee Function Def details like argument Count & function signature.
 	Tree* pCALLEE_Node = pNode->m_pParentNode;
-	std::string sFuncCallee = GET_INFO_FOR_KEY(pCALLEE_Node, "text");
+	std::string sFuncCallee = GET_INFO_FOR_KEY(pCALLEE_Node, ASTInfo::TEXT);
 
 	int iCALLEE_ArgCount = pCALLEE_Node->m_vStatements.size() - 1/*ASTNode_SYSTEMFUNCTIONCALLEND*/;
 
@@ -2356,7 +2573,7 @@ void GrammerUtils::handleSystemFunctionCall(Tree* pNode)
 void GrammerUtils::handleFunctionCall(Tree* pNode)
 {
 	// Callee function name
-	std::string sFuncCallee = GET_INFO_FOR_KEY(pNode, "text");
+	std::string sFuncCallee = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 
 	// Check if the 'Callee' is our list !
 	FunctionInfo* pCalleeFunctionInfo = getFunctionInfo(pNode);
@@ -2367,12 +2584,12 @@ void GrammerUtils::handleFunctionCall(Tree* pNode)
 		// Get Actual Function Def details like argument Count & function signature.
 		Tree* pFUNCDEF_ArgListNode = pCalleeFunctionInfo->m_pFunctionArguments;
 		int iFUNCDEF_ArgCount = pFUNCDEF_ArgListNode->m_vStatements.size();
-		std::string sFUNCDEF_Signature = pFUNCDEF_ArgListNode->m_sAdditionalInfo;
+		std::string sFUNCDEF_Signature = GET_INFO_FOR_KEY(pFUNCDEF_ArgListNode, ASTInfo::SYMBOL);
 
 		// Get Callee Function Def details like argument Count & function signature.
 		Tree* pCALLEE_Node = pNode->m_pParentNode;
 		int iCALLEE_ArgCount = pCALLEE_Node->m_vStatements.size() - 1/*ASTNode_FUNCTIONCALLEND*/;
-		std::string sCALLEE_Signature = pCALLEE_Node->m_sAdditionalInfo;
+		std::string sCALLEE_Signature = GET_INFO_FOR_KEY(pCALLEE_Node, ASTInfo::SYMBOL);
 
 		// Check if the Callee meets Actual function requirements.
 		// Else give a compilation error here.
@@ -2400,12 +2617,18 @@ void GrammerUtils::handleFunctionCall(Tree* pNode)
 			//////////////////////////////////////////////////////
 			*/
 
+			//////////////////////////////////////////////////////
+			// 0. Small function()s are copied in place of the call, see Inliner.h.
+			if (inlineFunctionCall(pCalleeFunctionInfo, pCALLEE_Node))
+				return;
+
 			//////////////////////////////////////////////////////
 			// 1. Call Return Address
 			//		- Create a pocket(hole) where the code will jump to once function call ends.
 			//		- This 'hole' will be filled in later.
 			EMIT_BYTE(OPCODE::PUSHI);
 			int iReturnAddressOffsetHole = CURRENT_OFFSET;
+			m_vCodeAddressHoles.push_back(iReturnAddressOffsetHole);
 			EMIT_INT(0);
 
 			// 2. Store Old 'EBP' - Stack Base Pointer
@@ -2437,11 +2660,23 @@ void GrammerUtils::handleFunctionCall(Tree* pNode)
 			E_FUNCTIONCALLTYPE eE_FUNCTIONCALLTYPE = E_FUNCTIONCALLTYPE::NORMAL;
 			iStartOffsetInCode = pCalleeFunctionInfo->m_iStartOffsetInCode;
 
-			bool bIsVirtual = (GET_INFO_FOR_KEY(pCalleeFunctionInfo->m_pNode, "isVirtual") == "virtual");
+			bool bIsVirtual = (GET_INFO_FOR_KEY(pCalleeFunctionInfo->m_pNode, ASTInfo::ISVIRTUAL) == "virtual");
 			if (bIsVirtual)
 			{
-				eE_FUNCTIONCALLTYPE = E_FUNCTIONCALLTYPE::VIRTUAL;
-				iStartOffsetInCode = pCalleeFunctionInfo->m_iPositionInVTABLE;
+				//		- A 'virtual' call whose function() is already known is made directly, see Devirtualizer.h.
+				FunctionInfo* pTargetFunctionInfo = Devirtualizer::devirtualize(m_pCurrentFunction, m_pCurrentStruct, pCalleeFunctionInfo, pCALLEE_Node, m_MapGlobalStructs);
+				if (pTargetFunctionInfo != nullptr)
+				{
+					iStartOffsetInCode = pTargetFunctionInfo->m_iStartOffsetInCode;
+#if (VERBOSE == 1)
+					std::cout << "Devirtualized " << pTargetFunctionInfo->m_pParentStructInfo->m_sStructName << "::" << sFuncCallee << "() in " << ((m_pCurrentFunction != nullptr) ? m_pCurrentFunction->m_sFunctionName : "") << "() @ " << CURRENT_OFFSET << std::endl;
+#endif
+				}
+				else
+				{
+					eE_FUNCTIONCALLTYPE = E_FUNCTIONCALLTYPE::VIRTUAL;
+					iStartOffsetInCode = pCalleeFunctionInfo->m_iPositionInVTABLE;
+				}
 			}
 
 			iCalleeFunctionAddress = (int32_t)eE_FUNCTIONCALLTYPE;
@@ -2460,8 +2695,132 @@ void GrammerUtils::handleFunctionCall(Tree* pNode)
 #if (VERBOSE == 1)
 			std::cout << "------" << "iReturnAddressOffsetHole [" << iReturnAddressOffsetHole << "] = " << CURRENT_OFFSET << std::endl;
 #endif
+
+			//////////////////////////////////////////////////////
+			// 6. A call between global function()s may be in tail position.
+			//		- Whether the caller only returns the result is known once the rest of it is emitted,
+			//		  the PeepholeOptimizer turns it into a 'TAILCALL' then.
+			//		- Member function()s are left alone, the caller may still need 'RCX' after the call.
+			//		- A caller with objects in its STACK FRAME keeps it, the callee may be given one of them.
+			if (NOT bIsVirtual
+				&&
+				m_pCurrentFunction != nullptr && m_pCurrentStruct == nullptr && m_pCurrentInterface == nullptr
+				&&
+				m_pCurrentFunction->m_iStackObjectSlots == 0
+				&&
+				pCalleeFunctionInfo->m_pParentStructInfo == nullptr && pCalleeFunctionInfo->m_pParentInterfaceInfo == nullptr
+			) {
+				TailCallSite pTailCallSite;
+				pTailCallSite.m_iReturnAddressHole = iReturnAddressOffsetHole;
+				pTailCallSite.m_iCallerArgumentCount = m_pCurrentFunction->getArgumentsCount();
+				pTailCallSite.m_iCalleeArgumentCount = iCALLEE_ArgCount;
+
+				m_vTailCallSites.push_back(pTailCallSite);
+			}
+		}
+	}
+}
+
+bool GrammerUtils::inlineFunctionCall(FunctionInfo* pCalleeFunctionInfo, Tree* pCALLEE_Node)
+{
+	if (m_pCurrentFunction == nullptr)
+		return false;
+
+	if (NOT Inliner::canInline(m_pCurrentFunction, pCalleeFunctionInfo, m_iByteCode, m_vCodeAddressHoles))
+		return false;
+
+	// The caller's prologue may not have room for this one.
+	if (Inliner::localsNeeded(pCalleeFunctionInfo) > m_pCurrentFunction->m_iInlineLocalCount)
+		return false;
+
+	int32_t iStartOffset = CURRENT_OFFSET;
+	int32_t iFirstLocal = m_pCurrentFunction->getLocalVariableCount() + 1;
+	int32_t iArgCount = pCalleeFunctionInfo->getArgumentsCount();
+
+	//////////////////////////////////////////////////////
+	// 1. Push Arguments onto the STACK in reverse order('R'ight to 'L'eft), as for a 'CALL'.
+	std::vector<Tree*>::reverse_iterator rItr = pCALLEE_Node->m_vStatements.rbegin();
+	for (; rItr != pCALLEE_Node->m_vStatements.rend(); ++rItr)
+	{
+		Tree* pArgNode = *rItr;
+		if (pArgNode->m_eASTNodeType != ASTNodeType::ASTNode_FUNCTIONCALLEND)
+		{
+			populateCode(pArgNode);
+		}
+	}
+
+	//////////////////////////////////////////////////////
+	// 2. Store them in the LOCALs the callee's ARGUMENTs are renumbered to, ARG0 is on top.
+	for (int32_t i = 0; i < iArgCount; i++)
+	{
+		int32_t iPositionOperand = (int32_t)E_VARIABLESCOPE::LOCAL;
+		iPositionOperand <<= sizeof(int16_t) * 8;
+		iPositionOperand |= ((iFirstLocal + i) & 0x0000FFFF);
+
+		EMIT_1(OPCODE::STORE, iPositionOperand);
+	}
+
+	//////////////////////////////////////////////////////
+	// 3. The callee's body, leaves the return value in 'EAX' like the 'CALL' would.
+	std::vector<int8_t> vCode;
+	Inliner::expand(pCalleeFunctionInfo, iFirstLocal, m_iByteCode, CURRENT_OFFSET, m_vCodeAddressHoles, vCode);
+	for (int8_t iCode : vCode)
+	{
+		EMIT_BYTE(iCode);
+	}
+
+	int32_t iGrowth = (CURRENT_OFFSET - iStartOffset) - INLINE_CALL_SIZE;
+	std::cout << "Inlined " << pCalleeFunctionInfo->m_sFunctionName << "() into " << m_pCurrentFunction->m_sFunctionName << "() @ " << iStartOffset << ": " << vCode.size() << " bytes copied, " << iGrowth << " bytes growth" << std::endl;
+
+	return true;
+}
+
+int32_t GrammerUtils::countInlineLocals(Tree* pNode)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Most LOCALs any call in pNode needs if it is inlined, the callees
+	// are all emitted by now.
+	//////////////////////////////////////////////////////////////////////
+	int32_t iCount = 0;
+	if (pNode == nullptr)
+		return iCount;
+
+	if (pNode->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONCALLEND && pNode->m_pParentNode != nullptr)
+	{
+		// A member function() call gets its struct only once it is emitted, see handleStructMemberAccess().
+		Tree* pFunctionCallNode = pNode->m_pParentNode;
+		Tree* pMemberAccessNode = pFunctionCallNode->m_pParentNode;
+		if (pMemberAccessNode != nullptr
+			&&
+			pMemberAccessNode->m_eASTNodeType == ASTNodeType::ASTNode_MEMBERACCESS
+			&&
+			GET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::MEMBERFUNCTIONOF).empty()
+		) {
+			std::string sAccessType = GET_INFO_FOR_KEY(pMemberAccessNode, ASTInfo::ACCESSTYPE);
+			std::string sPointerName = GET_INFO_FOR_KEY(pMemberAccessNode, ASTInfo::TEXT);
+			if (sAccessType == "object" && sPointerName != "this")
+				SET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::MEMBERFUNCTIONOF, GET_VARIABLE_NODETYPE(sPointerName));
+			else
+			if (sAccessType == "static")
+				SET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::MEMBERFUNCTIONOF, sPointerName);
 		}
+
+		FunctionInfo* pCalleeFunctionInfo = getFunctionInfo(pNode);
+		if (Inliner::canInline(m_pCurrentFunction, pCalleeFunctionInfo, m_iByteCode, m_vCodeAddressHoles))
+			iCount = Inliner::localsNeeded(pCalleeFunctionInfo);
+	}
+
+	std::vector<Tree*> vChildren = pNode->m_vStatements;
+	vChildren.push_back(pNode->m_pLeftNode);
+	vChildren.push_back(pNode->m_pRightNode);
+	for (Tree* pChild : vChildren)
+	{
+		int32_t iChildCount = countInlineLocals(pChild);
+		if (iChildCount > iCount)
+			iCount = iChildCount;
 	}
+
+	return iCount;
 }
 
 void GrammerUtils::handlePreFixExpression(Tree* pPreFixNode)
@@ -2488,19 +2847,27 @@ void GrammerUtils::handlePreFixExpression(Tree* pPreFixNode)
 			break;
 		}
 
+		// 'HOSTDATA' fields are owned by the host & mapped read-only into the VM.
+		if (bAddCode && IS_VARIABLE_HOSTDATA( GET_INFO_FOR_KEY(pPreFixNode, ASTInfo::TEXT) ))
+		{
+			assert(false);
+			std::cout << "ERROR: HOSTDATA field '" << GET_INFO_FOR_KEY(pPreFixNode, ASTInfo::TEXT) << "' is read-only." << std::endl;
+			bAddCode = false;
+		}
+
 		if (bAddCode)
 		{
 			/////////////////////////////////////////////////
 			// 1. Fetch variable value & store it onto the stack
-			EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPreFixNode, "text") ));
+			EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPreFixNode, ASTInfo::TEXT) ));
 
 			/////////////////////////////////////////////////
 			// 2. Push integer 1.
 			{
 				int8_t iIncrementValue = 1;
-				if (IS_VARIABLE_POINTER_TYPE( GET_INFO_FOR_KEY(pPreFixNode, "text") ))
+				if (IS_VARIABLE_POINTER_TYPE( GET_INFO_FOR_KEY(pPreFixNode, ASTInfo::TEXT) ))
 				{
-					std::string sType = GET_VARIABLE_NODETYPE( GET_INFO_FOR_KEY(pPreFixNode, "text") );
+					std::string sType = GET_VARIABLE_NODETYPE( GET_INFO_FOR_KEY(pPreFixNode, ASTInfo::TEXT) );
 					iIncrementValue = sizeOf(sType);
 				}
 
@@ -2513,76 +2880,63 @@ void GrammerUtils::handlePreFixExpression(Tree* pPreFixNode)
 
 			//////////////////////////////////////////////////////
 			// 4. Store the decremented/incremented value from the stack back to the variable
-			EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPreFixNode, "text") ));
+			EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPreFixNode, ASTInfo::TEXT) ));
 		}
 	}
 }
 
-bool GrammerUtils::isFloatingPointExpression(std::string sExpr)
+bool GrammerUtils::isFloatingPointExpression(ExprNode* pExprNode)
 {
-	StringTokenizer* st = StringTokenizer::create(sExpr.c_str());
-	st->tokenize();
 	bool bIsFP = false;
+	if (pExprNode == nullptr)
+		return bIsFP;
 
-	while (st->hasMoreTokens())
+	switch (pExprNode->m_eExprNodeType)
 	{
-		Token prevTok = st->prevToken();
-		Token tok = st->nextToken();
-
-		TokenType_::Type eCurrTokenType = tok.getType();
-		if (eCurrTokenType == TokenType_::Type::TK_WHITESPACE || eCurrTokenType == TokenType_::Type::TK_EOI || eCurrTokenType == TokenType_::Type::TK_COMMA)
-			continue;
+		case ExprNodeType_::Type::EXPR_FLOAT:
+			bIsFP = true;
+		break;
+		case ExprNodeType_::Type::EXPR_VARIABLE:
+		{
+			std::string sType = GET_VARIABLE_NODETYPE(pExprNode->m_sText);
+			bIsFP = (sType == "float");
+		}
+		break;
+		case ExprNodeType_::Type::EXPR_DEREF:
+		{
+			bIsFP = isFloatingPointExpression(pExprNode->m_pLeft);
 
-		switch (eCurrTokenType)
+			std::string sType = GET_VARIABLE_NODETYPE(pExprNode->m_sText);
+			if (sType == "float")
+				bIsFP = true;
+		}
+		break;
+		case ExprNodeType_::Type::EXPR_MEMBER:
 		{
-			case TokenType_::Type::TK_IDENTIFIER:
-			{
-				std::string sType = GET_VARIABLE_NODETYPE(tok.getText());
-				if (sType == "float")
-				{
-					bIsFP = true;
-					break;
-				}
-			}
-			break;
-			case TokenType_::Type::TK_DEREF:
-			{
-				std::string sType = GET_VARIABLE_NODETYPE(prevTok.getText());
-				if (sType == "float")
-				{
-					bIsFP = true;
-					break;
-				}
-			}
-			break;
-			case TokenType_::Type::TK_MEMBERACCESS:
+			std::string sObjectName = pExprNode->m_sText;
+			std::string sStructType = "";
+			if (sObjectName == "this")
+				sStructType = m_pCurrentStruct->m_sStructName;
+			else
+				sStructType = GET_VARIABLE_NODETYPE(sObjectName);
+			StructInfo* pStructInfo = m_MapGlobalStructs[sStructType];
+			assert(pStructInfo != nullptr);
+			if (pStructInfo != nullptr)
 			{
-				std::string sObjectName = tok.getText();	// sObjectName
-				Token tok = st->nextToken();				// "-"
-				tok = st->nextToken();						// ">"
-				tok = st->nextToken();						// variableName
-
-				std::string sStructType = "";
-				if (sObjectName == "this")
-					sStructType = m_pCurrentStruct->m_sStructName;
-				else
-					sStructType = GET_VARIABLE_NODETYPE(sObjectName);
-				StructInfo* pStructInfo = m_MapGlobalStructs[sStructType];
-				assert(pStructInfo != nullptr);
-				if (pStructInfo != nullptr)
-				{
-					std::string sVariableName = tok.getText();
-					Tree* pNode = pStructInfo->getMemberVariableASTNode(sVariableName.c_str());
-					std::string sType = GET_INFO_FOR_KEY(pNode, "type");
-					if (sType == "float")
-					{
-						bIsFP = true;
-						break;
-					}
-				}
+				Tree* pNode = pStructInfo->getMemberVariableASTNode(pExprNode->m_sMemberName.c_str());
+				std::string sType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
+				bIsFP = (sType == "float");
 			}
-			break;
 		}
+		break;
+		case ExprNodeType_::Type::EXPR_UNARY:
+		case ExprNodeType_::Type::EXPR_BINARY:
+		{
+			bool bIsLeftFP = isFloatingPointExpression(pExprNode->m_pLeft);
+			bool bIsRightFP = isFloatingPointExpression(pExprNode->m_pRight);
+			bIsFP = (bIsLeftFP || bIsRightFP);
+		}
+		break;
 	}
 
 	return bIsFP;
@@ -2590,193 +2944,354 @@ bool GrammerUtils::isFloatingPointExpression(std::string sExpr)
 
 void GrammerUtils::handleExpression(Tree* pNode)
 {
-	std::string sRValuePostFixExpression = GET_INFO_FOR_KEY(pNode, "text");
-	StringTokenizer* st = StringTokenizer::create(sRValuePostFixExpression.c_str());
-	st->tokenize();
-	bool bIsFP = st->hasFloatingPoint();
-
-	if (NOT bIsFP)
-	{
-		bIsFP = isFloatingPointExpression(sRValuePostFixExpression);
+	//////////////////////////////////////////////////////////////////////
+	// The TinyCReader hands over the rvalue as an expression tree.
+	// 1. The whole expression is evaluated as 'float' if any of its
+	//    operands is a 'float'.
+	// 2. The tree is walked in post order, emitting the operands & the
+	//    operators in the order the VM stack expects them.
+	//////////////////////////////////////////////////////////////////////
+	ExprNode* pExpression = pNode->m_pExpression;
+
+	// 1.
+	bool bIsFP = isFloatingPointExpression(pExpression);
+
+	// 2.
+	emitExpression(pExpression, bIsFP);
+
+	SET_INFO_FOR_KEY(pNode, ASTInfo::EXPRESSION_RVALUE_TYPE, bIsFP ? "float" : "int32_t");
+}
 
-		st->setData(sRValuePostFixExpression.c_str(), true);
-		st->tokenize();
-	}
+void GrammerUtils::emitExpression(ExprNode* pExprNode, bool bIsFP)
+{
+	if (pExprNode == nullptr)
+		return;
 
-	while (st->hasMoreTokens())
+	switch (pExprNode->m_eExprNodeType)
 	{
-		Token prevTok = st->prevToken();
-		Token tok = st->nextToken();
-
-		TokenType_::Type eCurrTokenType = tok.getType();
-		if (eCurrTokenType == TokenType_::Type::TK_WHITESPACE || eCurrTokenType == TokenType_::Type::TK_EOI || eCurrTokenType == TokenType_::Type::TK_COMMA)
-			continue;
-
-		switch (eCurrTokenType)
+		case ExprNodeType_::Type::EXPR_INTEGER:
 		{
-			case TokenType_::Type::TK_CHARACTER:
+			if (bIsFP)
 			{
-				if (bIsFP)
-				{
-					EMIT_1F(OPCODE::PUSHF, atof(tok.getText()));
-				}
-				else
-				{
-					EMIT_1(OPCODE::PUSHI, atoi(tok.getText()));
-				}
+				EMIT_1F(OPCODE::PUSHF, atof(pExprNode->m_sText.c_str()));
 			}
-			break;
-			case TokenType_::Type::TK_INTEGER:
+			else
 			{
-				if (bIsFP)
-				{
-					EMIT_1F(OPCODE::PUSHF, atof(tok.getText()));
-				}
-				else
+				EMIT_1(OPCODE::PUSHI, atoi(pExprNode->m_sText.c_str()));
+			}
+		}
+		break;
+		case ExprNodeType_::Type::EXPR_FLOAT:
+			EMIT_1F(OPCODE::PUSHF, atof(pExprNode->m_sText.c_str()));
+		break;
+		case ExprNodeType_::Type::EXPR_VARIABLE:
+		{
+			// A call hoisted out of the right operand of '&&' or '||' runs only when the operand is evaluated.
+			if (pExprNode->m_pCallNode != nullptr && pExprNode->m_pCallNode->m_bIsConditionalCall)
+				handlePrimitiveInt(pExprNode->m_pCallNode);
+
+			EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(pExprNode->m_sText));
+		}
+		break;
+		case ExprNodeType_::Type::EXPR_DEREF:
+		{
+			emitExpression(pExprNode->m_pLeft, bIsFP);			// Array Index
+			EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(pExprNode->m_sText));
+
+			//////////////////////////////////////////////////////////////
+			// Send in the 'CAST' value of the pointer Type(int8_t = 0xFF, int16_6 = 0xFFFF, int32_t = 0xFFFFFFFF)
+			// which will be used @ runtime to make a 'CAST'.
+			std::string sType = GET_VARIABLE_NODETYPE(pExprNode->m_sText);
+			uint32_t iCastValue = castValueFor(sType);
+			EMIT_1(OPCODE::PUSHI, sizeOf(sType));		// Push the size of the node for ArrayIndexing.
+			EMIT_1(OPCODE::LDA, iCastValue);
+			//////////////////////////////////////////////////////////////
+		}
+		break;
+		case ExprNodeType_::Type::EXPR_MEMBER:
+		{
+			//////////////////////////////////////////////////////////////
+			// Member Access has the following notation:
+			//		==> sObjectName->variableName
+			std::string sObjectName = pExprNode->m_sText;
+			std::string sStructType = "";
+			if (sObjectName == "this")
+				sStructType = m_pCurrentStruct->m_sStructName;
+			else	
+				sStructType = GET_VARIABLE_NODETYPE(sObjectName);
+			StructInfo* pStructInfo = m_MapGlobalStructs[sStructType];
+			assert(pStructInfo != nullptr);
+			if (pStructInfo != nullptr)
+			{
+				/////////////////////////////////////////////////////////////////
+				// 1. Fetch 'this' into 'ECX'
+				if (sObjectName != "this")
 				{
-					EMIT_1(OPCODE::PUSHI, atoi(tok.getText()));
+					EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(sObjectName));		// Get the 'this' pointer value
+					EMIT_1(OPCODE::POPR, EREGISTERS::RCX);							// & push it in 'ECX'
 				}
+
+				/////////////////////////////////////////////////////////////////
+				// 2. Fetch the value in the objects variable & push it onto the STACK.
+				int32_t iPosition = getMemberPositionInStructHierarchy(pExprNode->m_sMemberName, pStructInfo);
+
+				EMIT_1(OPCODE::FETCH, iPosition);
 			}
-			break;
-			case TokenType_::Type::TK_FLOAT:
-				EMIT_1F(OPCODE::PUSHF, atof(tok.getText()));
-			break;
-			case TokenType_::Type::TK_IDENTIFIER:
+			//////////////////////////////////////////////////////////////
+		}
+		break;
+		case ExprNodeType_::Type::EXPR_UNARY:
+		case ExprNodeType_::Type::EXPR_BINARY:
+		{
+			if (isLogicalExpression(pExprNode))
 			{
-				std::string sType = GET_VARIABLE_NODETYPE(tok.getText());
-				if (sType == "float")
-					bIsFP = true;
-				
-				EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(tok.getText()));
+				emitLogicalExpression(pExprNode);
+				break;
 			}
-			break;
-			case TokenType_::Type::TK_STRING:
-				EMIT_1(OPCODE::PUSHI, getStringPosition(tok.getText()));
-				break;
-			case TokenType_::Type::TK_MUL:
-				EMIT_1(bIsFP ? OPCODE::MULF : OPCODE::MUL, 0);
-				break;
-			case TokenType_::Type::TK_DIV:
-				EMIT_1(bIsFP ? OPCODE::DIVF : OPCODE::DIV, 0);
-				break;
-			case TokenType_::Type::TK_MOD:
-				EMIT_1(bIsFP ? OPCODE::MODF : OPCODE::MOD, 0);
-				break;
-			case TokenType_::Type::TK_ADD:
-				EMIT_1(bIsFP ? OPCODE::ADDF : OPCODE::ADD, 0);
-				break;
-			case TokenType_::Type::TK_SUB:
-				EMIT_1(bIsFP ? OPCODE::SUBF : OPCODE::SUB, 0);
-				break;
-			case TokenType_::Type::TK_LT:
-				EMIT_1(OPCODE::JMP_LT, 0);
-				break;
-			case TokenType_::Type::TK_LTEQ:
-				EMIT_1(OPCODE::JMP_LTEQ, 0);
-				break;
-			case TokenType_::Type::TK_GT:
-				EMIT_1(OPCODE::JMP_GT, 0);
-				break;
-			case TokenType_::Type::TK_GTEQ:
-				EMIT_1(OPCODE::JMP_GTEQ, 0);
-				break;
-			case TokenType_::Type::TK_EQ:
-				EMIT_1(OPCODE::JMP_EQ, 0);
-				break;
-			case TokenType_::Type::TK_NEQ:
-				EMIT_1(OPCODE::JMP_NEQ, 0);
-				break;
-			case TokenType_::Type::TK_LOGICALAND:
-				EMIT_1(OPCODE::LOGICALAND, 0);
-				break;
-			case TokenType_::Type::TK_LOGICALOR:
-				EMIT_1(OPCODE::LOGICALOR, 0);
-				break;
-			case TokenType_::Type::TK_BITWISEAND:
-				EMIT_1(OPCODE::BITWISEAND, 0);
-				break;
-			case TokenType_::Type::TK_BITWISEOR:
-				EMIT_1(OPCODE::BITWISEOR, 0);
-				break;
-			case TokenType_::Type::TK_BITWISEXOR:
-				EMIT_1(OPCODE::BITWISEXOR, 0);
-				break;
-			case TokenType_::Type::TK_BITWISENOT:
-				EMIT_1(OPCODE::BITWISENOT, 0);
-				break;
-			case TokenType_::Type::TK_BITWISELEFTSHIFT:
-				EMIT_1(OPCODE::BITWISELEFTSHIFT, 0);
-				break;
-			case TokenType_::Type::TK_BITWISERIGHTSHIFT:
-				EMIT_1(OPCODE::BITWISERIGHTSHIFT, 0);
-				break;
-			case TokenType_::Type::TK_NOT:
-				EMIT_1(OPCODE::_NOT, 0);
-				break;
-			case TokenType_::Type::TK_NEGATE:
-				EMIT_1(OPCODE::NEGATE, 0);
-				break;
-			case TokenType_::Type::TK_DEREF:
+
+			emitExpression(pExprNode->m_pLeft, bIsFP);
+			emitExpression(pExprNode->m_pRight, bIsFP);
+
+			switch (pExprNode->m_eOperator)
 			{
-				//////////////////////////////////////////////////////////////
-				// Send in the 'CAST' value of the pointer Type(int8_t = 0xFF, int16_6 = 0xFFFF, int32_t = 0xFFFFFFFF)
-				// which will be used @ runtime to make a 'CAST'.
-				std::string sType = GET_VARIABLE_NODETYPE(prevTok.getText());
-				if (sType == "float")
-					bIsFP = true;
-
-				uint32_t iCastValue = castValueFor(sType);
-				EMIT_1(OPCODE::PUSHI, sizeOf(sType));		// Push the size of the node for ArrayIndexing.
-				EMIT_1(OPCODE::LDA, iCastValue);
-				//////////////////////////////////////////////////////////////
+				case TokenType_::Type::TK_MUL:
+					EMIT_1(bIsFP ? OPCODE::MULF : OPCODE::MUL, 0);
+					break;
+				case TokenType_::Type::TK_DIV:
+					EMIT_1(bIsFP ? OPCODE::DIVF : OPCODE::DIV, 0);
+					break;
+				case TokenType_::Type::TK_MOD:
+					EMIT_1(bIsFP ? OPCODE::MODF : OPCODE::MOD, 0);
+					break;
+				case TokenType_::Type::TK_ADD:
+					EMIT_1(bIsFP ? OPCODE::ADDF : OPCODE::ADD, 0);
+					break;
+				case TokenType_::Type::TK_SUB:
+					EMIT_1(bIsFP ? OPCODE::SUBF : OPCODE::SUB, 0);
+					break;
+				case TokenType_::Type::TK_LT:
+					EMIT_1(OPCODE::JMP_LT, 0);
+					break;
+				case TokenType_::Type::TK_LTEQ:
+					EMIT_1(OPCODE::JMP_LTEQ, 0);
+					break;
+				case TokenType_::Type::TK_GT:
+					EMIT_1(OPCODE::JMP_GT, 0);
+					break;
+				case TokenType_::Type::TK_GTEQ:
+					EMIT_1(OPCODE::JMP_GTEQ, 0);
+					break;
+				case TokenType_::Type::TK_EQ:
+					EMIT_1(OPCODE::JMP_EQ, 0);
+					break;
+				case TokenType_::Type::TK_NEQ:
+					EMIT_1(OPCODE::JMP_NEQ, 0);
+					break;
+				case TokenType_::Type::TK_BITWISEAND:
+					EMIT_1(OPCODE::BITWISEAND, 0);
+					break;
+				case TokenType_::Type::TK_BITWISEOR:
+					EMIT_1(OPCODE::BITWISEOR, 0);
+					break;
+				case TokenType_::Type::TK_BITWISEXOR:
+					EMIT_1(OPCODE::BITWISEXOR, 0);
+					break;
+				case TokenType_::Type::TK_BITWISENOT:
+					EMIT_1(OPCODE::BITWISENOT, 0);
+					break;
+				case TokenType_::Type::TK_BITWISELEFTSHIFT:
+					EMIT_1(OPCODE::BITWISELEFTSHIFT, 0);
+					break;
+				case TokenType_::Type::TK_BITWISERIGHTSHIFT:
+					EMIT_1(OPCODE::BITWISERIGHTSHIFT, 0);
+					break;
+				case TokenType_::Type::TK_NOT:
+					EMIT_1(OPCODE::_NOT, 0);
+					break;
+				case TokenType_::Type::TK_NEGATE:
+					EMIT_1(OPCODE::NEGATE, 0);
+					break;
 			}
-			break;
-			case TokenType_::Type::TK_MEMBERACCESS:
-			{
-				//////////////////////////////////////////////////////////////
-				// Member Access has the following notation:
-				//		==> sObjectName->variableName
-				std::string sObjectName = tok.getText();	// sObjectName
-				Token tok = st->nextToken();				// "-"
-				tok = st->nextToken();						// ">"
-				tok = st->nextToken();						// variableName
+		}
+		break;
+	}
+}
 
-				std::string sStructType = "";
-				if (sObjectName == "this")
-					sStructType = m_pCurrentStruct->m_sStructName;
-				else	
-					sStructType = GET_VARIABLE_NODETYPE(sObjectName);
-				StructInfo* pStructInfo = m_MapGlobalStructs[sStructType];
-				assert(pStructInfo != nullptr);
-				if (pStructInfo != nullptr)
-				{
-					/////////////////////////////////////////////////////////////////
-					// 1. Fetch 'this' into 'ECX'
-					if (sObjectName != "this")
-					{
-						EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(sObjectName));		// Get the 'this' pointer value
-						EMIT_1(OPCODE::POPR, EREGISTERS::RCX);							// & push it in 'ECX'
-					}
+bool GrammerUtils::isLogicalExpression(ExprNode* pExprNode)
+{
+	return	pExprNode != nullptr
+			&&
+			pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_BINARY
+			&&
+			(pExprNode->m_eOperator == TokenType_::Type::TK_LOGICALAND || pExprNode->m_eOperator == TokenType_::Type::TK_LOGICALOR);
+}
 
-					/////////////////////////////////////////////////////////////////
-					// 2. Fetch the value in the objects variable & push it onto the STACK.
-					std::string sVariableName = tok.getText();
-					Tree* pNode = pStructInfo->getMemberVariableASTNode(sVariableName.c_str());
-					std::string sType = GET_INFO_FOR_KEY(pNode, "type");
-					if (sType == "float")
-						bIsFP = true;
+void GrammerUtils::emitLogicalExpression(ExprNode* pExprNode)
+{
+	//////////////////////////////////////////////////////////////////////
+	// '&&' & '||' as a value, the right operand is skipped once the left
+	// one decides the result.
+	//		a && b	==>		a, JZ false, b, JZ false, PUSHI 1, JMP end, false: PUSHI 0, end:
+	//		a || b	==>		a, JNZ true, b, JNZ true, PUSHI 0, JMP end, true: PUSHI 1, end:
+	//////////////////////////////////////////////////////////////////////
+	bool bIsOr = (pExprNode->m_eOperator == TokenType_::Type::TK_LOGICALOR);
+	std::vector<uint32_t> vDecidedJmpHoles, vEndJmpHoles;
 
-					int32_t iPosition = getMemberPositionInStructHierarchy(sVariableName, pStructInfo);
+	emitCondition(pExprNode, bIsOr, vDecidedJmpHoles);
 
-					EMIT_1(OPCODE::FETCH, iPosition);
-				}
-				//////////////////////////////////////////////////////////////
+	EMIT_1(OPCODE::PUSHI, bIsOr ? 0 : 1);
+	emitJump(OPCODE::JMP, vEndJmpHoles);
+
+	patchJumps(vDecidedJmpHoles);
+	EMIT_1(OPCODE::PUSHI, bIsOr ? 1 : 0);
+
+	patchJumps(vEndJmpHoles);
+}
+
+void GrammerUtils::emitCondition(ExprNode* pExprNode, bool bJumpIfTrue, std::vector<uint32_t>& vJmpHoles)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Evaluates pExprNode & jumps through vJmpHoles if its truth is bJumpIfTrue,
+	// else falls through. Nothing is left on the STACK.
+	// 1. 'a && b' jumping when false & 'a || b' jumping when true: either
+	//    operand alone decides, so both jump to the same target.
+	// 2. Otherwise the left operand can only decide the other way, it skips
+	//    the right operand which then decides.
+	// 3. A comparison leaves its operands on the STACK & branches on them
+	//    with one BR_xx, no 0/1 is pushed. Whether it is a 'float' comparison
+	//    depends on its own operands, 'x > y && a < b' has one of each.
+	//    A 'float' comparison jumping when false branches on itself past a
+	//    JMP instead: NaN makes both 'a < b' & 'a >= b' false, so the
+	//    opposite comparison won't do.
+	// 4. Any other expression is evaluated & tested with JZ/JNZ.
+	//////////////////////////////////////////////////////////////////////
+	if (isLogicalExpression(pExprNode))
+	{
+		bool bIsAnd = (pExprNode->m_eOperator == TokenType_::Type::TK_LOGICALAND);
+		if (bIsAnd != bJumpIfTrue)
+		{
+			// 1.
+			emitCondition(pExprNode->m_pLeft, bJumpIfTrue, vJmpHoles);
+			emitCondition(pExprNode->m_pRight, bJumpIfTrue, vJmpHoles);
+		}
+		else
+		{
+			// 2.
+			std::vector<uint32_t> vSkipJmpHoles;
+			emitCondition(pExprNode->m_pLeft, NOT bJumpIfTrue, vSkipJmpHoles);
+			emitCondition(pExprNode->m_pRight, bJumpIfTrue, vJmpHoles);
+			patchJumps(vSkipJmpHoles);
+		}
+	}
+	else
+	{
+		bool bIsFP = isFloatingPointExpression(pExprNode);
+		bool bBranchOverJump = (bIsFP && NOT bJumpIfTrue);
+		OPCODE eBranch = (pExprNode != nullptr && pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_BINARY)
+							? branchOpCodeFor(pExprNode->m_eOperator, bIsFP, bJumpIfTrue || bBranchOverJump)
+							: OPCODE::NOP;
+		if (eBranch != OPCODE::NOP)
+		{
+			// 3.
+			emitExpression(pExprNode->m_pLeft, bIsFP);
+			emitExpression(pExprNode->m_pRight, bIsFP);
+			if (bBranchOverJump)
+			{
+				std::vector<uint32_t> vSkipJmpHoles;
+				emitJump(eBranch, vSkipJmpHoles);
+				emitJump(OPCODE::JMP, vJmpHoles);
+				patchJumps(vSkipJmpHoles);
 			}
-			break;
+			else
+				emitJump(eBranch, vJmpHoles);
+		}
+		else
+		{
+			// 4.
+			emitExpression(pExprNode, bIsFP);
+			emitJump(bJumpIfTrue ? OPCODE::JNZ : OPCODE::JZ, vJmpHoles);
 		}
 	}
+}
+
+OPCODE GrammerUtils::branchOpCodeFor(TokenType_::Type eOperator, bool bIsFP, bool bJumpIfTrue)
+{
+	// Jumping when an int comparison is false is jumping on the opposite comparison.
+	// 'float' operands are compared as floats & only ever jump when true, see emitCondition().
+	// NOP if eOperator is not a comparison.
+	assert(bJumpIfTrue || NOT bIsFP);
+	switch (eOperator)
+	{
+		case TokenType_::Type::TK_LT:
+			return bJumpIfTrue ? (bIsFP ? OPCODE::BR_LTF : OPCODE::BR_LT) : OPCODE::BR_GTEQ;
+		case TokenType_::Type::TK_LTEQ:
+			return bJumpIfTrue ? (bIsFP ? OPCODE::BR_LTEQF : OPCODE::BR_LTEQ) : OPCODE::BR_GT;
+		case TokenType_::Type::TK_GT:
+			return bJumpIfTrue ? (bIsFP ? OPCODE::BR_GTF : OPCODE::BR_GT) : OPCODE::BR_LTEQ;
+		case TokenType_::Type::TK_GTEQ:
+			return bJumpIfTrue ? (bIsFP ? OPCODE::BR_GTEQF : OPCODE::BR_GTEQ) : OPCODE::BR_LT;
+		case TokenType_::Type::TK_EQ:
+			return bJumpIfTrue ? (bIsFP ? OPCODE::BR_EQF : OPCODE::BR_EQ) : OPCODE::BR_NEQ;
+		case TokenType_::Type::TK_NEQ:
+			return bJumpIfTrue ? (bIsFP ? OPCODE::BR_NEQF : OPCODE::BR_NEQ) : OPCODE::BR_EQ;
+	}
+
+	return OPCODE::NOP;
+}
+
+void GrammerUtils::emitJump(OPCODE eOPCODE, std::vector<uint32_t>& vJmpHoles)
+{
+#if (VERBOSE == 1)
+	std::cout << CURRENT_OFFSET << ". " << opCodeMap[(int)eOPCODE].sOpCode << std::endl;
+#endif
+	EMIT_BYTE(eOPCODE);
 
-	SET_INFO_FOR_KEY(pNode, "EXPRESSION_RVALUE_TYPE", bIsFP ? "float" : "int32_t");
+	vJmpHoles.push_back(CURRENT_OFFSET);
+	EMIT_INT(0);
+}
+
+void GrammerUtils::patchJumps(std::vector<uint32_t>& vJmpHoles)
+{
+	for (uint32_t iJmpHole : vJmpHoles)
+	{
+		EMIT_INT_ATPOS(CURRENT_OFFSET, iJmpHole);
+#if (VERBOSE == 1)
+		std::cout << "------" << "iJmpHole [" << iJmpHole << "] = " << CURRENT_OFFSET << std::endl;
+#endif
+	}
+
+	vJmpHoles.clear();
+}
+
+std::string GrammerUtils::getExpressionText(Tree* pNode)
+{
+	// Postfix notation of the rvalue, only used to print the AST.
+	if (pNode->m_pExpression == nullptr)
+		return GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
+
+	std::string sText;
+	appendExpressionText(pNode->m_pExpression, sText);
+
+	return sText;
+}
+
+void GrammerUtils::appendExpressionText(ExprNode* pExprNode, std::string& sText)
+{
+	if (pExprNode == nullptr)
+		return;
+
+	appendExpressionText(pExprNode->m_pLeft, sText);
+	appendExpressionText(pExprNode->m_pRight, sText);
+
+	if (NOT sText.empty())
+		sText += ", ";
+
+	sText += pExprNode->m_sText;
+	if (pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_MEMBER)
+		sText += "->" + pExprNode->m_sMemberName;
+	else
+	if (pExprNode->m_eExprNodeType == ExprNodeType_::Type::EXPR_DEREF)
+		sText += ", @";
 }
 
 void GrammerUtils::handlePostFixExpression(Tree* pPostFixNode)
@@ -2803,19 +3318,27 @@ void GrammerUtils::handlePostFixExpression(Tree* pPostFixNode)
 			break;
 		}
 
+		// 'HOSTDATA' fields are owned by the host & mapped read-only into the VM.
+		if (bAddCode && IS_VARIABLE_HOSTDATA( GET_INFO_FOR_KEY(pPostFixNode, ASTInfo::TEXT) ))
+		{
+			assert(false);
+			std::cout << "ERROR: HOSTDATA field '" << GET_INFO_FOR_KEY(pPostFixNode, ASTInfo::TEXT) << "' is read-only." << std::endl;
+			bAddCode = false;
+		}
+
 		if (bAddCode)
 		{
 			/////////////////////////////////////////////////
 			// 1. Fetch variable value & store it onto the stack
-			EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPostFixNode, "text") ));
+			EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPostFixNode, ASTInfo::TEXT) ));
 
 			/////////////////////////////////////////////////
 			// 2. Push integer 1.
 			{
 				int8_t iIncrementValue = 1;
-				if (IS_VARIABLE_POINTER_TYPE( GET_INFO_FOR_KEY(pPostFixNode, "text") ))
+				if (IS_VARIABLE_POINTER_TYPE( GET_INFO_FOR_KEY(pPostFixNode, ASTInfo::TEXT) ))
 				{
-					std::string sType = GET_VARIABLE_NODETYPE( GET_INFO_FOR_KEY(pPostFixNode, "text") );
+					std::string sType = GET_VARIABLE_NODETYPE( GET_INFO_FOR_KEY(pPostFixNode, ASTInfo::TEXT) );
 					iIncrementValue = sizeOf(sType);
 				}
 
@@ -2828,7 +3351,7 @@ void GrammerUtils::handlePostFixExpression(Tree* pPostFixNode)
 
 			//////////////////////////////////////////////////////
 			// 4. Store the decremented/incremented value from the stack back to the variable
-			EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPostFixNode, "text") ));
+			EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pPostFixNode, ASTInfo::TEXT) ));
 		}
 	}
 }
@@ -2836,7 +3359,7 @@ void GrammerUtils::handlePostFixExpression(Tree* pPostFixNode)
 void GrammerUtils::handleCharacter(Tree* pNode)
 {
 	char pStr[255] = { 0 };
-	sprintf_s(pStr, "%d", GET_INFO_FOR_KEY(pNode, "text").c_str()[0]);
+	sprintf_s(pStr, "%d", GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT).c_str()[0]);
 	int ch = atoi(pStr);
 
 	EMIT_1(OPCODE::PUSHI, ch);
@@ -2844,27 +3367,27 @@ void GrammerUtils::handleCharacter(Tree* pNode)
 
 void GrammerUtils::handleInteger(Tree* pNode)
 {
-	EMIT_1(OPCODE::PUSHI, atoi( GET_INFO_FOR_KEY(pNode, "text").c_str() ));
+	EMIT_1(OPCODE::PUSHI, atoi( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT).c_str() ));
 }
 
 void GrammerUtils::handleIdentifier(Tree* pNode)
 {
-	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, "text") ));
+	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) ));
 }
 
 void GrammerUtils::handleString(Tree* pNode)
 {
-	EMIT_1(OPCODE::PUSHI, getStringPosition( GET_INFO_FOR_KEY(pNode, "text").c_str() ));
+	EMIT_1(OPCODE::PUSHI, getStringPosition( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT).c_str() ));
 }
 
 void GrammerUtils::handlePrimitiveInt(Tree* pNode)
 {
 	PRIMIIVETYPE eLVal_PRIMIIVETYPE = PRIMIIVETYPE::INT_32, eRVal_PRIMIIVETYPE = PRIMIIVETYPE::INT_32;
 
-	std::string sFuncType = GET_INFO_FOR_KEY(pNode, "modifyType");
+	std::string sFuncType = GET_INFO_FOR_KEY(pNode, ASTInfo::MODIFYTYPE);
 	if (NOT sFuncType.empty())
 	{
-		std::string sFuncName = GET_INFO_FOR_KEY(pNode, "givenName");
+		std::string sFuncName = GET_INFO_FOR_KEY(pNode, ASTInfo::GIVENNAME);
 		Tree* pRetNode = nullptr;
 		if (sFuncType == "sysFunc")
 		{
@@ -2877,11 +3400,18 @@ void GrammerUtils::handlePrimitiveInt(Tree* pNode)
 			FunctionInfo* pFunctionInfo = pFunctionInfo = GrammerUtils::getGlobalFunctionByName(sFuncName);
 			pRetNode = pFunctionInfo->m_pFunctionReturnType;
 		}
+		else
+		if (sFuncType == "intrinsic")
+		{
+			const IntrinsicMap* pIntrinsic = getIntrinsicByName(sFuncName);
+			assert(pIntrinsic != nullptr && std::string(pIntrinsic->sReturnType) != "void");
+			SET_INFO_FOR_KEY(pNode, ASTInfo::TYPE, pIntrinsic->sReturnType);
+		}
 
 		if (pRetNode != nullptr)
 		{
-			std::string sType = GET_INFO_FOR_KEY(pRetNode, "text");
-			SET_INFO_FOR_KEY(pNode, "type", sType.c_str());
+			std::string sType = GET_INFO_FOR_KEY(pRetNode, ASTInfo::TEXT);
+			SET_INFO_FOR_KEY(pNode, ASTInfo::TYPE, sType.c_str());
 		}
 	}
 
@@ -2897,7 +3427,7 @@ void GrammerUtils::handlePrimitiveInt(Tree* pNode)
 
 				// If its a Function Call, get its 'return' type & set the RValue to it.
 				{
-					std::string sFuncName = GET_INFO_FOR_KEY(pChild, "text");
+					std::string sFuncName = GET_INFO_FOR_KEY(pChild, ASTInfo::TEXT);
 					Tree* pRetNode = nullptr;
 					if (pChild->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONCALL)
 					{
@@ -2905,7 +3435,7 @@ void GrammerUtils::handlePrimitiveInt(Tree* pNode)
 						if (pFunctionInfo != nullptr)
 						{
 							pRetNode = pFunctionInfo->m_pFunctionReturnType;
-							std::string sType = GET_INFO_FOR_KEY(pRetNode, "text");
+							std::string sType = GET_INFO_FOR_KEY(pRetNode, ASTInfo::TEXT);
 							eRVal_PRIMIIVETYPE = getTypeByString(sType);
 						}
 					}
@@ -2916,10 +3446,19 @@ void GrammerUtils::handlePrimitiveInt(Tree* pNode)
 						if (pSystemFuncNode != nullptr)
 						{
 							pRetNode = pSystemFuncNode->m_pLeftNode;
-							std::string sType = GET_INFO_FOR_KEY(pRetNode, "text");
+							std::string sType = GET_INFO_FOR_KEY(pRetNode, ASTInfo::TEXT);
 							eRVal_PRIMIIVETYPE = getTypeByString(sType);
 						}
 					}
+					else
+					if (pChild->m_eASTNodeType == ASTNodeType::ASTNode_INTRINSIC)
+					{
+						const IntrinsicMap* pIntrinsic = getIntrinsicByName(sFuncName);
+						if (pIntrinsic != nullptr)
+						{
+							eRVal_PRIMIIVETYPE = getTypeByString(pIntrinsic->sReturnType);
+						}
+					}
 				}
 			}
 
@@ -2927,9 +3466,16 @@ void GrammerUtils::handlePrimitiveInt(Tree* pNode)
 		}
 		else
 		{
+			eLVal_PRIMIIVETYPE = getTypeByString( GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE) );
+			if (emitConstantRValue(pExpressionNode, eLVal_PRIMIIVETYPE))
+			{
+				EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) ));
+				return;
+			}
+
 			populateCode(pExpressionNode);
 
-			std::string sType = GET_INFO_FOR_KEY(pExpressionNode, "EXPRESSION_RVALUE_TYPE");
+			std::string sType = GET_INFO_FOR_KEY(pExpressionNode, ASTInfo::EXPRESSION_RVALUE_TYPE);
 			eRVal_PRIMIIVETYPE = getTypeByString(sType);
 		}
 
@@ -2938,10 +3484,10 @@ void GrammerUtils::handlePrimitiveInt(Tree* pNode)
 		// & the final value on the STACK is then 'ANDED(&)' with this variable's 'type'(check 'castValueFor()' for more info)
 		// and then pushed onto the STACK which is later stored in the variable.
 		{
-			eLVal_PRIMIIVETYPE = getTypeByString( GET_INFO_FOR_KEY(pNode, "type") );
+			eLVal_PRIMIIVETYPE = getTypeByString( GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE) );
 			EMIT_2(OPCODE::CAST, eLVal_PRIMIIVETYPE, eRVal_PRIMIIVETYPE);
 		}
-		EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, "text") ));
+		EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) ));
 	}
 }
 
@@ -2950,8 +3496,8 @@ void GrammerUtils::allocateTypeArray(Tree* pNode)
 	Tree* pArraySizeLeaf = pNode->m_pLeftNode;
 	Tree* pArrayElementsLeaf = pNode->m_pRightNode;
 
-	std::string sType = GET_INFO_FOR_KEY(pNode, "type");
-	E_VARIABLESCOPE eVARIABLESCOPE = toScope(GET_INFO_FOR_KEY(pNode, "scope"));
+	std::string sType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
+	E_VARIABLESCOPE eVARIABLESCOPE = pNode->m_eScope;
 	int32_t iSize = 0;
 
 	//////////////////////////////////////////////////////////////
@@ -2959,7 +3505,7 @@ void GrammerUtils::allocateTypeArray(Tree* pNode)
 	{
 		if (pArraySizeLeaf != nullptr)
 		{
-			iSize = atoi(GET_INFO_FOR_KEY(pArraySizeLeaf, "text").c_str());
+			iSize = atoi(GET_INFO_FOR_KEY(pArraySizeLeaf, ASTInfo::TEXT).c_str());
 		}
 		else
 		{
@@ -2975,7 +3521,7 @@ void GrammerUtils::allocateTypeArray(Tree* pNode)
 		{
 			if (eVARIABLESCOPE == E_VARIABLESCOPE::MEMBER)
 			{
-				std::string sVariableName = GET_INFO_FOR_KEY(pNode, "givenName");
+				std::string sVariableName = GET_INFO_FOR_KEY(pNode, ASTInfo::GIVENNAME);
 				int32_t iPosition = getMemberPositionInStructHierarchy(sVariableName, m_pCurrentStruct);
 
 				EMIT_1(OPCODE::STORE, iPosition);			// Store the memory address in the array variable.
@@ -2983,7 +3529,7 @@ void GrammerUtils::allocateTypeArray(Tree* pNode)
 			else
 			if (eVARIABLESCOPE == E_VARIABLESCOPE::LOCAL)
 			{
-				EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, "text")));	// Store the memory address in the array variable.
+				EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT)));	// Store the memory address in the array variable.
 			}
 		}
 	}
@@ -2994,14 +3540,14 @@ void GrammerUtils::initializeTypeArray(Tree* pNode)
 	Tree* pArraySizeLeaf = pNode->m_pLeftNode;
 	Tree* pArrayElementsLeaf = pNode->m_pRightNode;
 
-	std::string sType = GET_INFO_FOR_KEY(pNode, "type");
-	E_VARIABLESCOPE eVARIABLESCOPE = toScope(GET_INFO_FOR_KEY(pNode, "scope"));
+	std::string sType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
+	E_VARIABLESCOPE eVARIABLESCOPE = pNode->m_eScope;
 	int32_t iSize = 0;
 
 	// Calculate size to allocate / initilize.
 	if (pArraySizeLeaf != nullptr)
 	{
-		iSize = atoi(GET_INFO_FOR_KEY(pArraySizeLeaf, "text").c_str());
+		iSize = atoi(GET_INFO_FOR_KEY(pArraySizeLeaf, ASTInfo::TEXT).c_str());
 	}
 	else
 	{
@@ -3036,7 +3582,7 @@ void GrammerUtils::initializeTypeArray(Tree* pNode)
 		{
 			// arr[5..7] = 0; ------------ - (II)
 
-			std::string sVariableName = GET_INFO_FOR_KEY(pNode, "text");
+			std::string sVariableName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 			int32_t iOperand1_PointerVariable = GET_VARIABLE_POSITION(sVariableName);			// 1. "arr" position in heap
 			int32_t iOperand2_StartPos = iCount;												// 2. '5'
 			int32_t iOperand3_LastPos = iSize;													// 3. Count (in this case, 3 i.e for 5, 6, 7)
@@ -3066,7 +3612,7 @@ void GrammerUtils::initializeTypeArray(Tree* pNode)
 
 void GrammerUtils::handleTypeArray(Tree* pNode)
 {
-	E_VARIABLESCOPE eVARIABLESCOPE = toScope(GET_INFO_FOR_KEY(pNode, "scope"));
+	E_VARIABLESCOPE eVARIABLESCOPE = pNode->m_eScope;
 	allocateTypeArray(pNode);
 
 	initializeTypeArray(pNode);
@@ -3074,7 +3620,7 @@ void GrammerUtils::handleTypeArray(Tree* pNode)
 
 void GrammerUtils::handlePrimitivePtrEpilogue(Tree* pNode)
 {
-	EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, "text") ));
+	EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) ));
 }
 
 void GrammerUtils::handleAssign(Tree* pNode)
@@ -3082,7 +3628,7 @@ void GrammerUtils::handleAssign(Tree* pNode)
 	Tree* pExpressionNode = pNode->m_pLeftNode;
 	Tree* pIdentifierNode = pNode->m_pRightNode;	// Remember we have added expression node(rvalue) to any parent's Left.
 													// In case of ASSIGN, right node will be the lvalue.
-	std::string sVariableName = GET_INFO_FOR_KEY(pNode, "text");
+	std::string sVariableName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 	PRIMIIVETYPE eLVal_PRIMIIVETYPE = PRIMIIVETYPE::INT_32, eRVal_PRIMIIVETYPE = PRIMIIVETYPE::INT_32;
 
 	//////////////////////////////////////////////////////////////
@@ -3092,9 +3638,23 @@ void GrammerUtils::handleAssign(Tree* pNode)
 		handlePreFixExpression(pExpressionNode->m_pLeftNode);
 	}
 
-	populateCode(pExpressionNode);
-	std::string sType = GET_INFO_FOR_KEY(pExpressionNode, "EXPRESSION_RVALUE_TYPE");
-	eRVal_PRIMIIVETYPE = getTypeByString(sType);
+	// A literal stored in a plain variable is cast right away.
+	bool bIsConstantRValue = false;
+	if (	pIdentifierNode->m_eASTNodeType == ASTNodeType::ASTNode_IDENTIFIER
+			&&
+			NOT IS_VARIABLE_POINTER_TYPE(sVariableName)
+			&&
+			NOT IS_VARIABLE_HOSTDATA(sVariableName)
+	) {
+		bIsConstantRValue = emitConstantRValue(pExpressionNode, getTypeByString(GET_VARIABLE_NODETYPE(sVariableName)));
+	}
+
+	if (NOT bIsConstantRValue)
+	{
+		populateCode(pExpressionNode);
+		std::string sType = GET_INFO_FOR_KEY(pExpressionNode, ASTInfo::EXPRESSION_RVALUE_TYPE);
+		eRVal_PRIMIIVETYPE = getTypeByString(sType);
+	}
 
 	//////////////////////////////////////////////////////////////
 	// Cast only int8_t, int16_t, int32_t, @DEREF assignments to their respective 'TYPES'.
@@ -3112,7 +3672,15 @@ void GrammerUtils::handleAssign(Tree* pNode)
 			{
 				std::string sType = GET_VARIABLE_NODETYPE( sVariableName );
 
-				if (NOT IS_VARIABLE_POINTER_TYPE(sVariableName))
+				// 'HOSTDATA' fields are owned by the host & mapped read-only into the VM.
+				assert(NOT IS_VARIABLE_HOSTDATA(sVariableName));
+				if (IS_VARIABLE_HOSTDATA(sVariableName))
+				{
+					std::cout << "ERROR: HOSTDATA field '" << sVariableName << "' is read-only." << std::endl;
+					break;
+				}
+
+				if (NOT IS_VARIABLE_POINTER_TYPE(sVariableName) && NOT bIsConstantRValue)
 				{
 					eLVal_PRIMIIVETYPE = getTypeByString(sType);
 					EMIT_2(OPCODE::CAST, eLVal_PRIMIIVETYPE, eRVal_PRIMIIVETYPE);
@@ -3156,8 +3724,8 @@ void GrammerUtils::handleAssign(Tree* pNode)
 			break;
 			case ASTNodeType::ASTNode_MEMBERACCESS:
 			{
-				std::string sObjectName = GET_INFO_FOR_KEY(pNode, "text");
-				std::string sVariableName = GET_INFO_FOR_KEY(pIdentifierNode, "text");
+				std::string sObjectName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
+				std::string sVariableName = GET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::TEXT);
 				std::string sStructType = "";
 				if (sObjectName == "this")
 				{
@@ -3196,8 +3764,8 @@ void GrammerUtils::handleAssign(Tree* pNode)
 			break;
 			case ASTNodeType::ASTNode_MEMBERACCESSDEREF:
 			{
-				std::string sObjectName = GET_INFO_FOR_KEY(pNode, "text");
-				std::string sVariableName = GET_INFO_FOR_KEY(pIdentifierNode, "text");
+				std::string sObjectName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
+				std::string sVariableName = GET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::TEXT);
 				std::string sStructType = "";
 				if (sObjectName == "this")
 				{
@@ -3261,11 +3829,12 @@ void GrammerUtils::handleReturnStatement(Tree* pNode)
 
 void GrammerUtils::handleIfWhile(Tree* pNode)
 {
-	int i_IfWhile_JCondition_Hole = 0, i_While_Loop_Hole = 0, i_ElseEnd_JMP_Offset = 0;
+	int i_While_Loop_Hole = 0, i_ElseEnd_JMP_Offset = 0;
+	std::vector<uint32_t> vIfWhile_JCondition_Holes;
 
 	// Prologues
 	{
-		handleIfWhile_Prologue(pNode, i_While_Loop_Hole, i_IfWhile_JCondition_Hole);
+		handleIfWhile_Prologue(pNode, i_While_Loop_Hole, vIfWhile_JCondition_Holes);
 	}
 
 	// Intermediates
@@ -3279,37 +3848,32 @@ void GrammerUtils::handleIfWhile(Tree* pNode)
 		{
 			case ASTNodeType::ASTNode_IF:
 			{
-				handleIf_Epilogue(pNode, i_ElseEnd_JMP_Offset, i_IfWhile_JCondition_Hole);
+				handleIf_Epilogue(pNode, i_ElseEnd_JMP_Offset, vIfWhile_JCondition_Holes);
 			}
 			break;
 			case ASTNodeType::ASTNode_WHILE:
 			{
-				handleWhile_Epilogue(pNode, i_While_Loop_Hole, i_IfWhile_JCondition_Hole);
+				handleWhile_Epilogue(pNode, i_While_Loop_Hole, vIfWhile_JCondition_Holes);
 			}
 			break;
 		}
 	}
 }
 
-void GrammerUtils::handleIfWhile_Prologue(Tree* pNode, int& i_While_Loop_Hole, int& i_IfWhile_JCondition_Hole)
+void GrammerUtils::handleIfWhile_Prologue(Tree* pNode, int& i_While_Loop_Hole, std::vector<uint32_t>& vIfWhile_JCondition_Holes)
 {
 	Tree* pExpressionNode = pNode->m_pLeftNode;		// Remember we have added expression node(rvalue) to any parent's Left.
 	{
 		i_While_Loop_Hole = CURRENT_OFFSET;
 
-		handleExpression(pExpressionNode);
-
-		EMIT_BYTE(OPCODE::JZ);
-#if (VERBOSE == 1)
-		std::cout << CURRENT_OFFSET << ". " << "JZ" << std::endl;
-#endif
-
-		i_IfWhile_JCondition_Hole = CURRENT_OFFSET;
-		EMIT_INT(0);
+		// Every '&&' & '||' of the condition jumps straight to the false branch or into the body,
+		// so no 0/1 is computed for them.
+		ExprNode* pCondition = pExpressionNode->m_pExpression;
+		emitCondition(pCondition, false, vIfWhile_JCondition_Holes);
 	}
 }
 
-void GrammerUtils::handleIf_Epilogue(Tree* pNode, int& i_ElseEnd_JMP_Offset, int& i_IfWhile_JCondition_Hole)
+void GrammerUtils::handleIf_Epilogue(Tree* pNode, int& i_ElseEnd_JMP_Offset, std::vector<uint32_t>& vIfWhile_JCondition_Holes)
 {
 	Tree* pElseNode = pNode->m_pRightNode;
 
@@ -3320,10 +3884,7 @@ void GrammerUtils::handleIf_Epilogue(Tree* pNode, int& i_ElseEnd_JMP_Offset, int
 	i_ElseEnd_JMP_Offset = CURRENT_OFFSET;
 	EMIT_INT(0);
 
-	EMIT_INT_ATPOS(CURRENT_OFFSET, i_IfWhile_JCondition_Hole);
-#if (VERBOSE == 1)
-	std::cout << "------" << "i_IfWhile_JCondition_Hole [" << i_IfWhile_JCondition_Hole << "] = " << CURRENT_OFFSET << std::endl;
-#endif
+	patchJumps(vIfWhile_JCondition_Holes);
 
 	if (pElseNode != nullptr)
 	{
@@ -3336,7 +3897,7 @@ void GrammerUtils::handleIf_Epilogue(Tree* pNode, int& i_ElseEnd_JMP_Offset, int
 #endif
 }
 
-void GrammerUtils::handleWhile_Epilogue(Tree* pNode, int& i_While_Loop_Hole, int& i_IfWhile_JCondition_Hole)
+void GrammerUtils::handleWhile_Epilogue(Tree* pNode, int& i_While_Loop_Hole, std::vector<uint32_t>& vIfWhile_JCondition_Holes)
 {
 #if (VERBOSE == 1)
 	std::cout << CURRENT_OFFSET << ". " << "JMP" << std::endl;
@@ -3345,20 +3906,20 @@ void GrammerUtils::handleWhile_Epilogue(Tree* pNode, int& i_While_Loop_Hole, int
 
 #if (VERBOSE == 1)
 	std::cout << "------" << "i_While_Loop_Hole [" << CURRENT_OFFSET << "] = " << i_While_Loop_Hole << std::endl;
-	std::cout << "------" << "i_IfWhile_JCondition_Hole [" << i_IfWhile_JCondition_Hole << "] = " << CURRENT_OFFSET << std::endl;
 #endif
 	EMIT_INT(i_While_Loop_Hole);
-	EMIT_INT_ATPOS(CURRENT_OFFSET, i_IfWhile_JCondition_Hole);
+	patchJumps(vIfWhile_JCondition_Holes);
 }
 
 void GrammerUtils::handleSwitch(Tree* pNode)
 {
 	std::vector<uint32_t> vCaseStartOffsets;
 	std::vector<uint32_t> vCaseBreakJmpHoles;
+	SwitchJmpHoles vCaseJmpHoles;
 
-	handleSwitchCasePrologue(pNode, vCaseStartOffsets);
+	handleSwitchCasePrologue(pNode, vCaseJmpHoles);
 	handleSwitchCases(pNode, vCaseStartOffsets, vCaseBreakJmpHoles);
-	handleSwitchCaseEpilogues(pNode, vCaseBreakJmpHoles);
+	handleSwitchCaseEpilogues(pNode, vCaseStartOffsets, vCaseJmpHoles, vCaseBreakJmpHoles);
 }
 
 void GrammerUtils::handleSwitchArgument(Tree* pNode)
@@ -3378,53 +3939,154 @@ void GrammerUtils::handleSwitchArgument(Tree* pNode)
 	}
 }
 
-void GrammerUtils::handleSwitchCasePrologue(Tree* pNode, std::vector<uint32_t>& vCaseStartOffsets)
+void GrammerUtils::handleSwitchCasePrologue(Tree* pNode, SwitchJmpHoles& vCaseJmpHoles)
 {
+	/////////////////////////////////////////////////
+	// 1. Collect the case values, the first of two equal cases wins.
+	SwitchCaseValues vCaseValues;
+	std::set<int32_t> setValues;
+	int32_t iDefaultCase = SWITCH_END;
+
+	int32_t iCase = 0;
 	for (Tree* pSwitchCaseNode : pNode->m_vStatements)
 	{
 		switch (pSwitchCaseNode->m_eASTNodeType)
 		{
 			case ASTNodeType::ASTNode_SWITCHCASE:
 			{
-				handleSwitchArgument(pNode->m_pLeftNode);
-
-				handleInteger(pSwitchCaseNode);
-				EMIT_1(OPCODE::JMP_EQ, 0);
-
-#if (VERBOSE == 1)
-				std::cout << CURRENT_OFFSET << ". " << "JNZ" << std::endl;
-#endif
-				EMIT_BYTE(OPCODE::JNZ);
-
-				vCaseStartOffsets.push_back(CURRENT_OFFSET);
-				EMIT_INT(0);
+				int32_t iValue = atoi(GET_INFO_FOR_KEY(pSwitchCaseNode, ASTInfo::TEXT).c_str());
+				if (setValues.insert(iValue).second)
+					vCaseValues.push_back(std::make_pair(iValue, iCase));
 			}
 			break;
 			case ASTNodeType::ASTNode_SWITCHDEFAULT:
 			{
+				iDefaultCase = iCase;
+			}
+			break;
+		}
+
+		iCase++;
+	}
+
+	std::sort(vCaseValues.begin(), vCaseValues.end());
+
+	/////////////////////////////////////////////////
+	// 2. Evaluate the switch argument once.
+	handleSwitchArgument(pNode->m_pLeftNode);
+
+	/////////////////////////////////////////////////
+	// 3. Dense cases index a jump table, sparse ones are found by a binary search on the argument.
+	int64_t iSpread = vCaseValues.empty() ? 0 : (int64_t)vCaseValues.back().first - vCaseValues.front().first + 1;
+	if (	vCaseValues.size() >= SWITCH_JMPTABLE_MIN_CASES
+			&&
+			iSpread <= (int64_t)vCaseValues.size() * SWITCH_JMPTABLE_MAX_SPREAD
+	) {
+		handleSwitchJumpTable(vCaseValues, iDefaultCase, vCaseJmpHoles);
+	}
+	else
+	{
+		EMIT_1(OPCODE::POPR, EREGISTERS::RDX);					// Keep the argument in 'EDX' while comparing.
+		handleSwitchCompareTree(vCaseValues, 0, (int32_t)vCaseValues.size() - 1, iDefaultCase, vCaseJmpHoles);
+	}
+}
+
+void GrammerUtils::handleSwitchJumpTable(const SwitchCaseValues& vCaseValues, int32_t iDefaultCase, SwitchJmpHoles& vCaseJmpHoles)
+{
+	// JMPTABLE iCount iLow iDefault iOffset[iCount]
+	// The VM jumps to iOffset[argument - iLow], or to iDefault if the argument is out of range.
+	int32_t iLow = vCaseValues.front().first;
+	int32_t iCount = vCaseValues.back().first - iLow + 1;
+
 #if (VERBOSE == 1)
-				std::cout << CURRENT_OFFSET << ". " << "JMP" << std::endl;
+	std::cout << CURRENT_OFFSET << ". " << "JMPTABLE " << iCount << " " << iLow << std::endl;
 #endif
-				EMIT_BYTE(OPCODE::JMP);
+	EMIT_BYTE(OPCODE::JMPTABLE);
+	EMIT_INT(iCount);
+	EMIT_INT(iLow);
 
-				vCaseStartOffsets.push_back(CURRENT_OFFSET);
-				EMIT_INT(0);
-			}
-			break;
+	vCaseJmpHoles.push_back(std::make_pair(CURRENT_OFFSET, iDefaultCase));
+	EMIT_INT(0);
+
+	// Values without a case of their own go to the default.
+	size_t iNext = 0;
+	for (int32_t i = 0; i < iCount; i++)
+	{
+		int32_t iCase = iDefaultCase;
+		if (iNext < vCaseValues.size() && vCaseValues[iNext].first == iLow + i)
+			iCase = vCaseValues[iNext++].second;
+
+		vCaseJmpHoles.push_back(std::make_pair(CURRENT_OFFSET, iCase));
+		EMIT_INT(0);
+	}
+}
+
+void GrammerUtils::handleSwitchCompareTree(const SwitchCaseValues& vCaseValues, int32_t iFirst, int32_t iLast, int32_t iDefaultCase, SwitchJmpHoles& vCaseJmpHoles)
+{
+	/////////////////////////////////////////////////
+	// A few cases are tested one after the other:
+	//		PUSHR EDX, PUSHI value, JMP_EQ, JNZ case
+	//		...
+	//		JMP default
+	if (iLast - iFirst + 1 <= SWITCH_LINEAR_CASES)
+	{
+		for (int32_t i = iFirst; i <= iLast; i++)
+		{
+			EMIT_1(OPCODE::PUSHR, EREGISTERS::RDX);
+			EMIT_1(OPCODE::PUSHI, vCaseValues[i].first);
+			EMIT_1(OPCODE::JMP_EQ, 0);
+			handleSwitchJump(OPCODE::JNZ, vCaseValues[i].second, vCaseJmpHoles);
 		}
+
+		handleSwitchJump(OPCODE::JMP, iDefaultCase, vCaseJmpHoles);
+		return;
 	}
+
+	/////////////////////////////////////////////////
+	// Otherwise split the cases at the middle value:
+	//		PUSHR EDX, PUSHI middle, JMP_LT, JNZ lower_half
+	//		upper_half ...
+	//		lower_half ...
+	int32_t iMiddle = iFirst + (iLast - iFirst + 1) / 2;
+
+	EMIT_1(OPCODE::PUSHR, EREGISTERS::RDX);
+	EMIT_1(OPCODE::PUSHI, vCaseValues[iMiddle].first);
+	EMIT_1(OPCODE::JMP_LT, 0);
+
+#if (VERBOSE == 1)
+	std::cout << CURRENT_OFFSET << ". " << "JNZ" << std::endl;
+#endif
+	EMIT_BYTE(OPCODE::JNZ);
+	uint32_t iLowerHalfHole = CURRENT_OFFSET;
+	EMIT_INT(0);
+
+	handleSwitchCompareTree(vCaseValues, iMiddle, iLast, iDefaultCase, vCaseJmpHoles);
+
+	EMIT_INT_ATPOS(CURRENT_OFFSET, iLowerHalfHole);
+	handleSwitchCompareTree(vCaseValues, iFirst, iMiddle - 1, iDefaultCase, vCaseJmpHoles);
+}
+
+void GrammerUtils::handleSwitchJump(OPCODE eOPCODE, int32_t iCase, SwitchJmpHoles& vCaseJmpHoles)
+{
+#if (VERBOSE == 1)
+	std::cout << CURRENT_OFFSET << ". " << opCodeMap[(int)eOPCODE].sOpCode << std::endl;
+#endif
+	EMIT_BYTE(eOPCODE);
+
+	vCaseJmpHoles.push_back(std::make_pair(CURRENT_OFFSET, iCase));
+	EMIT_INT(0);
 }
 
 void GrammerUtils::handleSwitchCases(Tree* pNode, std::vector<uint32_t>& vCaseStartOffsets, std::vector<uint32_t>& vCaseBreakJmpHoles)
 {
-	int iCase = 0;
 	for (Tree* pSwitchCaseNode : pNode->m_vStatements)
 	{
 		switch (pSwitchCaseNode->m_eASTNodeType)
 		{
 			case ASTNodeType::ASTNode_SWITCHCASE:
+			case ASTNodeType::ASTNode_SWITCHDEFAULT:
 			{
-				EMIT_INT_ATPOS(CURRENT_OFFSET, vCaseStartOffsets[iCase++]);
+				vCaseStartOffsets.push_back(CURRENT_OFFSET);
 				handleStatements(pSwitchCaseNode);
 
 				for (Tree* pChildNode : pSwitchCaseNode->m_vStatements)
@@ -3442,29 +4104,21 @@ void GrammerUtils::handleSwitchCases(Tree* pNode, std::vector<uint32_t>& vCaseSt
 				}
 			}
 			break;
-			case ASTNodeType::ASTNode_SWITCHDEFAULT:
-			{
-				EMIT_INT_ATPOS(CURRENT_OFFSET, vCaseStartOffsets[iCase++]);
-				handleStatements(pSwitchCaseNode);
-
-				for (Tree* pChildNode : pSwitchCaseNode->m_vStatements)
-				{
-					if (pChildNode->m_eASTNodeType == ASTNodeType::ASTNode_SWITCHBREAK)
-					{
-#if (VERBOSE == 1)
-						std::cout << CURRENT_OFFSET << ". " << "JMP" << std::endl;
-#endif
-						EMIT_BYTE(OPCODE::JMP);
-					}
-				}
-			}
+			default:
+				vCaseStartOffsets.push_back(CURRENT_OFFSET);
 			break;
 		}
 	}
 }
 
-void GrammerUtils::handleSwitchCaseEpilogues(Tree* pNode, std::vector<uint32_t>& vCaseBreakJmpHoles)
+void GrammerUtils::handleSwitchCaseEpilogues(Tree* pNode, std::vector<uint32_t>& vCaseStartOffsets, SwitchJmpHoles& vCaseJmpHoles, std::vector<uint32_t>& vCaseBreakJmpHoles)
 {
+	for (auto& itrHole : vCaseJmpHoles)
+	{
+		uint32_t iTarget = (itrHole.second == SWITCH_END) ? CURRENT_OFFSET : vCaseStartOffsets[itrHole.second];
+		EMIT_INT_ATPOS(iTarget, itrHole.first);
+	}
+
 	for (int iBreakJumpHole : vCaseBreakJmpHoles)
 	{
 		EMIT_INT_ATPOS(CURRENT_OFFSET, iBreakJumpHole);
@@ -3484,7 +4138,7 @@ void GrammerUtils::handleMemSet(Tree* pNode)
 {
 	/////////////////////////////////////////////////
 	// 1. Fetch Pointer to the block of memory to fill & store it onto the stack.
-	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, "src")));
+	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, ASTInfo::SRC)));
 
 	/////////////////////////////////////////////////
 	// 2. Value to be set.
@@ -3513,11 +4167,11 @@ void GrammerUtils::handleMemCpy(Tree* pNode)
 {
 	/////////////////////////////////////////////////
 	// 1. Fetch Pointer to the destination array where the content is to be copied & store it onto the stack.
-	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, "src")));
+	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, ASTInfo::SRC)));
 
 	/////////////////////////////////////////////////
 	// 2. Fetch Pointer to the source of data to be copied & store it onto the stack.
-	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, "dst")));
+	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, ASTInfo::DST)));
 
 	/////////////////////////////////////////////////
 	// 3. Number of bytes to copy.
@@ -3537,11 +4191,11 @@ void GrammerUtils::handleMemCmp(Tree* pNode)
 {
 	/////////////////////////////////////////////////
 	// 1. Fetch Pointer to block of memory & store it onto the stack.
-	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, "src")));
+	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, ASTInfo::SRC)));
 
 	/////////////////////////////////////////////////
 	// 2. Fetch Pointer to block of memory & store it onto the stack.
-	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, "dst")));
+	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, ASTInfo::DST)));
 
 	/////////////////////////////////////////////////
 	// 3. Number of bytes to compare.
@@ -3561,11 +4215,48 @@ void GrammerUtils::handleMemCmp(Tree* pNode)
 	EMIT_1(OPCODE::POPR, EREGISTERS::RAX);
 }
 
+void GrammerUtils::handleIntrinsic(Tree* pNode)
+{
+	std::string sIntrinsic = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
+	const IntrinsicMap* pIntrinsic = getIntrinsicByName(sIntrinsic);
+	assert(pIntrinsic != nullptr);
+	if (pIntrinsic != nullptr)
+	{
+		assert(pNode->m_vStatements.size() == pIntrinsic->iArgumentCount);
+
+		/////////////////////////////////////////////////
+		// 1. Push the arguments left to right, each one cast to the intrinsic's argument type.
+		for (Tree* pArgNode : pNode->m_vStatements)
+		{
+			assert(pArgNode->m_eASTNodeType == ASTNodeType::ASTNode_EXPRESSION);
+			populateCode(pArgNode);
+
+			PRIMIIVETYPE eRVal_PRIMIIVETYPE = getTypeByString(GET_INFO_FOR_KEY(pArgNode, ASTInfo::EXPRESSION_RVALUE_TYPE));
+			if (eRVal_PRIMIIVETYPE != pIntrinsic->eArgumentType)
+			{
+				EMIT_2(OPCODE::CAST, pIntrinsic->eArgumentType, eRVal_PRIMIIVETYPE);
+			}
+		}
+
+		/////////////////////////////////////////////////
+		// 2. The intrinsic's opcode works directly on the STACK, no 'SYSCALL' to the host.
+		//		- 'AWAIT' may park the VM till the host completes the async call.
+		EMIT_1(pIntrinsic->eOpCode, 0);
+
+		/////////////////////////////////////////////////
+		// 3. Fetch the return value into 'EAX'
+		if (std::string(pIntrinsic->sReturnType) != "void")
+		{
+			EMIT_1(OPCODE::POPR, EREGISTERS::RAX);
+		}
+	}
+}
+
 void GrammerUtils::handleMemChr(Tree* pNode)
 {
 	/////////////////////////////////////////////////
 	// 1. Fetch Pointer to the block of memory where the search is performed & store it onto the stack.
-	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, "src")));
+	EMIT_1(OPCODE::FETCH, GET_VARIABLE_POSITION(GET_INFO_FOR_KEY(pNode, ASTInfo::SRC)));
 
 	/////////////////////////////////////////////////
 	// 2. Value to be searched.
@@ -3596,7 +4287,7 @@ void GrammerUtils::handleSizeOf(Tree* pNode)
 	assert(pStringNode != nullptr);
 	if (pStringNode != nullptr)
 	{
-		std::string sSizeOfArgumet = GET_INFO_FOR_KEY(pStringNode, "text");
+		std::string sSizeOfArgumet = GET_INFO_FOR_KEY(pStringNode, ASTInfo::TEXT);
 		int32_t iSize = sizeOf(sSizeOfArgumet);
 		assert(iSize > 0);
 		if (iSize > 0)
@@ -3617,7 +4308,7 @@ void GrammerUtils::handleFree(Tree* pNode)
 	////////////////////////////////////////////////////////////////////
 	// I. Search for the 'Pointer Variable' AST Node; 
 	////////////////////////////////////////////////////////////////////
-	std::string sPointerName = GET_INFO_FOR_KEY(pNode, "text");
+	std::string sPointerName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 	Tree* pPointerNode = m_pCurrentFunction->getLocalVariableASTNode(sPointerName);
 
 	////////////////////////////////////////////////////////////////////
@@ -3626,7 +4317,7 @@ void GrammerUtils::handleFree(Tree* pNode)
 	assert(pPointerNode != nullptr);
 	if (pPointerNode != nullptr)			// Pointer Variable AST found !
 	{
-		std::string sType = GET_INFO_FOR_KEY(pPointerNode, "type");
+		std::string sType = GET_INFO_FOR_KEY(pPointerNode, ASTInfo::TYPE);
 		if (sType == "int8_t"
 			||
 			sType == "int16_t"
@@ -3646,13 +4337,15 @@ void GrammerUtils::handleFree(Tree* pNode)
 			// 2. Call the 'Destructor' by creating a Dummy Destructor under the "free" ASTNode.
 			std::string sDestructor = "#" + sType;
 			Tree* pDefaultDestructor = createFunctionCallWithNoArguments(sDestructor.c_str());
-			SET_INFO_FOR_KEY(pDefaultDestructor, "memberFunctionOf", sType);
+			SET_INFO_FOR_KEY(pDefaultDestructor, ASTInfo::MEMBERFUNCTIONOF, sType);
 			pNode->addChild(pDefaultDestructor);
 
 			populateCode(pDefaultDestructor);
 
 			// 3. Free the pointer itself that holds 'this' object.
-			EMIT_1(OPCODE::FREE, GET_VARIABLE_POSITION(sPointerName));
+			//		- An object in the STACK FRAME goes with it, see EscapeAnalysis.h.
+			if (m_pCurrentFunction->m_MapStackObjects.count(pPointerNode) == 0)
+				EMIT_1(OPCODE::FREE, GET_VARIABLE_POSITION(sPointerName));
 
 			// 4. Clear off 'ECX' that holds the address of 'this'
 			//EMIT_1(OPCODE::PUSH, 0);
@@ -3666,6 +4359,15 @@ void GrammerUtils::handleStatics(Tree* pNode)
 	FunctionInfo::addStaticVariable(pNode);
 }
 
+void GrammerUtils::handleHostData(Tree* pNode)
+{
+	/////////////////////////////////////////////////////////////////
+	// 'HOSTDATA' fields don't emit any code.
+	// Reads are plain FETCH (HOST << 16 | iPosition), the VM resolves the position
+	// to the host's field by name while loading the header.
+	FunctionInfo::addHostVariable(pNode);
+}
+
 void GrammerUtils::handleTypeStructs(Tree* pNode)
 {
 	//////////////////////////////////////////////////////////////////
@@ -3673,13 +4375,31 @@ void GrammerUtils::handleTypeStructs(Tree* pNode)
 	//		- Remember all the object allocations happen on the HEAP & not on the STACK.
 	//		- No STACK based BUFFER OVERFLOW(BO) possible.
 	//		- The objects once allocated on the HEAP, should be freed when they go out of scope.
+	//		- Except an object that never leaves the function(), it is built in the STACK FRAME, see EscapeAnalysis.h.
 	//////////////////////////////////////////////////////////////////
-	std::string sType = GET_INFO_FOR_KEY(pNode, "type");
+	std::string sType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
 	StructInfo* pStructInfo = getStructByName(sType);
-	EMIT_1(OPCODE::PUSHI, pStructInfo->sizeOf());							// Push variable size of STRUCT onto the STACK as it will be pulled in by MALLOC @ RT.
+	std::unordered_map<Tree*, int32_t>::const_iterator itrStackObject = m_pCurrentFunction->m_MapStackObjects.find(pNode);
+	if (itrStackObject != m_pCurrentFunction->m_MapStackObjects.end())
+	{
+		// Zeroed like a fresh HEAP block, the LOCALs still hold what an earlier call left.
+		int32_t iObjectPosition = ((int32_t)E_VARIABLESCOPE::LOCAL << (sizeof(int16_t) * 8)) | (itrStackObject->second & 0x0000FFFF);
+		std::cout << "Stack allocated " << sType << " " << GET_INFO_FOR_KEY(pNode, ASTInfo::GIVENNAME) << " in " << m_pCurrentFunction->m_sFunctionName << "() @ " << CURRENT_OFFSET << std::endl;
+
+		EMIT_1(OPCODE::LEA, iObjectPosition);								// Push the HEAP relative address of the object's memory.
+		EMIT_1(OPCODE::PUSHI, 0);
+		EMIT_1(OPCODE::PUSHI, pStructInfo->sizeOf());
+		EMIT_1(OPCODE::MEMSET, 0);
+
+		EMIT_1(OPCODE::LEA, iObjectPosition);								// As MALLOC would.
+	}
+	else
+	{
+		EMIT_1(OPCODE::PUSHI, pStructInfo->sizeOf());						// Push variable size of STRUCT onto the STACK as it will be pulled in by MALLOC @ RT.
 
-	EMIT_1(OPCODE::MALLOC, 0);												// MALLOC will pull the amount of bytes to allocate from the STACK & reserve memory on the HEAP.
+		EMIT_1(OPCODE::MALLOC, 0);											// MALLOC will pull the amount of bytes to allocate from the STACK & reserve memory on the HEAP.
 																			// The address of allocated memory location will be pushed onto the STACK.
+	}
 
 	// 2. Save 'this' pointer in 'ECX'
 	EMIT_1(OPCODE::POPR, EREGISTERS::RCX);									// Save the Memory Address Loc in 'ECX', also called as "this" pointer.
@@ -3689,7 +4409,7 @@ void GrammerUtils::handleTypeStructs(Tree* pNode)
 																			// '0' as the VTABLE pointer will be the '0'th element in the HEAP Object.
 
 	// 3. Save 'this' pointer in the respective object variable.
-	EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, "text") ));
+	EMIT_1(OPCODE::STORE, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) ));
 																			// Store the memory address in the pointer(STRUCT*) variable.
 
 	Tree* pConstructorCallNode = pNode->m_vStatements[0];					// Struct pointer will be created in either 1 of following ways:
@@ -3712,8 +4432,8 @@ void GrammerUtils::handleTypeStructs(Tree* pNode)
 
 void GrammerUtils::handleStructMemberAccess(Tree* pNode)
 {
-	std::string sAccessType = GET_INFO_FOR_KEY(pNode, "accessType");
-	std::string sPointerName = GET_INFO_FOR_KEY(pNode, "text");
+	std::string sAccessType = GET_INFO_FOR_KEY(pNode, ASTInfo::ACCESSTYPE);
+	std::string sPointerName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 	std::string sType = "";
 	if (pNode->m_vStatements.size() > 0)
 	{
@@ -3738,7 +4458,7 @@ void GrammerUtils::handleStructMemberAccess(Tree* pNode)
 					else
 					{
 						// Increment 'ECX' pointer by amount equivalent to the offset.
-						std::string sAdjustRegisterOffset = GET_INFO_FOR_KEY(pNode, "SUB_REG");
+						std::string sAdjustRegisterOffset = GET_INFO_FOR_KEY(pNode, ASTInfo::SUB_REG);
 						if (NOT sAdjustRegisterOffset.empty())
 						{
 							iOffsetSize = atoi(sAdjustRegisterOffset.c_str());
@@ -3755,7 +4475,7 @@ void GrammerUtils::handleStructMemberAccess(Tree* pNode)
 				{
 					sType = sPointerName;
 
-					std::string sFunctionName = GET_INFO_FOR_KEY(pFunctionCallNode, "text");
+					std::string sFunctionName = GET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::TEXT);
 					StructInfo* pStructInfo = getStructByName(sType);
 					assert(pStructInfo != nullptr);
 					if (pStructInfo != nullptr)
@@ -3764,7 +4484,7 @@ void GrammerUtils::handleStructMemberAccess(Tree* pNode)
 						assert(pFunctionInfo != nullptr);
 						if (pFunctionInfo != nullptr)
 						{
-							std::string sIsStatic = GET_INFO_FOR_KEY(pFunctionInfo->m_pNode, "isStatic");
+							std::string sIsStatic = GET_INFO_FOR_KEY(pFunctionInfo->m_pNode, ASTInfo::ISSTATIC);
 							if (sIsStatic == "static")		// ClassName::staticFunctionName(); --> static function call.
 							{
 							}
@@ -3793,7 +4513,7 @@ void GrammerUtils::handleStructMemberAccess(Tree* pNode)
 					}
 				}
 
-				SET_INFO_FOR_KEY(pFunctionCallNode, "memberFunctionOf", sType);
+				SET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::MEMBERFUNCTIONOF, sType);
 
 				// 2. Make the function call.
 				populateCode(pFunctionCallNode);
@@ -3821,9 +4541,9 @@ void GrammerUtils::handleStructMemberAccess(Tree* pNode)
 void GrammerUtils::handleStructMemberAccessDeref(Tree* pNode)
 {
 	StructInfo* pStructInfo = nullptr;
-	std::string sObjectName = GET_INFO_FOR_KEY(pNode, "text");
+	std::string sObjectName = GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT);
 	Tree* pIdentifierNode = pNode->m_pLeftNode;
-	std::string sVariableName = GET_INFO_FOR_KEY(pIdentifierNode, "givenName");
+	std::string sVariableName = GET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::GIVENNAME);
 	Tree* pArrayIndexExpressionNode = pNode->m_pRightNode;
 
 	/////////////////////////////////////////////////////////////////
@@ -3919,7 +4639,7 @@ void GrammerUtils::handleStatements(Tree* pNode)
 					case ASTNodeType::ASTNode_EXPRESSION:
 					case ASTNodeType::ASTNode_IDENTIFIER:
 					{
-						std::string sType = GET_INFO_FOR_KEY(pChildNode, "EXPRESSION_RVALUE_TYPE");
+						std::string sType = GET_INFO_FOR_KEY(pChildNode, ASTInfo::EXPRESSION_RVALUE_TYPE);
 						if (sType == "float")
 						{
 							EMIT_1(OPCODE::PRTF, 0);
@@ -4010,7 +4730,7 @@ void GrammerUtils::storeValueAtPosForVariable(int32_t iPos, const char* sType, T
 		// Check if its a Member variable of a struct or its parent's !
 		if (m_pCurrentStruct != nullptr)
 		{
-			std::string sVariableName = GET_INFO_FOR_KEY(pNode, "givenName");
+			std::string sVariableName = GET_INFO_FOR_KEY(pNode, ASTInfo::GIVENNAME);
 			int32_t iPosition = getMemberPositionInStructHierarchy(sVariableName, m_pCurrentStruct);
 
 			EMIT_1(OPCODE::STA, iPosition);				// Store the memory address in the array variable.
@@ -4020,7 +4740,7 @@ void GrammerUtils::storeValueAtPosForVariable(int32_t iPos, const char* sType, T
 		// If not, check if its a local variable of a function !
 		if (NOT bStored)
 		{
-			EMIT_1(OPCODE::STA, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, "text") ));	// Store the memory address in the array variable.
+			EMIT_1(OPCODE::STA, GET_VARIABLE_POSITION( GET_INFO_FOR_KEY(pNode, ASTInfo::TEXT) ));	// Store the memory address in the array variable.
 		}
 	}
 }
@@ -4031,7 +4751,9 @@ void GrammerUtils::storeVTablePointerInObjectOnHeap(int16_t iShortPosition, Stru
 	{
 		int32_t iPositionOperand = 0;
 
-		EMIT_1(OPCODE::PUSHI, pStructInfo->getVTableOffset());	// The actual VTABLE offset value.
+		EMIT_BYTE(OPCODE::PUSHI);
+		m_vCodeAddressHoles.push_back(CURRENT_OFFSET);
+		EMIT_INT(pStructInfo->getVTableOffset());				// The actual VTABLE offset value.
 
 		iPositionOperand = (int32_t)E_VARIABLESCOPE::MEMBER;
 		iPositionOperand <<= sizeof(int16_t) * 8;
@@ -4142,7 +4864,7 @@ int32_t GrammerUtils::getMemberPositionInStructHierarchy(std::string sMemberVari
 std::string GrammerUtils::getMemberTypeInStructHierarchy(std::string sMemberVariableName, StructInfo* pStructInfo)
 {
 	Tree* pVariableNode = pStructInfo->getMemberVariableASTNode(sMemberVariableName.c_str());
-	std::string sType = GET_INFO_FOR_KEY(pVariableNode, "type");
+	std::string sType = GET_INFO_FOR_KEY(pVariableNode, ASTInfo::TYPE);
 
 	return sType;
 }
@@ -4176,6 +4898,17 @@ FunctionInfo* GrammerUtils::getGlobalFunctionByName(std::string sFuncName)
 	return itrFunc->second;
 }
 
+const IntrinsicMap* GrammerUtils::getIntrinsicByName(std::string sIntrinsic)
+{
+	for (const IntrinsicMap& pIntrinsic : intrinsicMap)
+	{
+		if (sIntrinsic == pIntrinsic.sIntrinsic)
+			return &pIntrinsic;
+	}
+
+	return nullptr;
+}
+
 Tree* GrammerUtils::getSystemFunctionByName(std::string sSystemFuncName)
 {
 	FunctionInfo* bReturnFunctionInfo = nullptr;
@@ -4195,7 +4928,7 @@ std::string GrammerUtils::getSystemFunctionReturnType(std::string sSystemFuncNam
 	assert(pNode != nullptr);
 	if (pNode != nullptr)
 	{
-		sType = GET_INFO_FOR_KEY(pNode, "type");
+		sType = GET_INFO_FOR_KEY(pNode, ASTInfo::TYPE);
 	}
 
 	return sType;
@@ -4276,6 +5009,46 @@ void GrammerUtils::printHeaders(RandomAccessFile* pRaf, std::vector<std::string>
 	/////////////////////////////////////////////////////////////////
 	// Write Global(Static) variable info
 	pRaf->writeInt(FunctionInfo::m_vStaticVariables.size());
+
+	/////////////////////////////////////////////////////////////////
+	// Write Host Data info
+	//		[COUNT(2 bytes)] [STRING_ID(2 bytes)][TYPE(1 byte)] ...
+	//		'STRING_ID' is the field name, the VM binds it to the host registered field of the same name.
+	pRaf->writeShort(FunctionInfo::m_vHostVariables.size());
+	for (Tree* pHostVar : FunctionInfo::m_vHostVariables)
+	{
+		std::string sName = GET_INFO_FOR_KEY(pHostVar, ASTInfo::TEXT);
+		std::string sType = GET_INFO_FOR_KEY(pHostVar, ASTInfo::TYPE);
+
+		pRaf->writeShort(getStringPosition(sName.c_str()));
+		pRaf->writeByte((int8_t)getTypeByString(sType));
+	}
+
+	/////////////////////////////////////////////////////////////////
+	// Write Export info, global function()s the host can call directly.
+	//		[COUNT(2 bytes)] [STRING_ID(2 bytes)][ENTRY_OFFSET(4 bytes)][RETURN_TYPE(1 byte)][ARG_COUNT(1 byte)][ARG_TYPE(1 byte)]... ...
+	//		Types are the STACK slot types, 'FLOAT' or 'INT_32'(integers & pointers). 'RETURN_TYPE' is -1 for 'void'.
+	pRaf->writeShort(m_MapGlobalFunctions.size());
+	std::map<std::string, FunctionInfo*>::const_iterator itrFunc = m_MapGlobalFunctions.begin();
+	for (; itrFunc != m_MapGlobalFunctions.end(); ++itrFunc)
+	{
+		FunctionInfo* pFunctionInfo = itrFunc->second;
+		std::string sReturnType = GET_INFO_FOR_KEY(pFunctionInfo->m_pFunctionReturnType, ASTInfo::TEXT);
+
+		pRaf->writeShort(getStringPosition(pFunctionInfo->m_sFunctionName.c_str()));
+		pRaf->writeInt(pFunctionInfo->m_iStartOffsetInCode);
+		if (sReturnType == "void")
+			pRaf->writeByte(-1);
+		else
+			pRaf->writeByte((int8_t)((sReturnType == "float") ? PRIMIIVETYPE::FLOAT : PRIMIIVETYPE::INT_32));
+
+		pRaf->writeByte(pFunctionInfo->m_vArguments.size());
+		for (Tree* pArgNode : pFunctionInfo->m_vArguments)
+		{
+			std::string sArgType = GET_INFO_FOR_KEY(pArgNode, ASTInfo::TYPE);
+			pRaf->writeByte((int8_t)((sArgType == "float" && NOT pArgNode->m_bIsPointerType) ? PRIMIIVETYPE::FLOAT : PRIMIIVETYPE::INT_32));
+		}
+	}
 }
 
 void GrammerUtils::printAssembly(int8_t* iByteCode, std::vector<std::string>& vStrings)
@@ -4315,6 +5088,17 @@ void GrammerUtils::printAssembly(int8_t* iByteCode, std::vector<std::string>& vS
 				if (bCanWrite)
 					pRaf->writeByte(iOpCount);
 			}
+			else
+			if (eOpCode == OPCODE::JMPTABLE)
+			{
+				int32_t iCount = m_pBAIS->readInt();
+				std::cout << " " << iCount;
+
+				if (bCanWrite)
+					pRaf->writeInt(iCount);
+
+				iOpCount = iCount + 3;			// iLow, iDefault & the offsets follow.
+			}
 
 			for (int i = 1; i < iOpCount; i++)
 			{
@@ -0,0 +1,190 @@
+#include "Inliner.h"
+#include "PeepholeOptimizer.h"
+#include <assert.h>
+#include <cstring>
+
+int32_t Inliner::m_iThreshold = INLINE_THRESHOLD;
+
+bool Inliner::canInline(FunctionInfo* pCaller, FunctionInfo* pCallee, const int8_t* pByteCode, const std::vector<uint32_t>& vCodeAddressHoles)
+{
+	//////////////////////////////////////////////////////////////////////
+	// 1. Only a global function() or a struct's member function() emitted
+	//    before the caller, which is never called through the VTABLE.
+	// 2. Cheap enough for m_iThreshold.
+	// 3. Nothing in the body depends on its own frame, see isBodyInlineable().
+	//////////////////////////////////////////////////////////////////////
+	if (pCallee == nullptr || pCallee == pCaller || m_iThreshold <= 0)
+		return false;
+
+	// 1.
+	if (pCallee->m_pParentInterfaceInfo != nullptr)
+		return false;
+
+	if (GET_INFO_FOR_KEY(pCallee->m_pNode, ASTInfo::ISVIRTUAL) == "virtual")
+		return false;
+
+	if (pCallee->m_iBodyOffsetInCode < 0 || pCallee->m_iEpilogueOffsetInCode < 0)
+		return false;
+
+	// 2.
+	if (costOf(pCallee) > m_iThreshold)
+		return false;
+
+	// 3.
+	std::set<uint32_t> setCodeAddressHoles(vCodeAddressHoles.begin(), vCodeAddressHoles.end());
+	return isBodyInlineable(pCallee, pByteCode, setCodeAddressHoles);
+}
+
+int32_t Inliner::costOf(FunctionInfo* pCallee)
+{
+	// The body plus a 'STORE' for each argument.
+	int32_t iBodySize = pCallee->m_iEpilogueOffsetInCode - pCallee->m_iBodyOffsetInCode;
+	return iBodySize + (pCallee->getArgumentsCount() * (1 + sizeof(int32_t)));
+}
+
+int32_t Inliner::localsNeeded(FunctionInfo* pCallee)
+{
+	return pCallee->getArgumentsCount() + pCallee->getLocalVariableCount() + pCallee->m_iInlineLocalCount + pCallee->m_iStackObjectSlots;
+}
+
+void Inliner::expand(FunctionInfo* pCallee, int32_t iFirstLocal, const int8_t* pByteCode, int32_t iAtOffset, std::vector<uint32_t>& vCodeAddressHoles, std::vector<int8_t>& vCode)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Copies the callee's body as if it was emitted @ iAtOffset.
+	// 1. ARGUMENT i becomes LOCAL (iFirstLocal + i), LOCAL j the one
+	//    after the arguments' LOCALs.
+	// 2. A target in the body moves along with it, any other target,
+	//    e.g a 'CALL' or a VTABLE offset, stays as it is.
+	// 3. Every return address or VTABLE offset copied is a new hole.
+	//////////////////////////////////////////////////////////////////////
+	std::set<uint32_t> setCodeAddressHoles(vCodeAddressHoles.begin(), vCodeAddressHoles.end());
+	int32_t iDelta = iAtOffset - pCallee->m_iBodyOffsetInCode;
+
+	vCode.clear();
+
+	int32_t iOffset = pCallee->m_iBodyOffsetInCode;
+	while (iOffset < pCallee->m_iEpilogueOffsetInCode)
+	{
+		PeepholeInstruction pInstruction = PeepholeOptimizer::decodeAt(pByteCode, iOffset, setCodeAddressHoles);
+		OPCODE eOpCode = (OPCODE)pInstruction.m_vBytes[0];
+
+		// 1.
+		if (hasVariableOperand(eOpCode))
+		{
+			int32_t iVariable = 0;
+			memcpy(&iVariable, &pInstruction.m_vBytes[1], sizeof(int32_t));
+			iVariable = remapVariable(iVariable, iFirstLocal, pCallee->getArgumentsCount());
+			memcpy(&pInstruction.m_vBytes[1], &iVariable, sizeof(int32_t));
+		}
+
+		// 2.
+		for (int32_t iPosition : pInstruction.m_vTargetPositions)
+		{
+			if (eOpCode == OPCODE::CALL)
+				continue;
+
+			int32_t iTarget = 0;
+			memcpy(&iTarget, &pInstruction.m_vBytes[iPosition], sizeof(int32_t));
+			if (iTarget >= pCallee->m_iBodyOffsetInCode && iTarget <= pCallee->m_iEpilogueOffsetInCode)
+			{
+				iTarget += iDelta;
+				memcpy(&pInstruction.m_vBytes[iPosition], &iTarget, sizeof(int32_t));
+			}
+
+			// 3.
+			if (eOpCode == OPCODE::PUSHI)
+				vCodeAddressHoles.push_back(iOffset + iDelta + iPosition);
+		}
+
+		vCode.insert(vCode.end(), pInstruction.m_vBytes.begin(), pInstruction.m_vBytes.end());
+		iOffset += pInstruction.m_vBytes.size();
+	}
+
+	assert(iOffset == pCallee->m_iEpilogueOffsetInCode);
+}
+
+bool Inliner::isBodyInlineable(FunctionInfo* pCallee, const int8_t* pByteCode, const std::set<uint32_t>& setCodeAddressHoles)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Rejects a body that:
+	// 1. Leaves the function() other than through its end, or moves RBP
+	//    or RSP for a frame of its own.
+	// 2. Calls the callee again.
+	// 3. Jumps anywhere outside the body.
+	//
+	// A MEMBER variable stays as it is, the caller has put 'this' in 'RCX'
+	// for the 'CALL' already & the body finds it there just the same.
+	//////////////////////////////////////////////////////////////////////
+	int32_t iOffset = pCallee->m_iBodyOffsetInCode;
+	while (iOffset < pCallee->m_iEpilogueOffsetInCode)
+	{
+		PeepholeInstruction pInstruction = PeepholeOptimizer::decodeAt(pByteCode, iOffset, setCodeAddressHoles);
+		OPCODE eOpCode = (OPCODE)pInstruction.m_vBytes[0];
+
+		// 1.
+		switch (eOpCode)
+		{
+			case OPCODE::RET:
+			case OPCODE::HLT:
+			case OPCODE::VTBL:
+				return false;
+			case OPCODE::POPR:
+			{
+				if (pInstruction.m_vBytes[1] == (int8_t)EREGISTERS::RBP)
+					return false;
+			}
+			break;
+			case OPCODE::SUB_REG:
+				return false;
+		}
+
+		for (int32_t iPosition : pInstruction.m_vTargetPositions)
+		{
+			int32_t iTarget = 0;
+			memcpy(&iTarget, &pInstruction.m_vBytes[iPosition], sizeof(int32_t));
+
+			// 2.
+			if (eOpCode == OPCODE::CALL)
+			{
+				if ((iTarget & 0x0000FFFF) == pCallee->m_iStartOffsetInCode)
+					return false;
+			}
+			else
+			// 3.
+			if (eOpCode != OPCODE::PUSHI)
+			{
+				if (iTarget < pCallee->m_iBodyOffsetInCode || iTarget > pCallee->m_iEpilogueOffsetInCode)
+					return false;
+			}
+		}
+
+		iOffset += pInstruction.m_vBytes.size();
+	}
+
+	return (iOffset == pCallee->m_iEpilogueOffsetInCode);
+}
+
+int32_t Inliner::remapVariable(int32_t iVariable, int32_t iFirstLocal, int32_t iArgumentCount)
+{
+	int16_t iVariablePos = (iVariable & 0x0000FFFF);
+	E_VARIABLESCOPE eVariableType = (E_VARIABLESCOPE)(iVariable >> (sizeof(int16_t) * 8));
+
+	if (eVariableType == E_VARIABLESCOPE::ARGUMENT)
+		iVariablePos = iFirstLocal + iVariablePos;				// ARGUMENTs start with index 0
+	else
+	if (eVariableType == E_VARIABLESCOPE::LOCAL)
+		iVariablePos = iFirstLocal + iArgumentCount + (iVariablePos - 1);	// LOCALs start with index 1
+	else
+		return iVariable;
+
+	int32_t iPositionOperand = (int32_t)E_VARIABLESCOPE::LOCAL;
+	iPositionOperand <<= sizeof(int16_t) * 8;
+	iPositionOperand |= (iVariablePos & 0x0000FFFF);
+
+	return iPositionOperand;
+}
+
+bool Inliner::hasVariableOperand(OPCODE eOpCode)
+{
+	return (eOpCode == OPCODE::FETCH || eOpCode == OPCODE::STORE || eOpCode == OPCODE::STA || eOpCode == OPCODE::FREE || eOpCode == OPCODE::CLR || eOpCode == OPCODE::LEA);
+}
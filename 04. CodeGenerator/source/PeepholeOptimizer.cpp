@@ -0,0 +1,1693 @@
+#include "PeepholeOptimizer.h"
+#include <assert.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <set>
+
+#define NOT_A_SLOT				0x7FFFFFFF
+#define MAX_DATAFLOW_ROUNDS		16
+
+extern CodeMap opCodeMap[];
+
+std::vector<PeepholeInstruction>	PeepholeOptimizer::m_vInstructions;
+std::vector<bool>					PeepholeOptimizer::m_vIsLabel;
+std::vector<int32_t>				PeepholeOptimizer::m_vExternalTargets;
+std::vector<TailCallSite>			PeepholeOptimizer::m_vTailCallSites;
+std::vector<int32_t>				PeepholeOptimizer::m_vFunctionStarts;
+PeepholeFunction					PeepholeOptimizer::m_Function;
+
+void PeepholeOptimizer::decode(int8_t* pByteCode, int32_t iCodeSize, const std::vector<uint32_t>& vCodeAddressHoles, const std::vector<int32_t*>& vCodeOffsets, const std::vector<TailCallSite>& vTailCallSites)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Decode the code into instructions, keeping the emitted offsets, &
+	// remember what refers to the code from outside it.
+	//////////////////////////////////////////////////////////////////////
+	decode(pByteCode, iCodeSize, vCodeAddressHoles);
+
+	m_vExternalTargets.clear();
+	for (int32_t* pCodeOffset : vCodeOffsets)
+		m_vExternalTargets.push_back(*pCodeOffset);
+
+	m_vTailCallSites = vTailCallSites;
+}
+
+void PeepholeOptimizer::optimize()
+{
+	//////////////////////////////////////////////////////////////////////
+	// Run the dataflow passes, then every peephole pass till none of
+	// them changes anything.
+	//////////////////////////////////////////////////////////////////////
+	optimizeFunctions();
+
+	int32_t iPass = 0;
+	bool bChanged = true;
+	while (bChanged)
+	{
+		int32_t iBytesBefore = 0, iInstructionsBefore = 0;
+		for (const PeepholeInstruction& pInstruction : m_vInstructions)
+		{
+			if (NOT pInstruction.m_bRemoved)
+			{
+				iBytesBefore += pInstruction.m_vBytes.size();
+				iInstructionsBefore++;
+			}
+		}
+
+		bChanged = false;
+		bChanged |= threadJumps();
+		bChanged |= foldStoreFetch();
+		bChanged |= removeAddZero();
+		bChanged |= removeUnreachable();
+		bChanged |= eliminateTailCalls();
+
+		int32_t iBytesAfter = 0, iInstructionsAfter = 0;
+		for (const PeepholeInstruction& pInstruction : m_vInstructions)
+		{
+			if (NOT pInstruction.m_bRemoved)
+			{
+				iBytesAfter += pInstruction.m_vBytes.size();
+				iInstructionsAfter++;
+			}
+		}
+
+		iPass++;
+		std::cout << "Peephole pass " << iPass << ": " << (iBytesBefore - iBytesAfter) << " bytes, " << (iInstructionsBefore - iInstructionsAfter) << " instructions removed" << std::endl;
+	}
+}
+
+void PeepholeOptimizer::decode(int8_t* pByteCode, int32_t iCodeSize, const std::vector<uint32_t>& vCodeAddressHoles)
+{
+	std::set<uint32_t> setCodeAddressHoles(vCodeAddressHoles.begin(), vCodeAddressHoles.end());
+
+	m_vInstructions.clear();
+
+	int32_t iOffset = 0;
+	while (iOffset < iCodeSize)
+	{
+		PeepholeInstruction pInstruction = decodeAt(pByteCode, iOffset, setCodeAddressHoles);
+
+		assert(iOffset + (int32_t)pInstruction.m_vBytes.size() <= iCodeSize);
+		m_vInstructions.push_back(pInstruction);
+
+		iOffset += pInstruction.m_vBytes.size();
+	}
+}
+
+PeepholeInstruction PeepholeOptimizer::decodeAt(const int8_t* pByteCode, int32_t iOffset, const std::set<uint32_t>& setCodeAddressHoles)
+{
+	PeepholeInstruction pInstruction;
+	pInstruction.m_iOffset = iOffset;
+	pInstruction.m_bRemoved = false;
+
+	OPCODE eOpCode = (OPCODE)pByteCode[iOffset];
+	CodeMap pMachineInstruction = opCodeMap[(int)eOpCode];
+
+	int32_t iSize = 1;
+	if (eOpCode == OPCODE::VTBL)
+	{
+		// VTBL iSize(byte) iOffset[iSize]
+		int32_t iEntries = (uint8_t)pByteCode[iOffset + 1];
+		iSize = 2 + (iEntries * sizeof(int32_t));
+
+		for (int32_t i = 0; i < iEntries; i++)
+			pInstruction.m_vTargetPositions.push_back(2 + (i * sizeof(int32_t)));
+	}
+	else
+	if (eOpCode == OPCODE::JMPTABLE)
+	{
+		// JMPTABLE iCount iLow iDefault iOffset[iCount]
+		int32_t iCount = 0;
+		memcpy(&iCount, &pByteCode[iOffset + 1], sizeof(int32_t));
+		iSize = 1 + ((iCount + 3) * sizeof(int32_t));
+
+		for (int32_t i = 0; i <= iCount; i++)
+			pInstruction.m_vTargetPositions.push_back(1 + ((i + 2) * sizeof(int32_t)));
+	}
+	else
+	{
+		int32_t iOperandSize = 0;
+		switch (pMachineInstruction.ePRIMIIVETYPE)
+		{
+			case PRIMIIVETYPE::INT_8:	iOperandSize = sizeof(int8_t);	break;
+			case PRIMIIVETYPE::INT_16:	iOperandSize = sizeof(int16_t);	break;
+			case PRIMIIVETYPE::INT_32:	iOperandSize = sizeof(int32_t);	break;
+			case PRIMIIVETYPE::INT_64:	iOperandSize = sizeof(int64_t);	break;
+		}
+		iSize = 1 + ((pMachineInstruction.iOpcodeOperandCount - 1) * iOperandSize);
+
+		bool bIsJump = (eOpCode == OPCODE::JMP || eOpCode == OPCODE::JZ || eOpCode == OPCODE::JNZ)
+						||
+						(eOpCode >= OPCODE::BR_LT && eOpCode <= OPCODE::BR_NEQF);
+		if (bIsJump)
+		{
+			pInstruction.m_vTargetPositions.push_back(1);
+		}
+		else
+		if (eOpCode == OPCODE::CALL || eOpCode == OPCODE::TAILCALL)
+		{
+			// ( NORMAL | OFFSET ), a VIRTUAL call holds its position in the VTABLE.
+			int32_t iOperand = 0;
+			memcpy(&iOperand, &pByteCode[iOffset + 1], sizeof(int32_t));
+			if ((E_FUNCTIONCALLTYPE)(iOperand >> (sizeof(int16_t) * 8)) == E_FUNCTIONCALLTYPE::NORMAL)
+				pInstruction.m_vTargetPositions.push_back(1);
+		}
+		else
+		if (eOpCode == OPCODE::PUSHI && setCodeAddressHoles.find(iOffset + 1) != setCodeAddressHoles.end())
+		{
+			pInstruction.m_vTargetPositions.push_back(1);		// Return address or VTABLE offset.
+		}
+	}
+
+	pInstruction.m_vBytes.assign(&pByteCode[iOffset], &pByteCode[iOffset + iSize]);
+
+	return pInstruction;
+}
+
+int32_t PeepholeOptimizer::encode(int8_t* pByteCode, int32_t iCodeSize, const std::vector<int32_t*>& vCodeOffsets)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Write the live instructions back & relocate every code offset.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<int32_t> vNewOffsets(m_vInstructions.size(), -1);
+
+	int32_t iNewCodeSize = 0;
+	for (size_t i = 0; i < m_vInstructions.size(); i++)
+	{
+		if (NOT m_vInstructions[i].m_bRemoved)
+		{
+			vNewOffsets[i] = iNewCodeSize;
+			iNewCodeSize += m_vInstructions[i].m_vBytes.size();
+		}
+	}
+
+	for (size_t i = 0; i < m_vInstructions.size(); i++)
+	{
+		if (m_vInstructions[i].m_bRemoved)
+			continue;
+
+		for (int32_t iPosition : m_vInstructions[i].m_vTargetPositions)
+			setTarget(i, iPosition, relocate(targetOf(i, iPosition), vNewOffsets, iNewCodeSize));
+	}
+
+	for (int32_t* pCodeOffset : vCodeOffsets)
+		*pCodeOffset = relocate(*pCodeOffset, vNewOffsets, iNewCodeSize);
+
+	int32_t iOffset = 0;
+	for (const PeepholeInstruction& pInstruction : m_vInstructions)
+	{
+		if (NOT pInstruction.m_bRemoved)
+		{
+			memcpy(&pByteCode[iOffset], pInstruction.m_vBytes.data(), pInstruction.m_vBytes.size());
+			iOffset += pInstruction.m_vBytes.size();
+		}
+	}
+	memset(&pByteCode[iNewCodeSize], 0, iCodeSize - iNewCodeSize);
+
+	std::cout << "Peephole: " << iCodeSize << " -> " << iNewCodeSize << " bytes" << std::endl;
+
+	return iNewCodeSize;
+}
+
+bool PeepholeOptimizer::threadJumps()
+{
+	//////////////////////////////////////////////////////////////////////
+	// 1. A jump landing on a 'JMP' goes to where that 'JMP' goes.
+	// 2. A 'JMP' landing on a 'RET' is the 'RET'.
+	// 3. A 'JMP' landing on the next instruction does nothing.
+	//////////////////////////////////////////////////////////////////////
+	bool bChanged = false;
+	int32_t iCount = m_vInstructions.size();
+
+	for (int32_t i = 0; i < iCount; i++)
+	{
+		OPCODE eOpCode = opCodeOf(i);
+		if (m_vInstructions[i].m_bRemoved || eOpCode == OPCODE::CALL || eOpCode == OPCODE::TAILCALL || eOpCode == OPCODE::PUSHI || eOpCode == OPCODE::VTBL)
+			continue;
+
+		// 1.
+		for (int32_t iPosition : m_vInstructions[i].m_vTargetPositions)
+		{
+			int32_t iTarget = targetOf(i, iPosition);
+			for (int32_t iHops = 0; iHops < iCount; iHops++)
+			{
+				int32_t iTargetIndex = indexAt(iTarget);
+				if (iTargetIndex < 0 || m_vInstructions[iTargetIndex].m_iOffset != iTarget)
+					break;
+
+				if (m_vInstructions[iTargetIndex].m_bRemoved)
+					iTargetIndex = nextLive(iTargetIndex);
+
+				if (iTargetIndex < 0 || iTargetIndex == i || opCodeOf(iTargetIndex) != OPCODE::JMP)
+					break;
+
+				int32_t iNextTarget = targetOf(iTargetIndex, 1);
+				if (iNextTarget == iTarget)
+					break;
+
+				iTarget = iNextTarget;
+			}
+
+			if (iTarget != targetOf(i, iPosition))
+			{
+				setTarget(i, iPosition, iTarget);
+				bChanged = true;
+			}
+		}
+
+		if (eOpCode != OPCODE::JMP)
+			continue;
+
+		int32_t iTargetIndex = indexAt(targetOf(i, 1));
+		if (iTargetIndex < 0)
+			continue;
+
+		if (m_vInstructions[iTargetIndex].m_bRemoved)
+			iTargetIndex = nextLive(iTargetIndex);
+
+		// 2.
+		if (iTargetIndex >= 0 && opCodeOf(iTargetIndex) == OPCODE::RET)
+		{
+			replace(i, OPCODE::RET, nullptr, 0);
+			bChanged = true;
+		}
+		else
+		// 3.
+		if (iTargetIndex >= 0 && iTargetIndex == nextLive(i))
+		{
+			m_vInstructions[i].m_bRemoved = true;
+			bChanged = true;
+		}
+	}
+
+	return bChanged;
+}
+
+bool PeepholeOptimizer::foldStoreFetch()
+{
+	//////////////////////////////////////////////////////////////////////
+	// 'STORE x; FETCH x' ==> 'DUP; STORE x'
+	// STORE & FETCH move all 4 bytes for every scope, so the value read
+	// back is the value stored. 'HOST' data is read-only & left alone.
+	//////////////////////////////////////////////////////////////////////
+	markLabels();
+
+	bool bChanged = false;
+	int32_t iCount = m_vInstructions.size();
+
+	for (int32_t i = 0; i < iCount; i++)
+	{
+		if (m_vInstructions[i].m_bRemoved || opCodeOf(i) != OPCODE::STORE)
+			continue;
+
+		int32_t j = nextLive(i);
+		if (j < 0 || opCodeOf(j) != OPCODE::FETCH || isLabel(j))
+			continue;
+
+		int32_t iVariable = operandOf(i, 1);
+		if (iVariable != operandOf(j, 1))
+			continue;
+
+		if ((E_VARIABLESCOPE)(iVariable >> (sizeof(int16_t) * 8)) == E_VARIABLESCOPE::HOST)
+			continue;
+
+		replace(i, OPCODE::DUP, nullptr, 0);
+		replace(j, OPCODE::STORE, (const int8_t*)&iVariable, sizeof(int32_t));
+		bChanged = true;
+	}
+
+	return bChanged;
+}
+
+bool PeepholeOptimizer::removeAddZero()
+{
+	//////////////////////////////////////////////////////////////////////
+	// 'PUSHI 0; ADD' ==> nothing
+	//////////////////////////////////////////////////////////////////////
+	markLabels();
+
+	bool bChanged = false;
+	int32_t iCount = m_vInstructions.size();
+
+	for (int32_t i = 0; i < iCount; i++)
+	{
+		if (m_vInstructions[i].m_bRemoved || opCodeOf(i) != OPCODE::PUSHI)
+			continue;
+
+		if (NOT m_vInstructions[i].m_vTargetPositions.empty() || operandOf(i, 1) != 0)
+			continue;
+
+		int32_t j = nextLive(i);
+		if (j < 0 || opCodeOf(j) != OPCODE::ADD || isLabel(j))
+			continue;
+
+		m_vInstructions[i].m_bRemoved = true;
+		m_vInstructions[j].m_bRemoved = true;
+		bChanged = true;
+	}
+
+	return bChanged;
+}
+
+bool PeepholeOptimizer::removeUnreachable()
+{
+	//////////////////////////////////////////////////////////////////////
+	// Nothing falls through a 'JMP', a 'RET' or a 'TAILCALL', what follows
+	// runs only if something refers to it. A 'VTBL' is data & always stays.
+	//////////////////////////////////////////////////////////////////////
+	markLabels();
+
+	bool bChanged = false;
+	int32_t iCount = m_vInstructions.size();
+
+	for (int32_t i = 0; i < iCount; i++)
+	{
+		if (m_vInstructions[i].m_bRemoved)
+			continue;
+
+		OPCODE eOpCode = opCodeOf(i);
+		if (eOpCode != OPCODE::JMP && eOpCode != OPCODE::RET && eOpCode != OPCODE::TAILCALL)
+			continue;
+
+		int32_t j = nextLive(i);
+		while (j >= 0 && NOT isLabel(j) && opCodeOf(j) != OPCODE::VTBL && opCodeOf(j) != OPCODE::HLT)
+		{
+			m_vInstructions[j].m_bRemoved = true;
+			bChanged = true;
+
+			j = nextLive(j);
+		}
+	}
+
+	return bChanged;
+}
+
+bool PeepholeOptimizer::eliminateTailCalls()
+{
+	//////////////////////////////////////////////////////////////////////
+	// 'PUSHI ret; PUSHR RBP; <args>; CALL f' ==> '<args>; TAILCALL f'
+	// 1. Only the calls GrammerUtils::handleFunctionCall() found to be
+	//    candidates, a NORMAL call between global function()s.
+	// 2. Everything after the call must do nothing but hand f's result
+	//    back, see returnsResult(). The 'TAILCALL' never returns here.
+	// 3. f takes over the caller's frame, its return address & 'Old EBP'.
+	//////////////////////////////////////////////////////////////////////
+	markLabels();
+
+	bool bChanged = false;
+	for (const TailCallSite& pTailCallSite : m_vTailCallSites)
+	{
+		// 1.
+		int32_t iPushRet = indexAt(pTailCallSite.m_iReturnAddressHole - 1);
+		if (iPushRet < 0 || m_vInstructions[iPushRet].m_bRemoved || opCodeOf(iPushRet) != OPCODE::PUSHI || m_vInstructions[iPushRet].m_vTargetPositions.empty())
+			continue;
+
+		int32_t iPushRBP = nextLive(iPushRet);
+		if (iPushRBP < 0 || isLabel(iPushRBP) || opCodeOf(iPushRBP) != OPCODE::PUSHR || m_vInstructions[iPushRBP].m_vBytes[1] != (int8_t)EREGISTERS::RBP)
+			continue;
+
+		int32_t iCall = indexAt(targetOf(iPushRet, 1) - 1);
+		if (iCall < 0 || m_vInstructions[iCall].m_bRemoved || opCodeOf(iCall) != OPCODE::CALL || m_vInstructions[iCall].m_vTargetPositions.empty())
+			continue;
+
+		// 2.
+		if (NOT returnsResult(nextLive(iCall)))
+			continue;
+
+		// 3.
+		int32_t iOperands[2] = { operandOf(iCall, 1), 0 };
+		iOperands[1] = (pTailCallSite.m_iCallerArgumentCount << (sizeof(int16_t) * 8)) | (pTailCallSite.m_iCalleeArgumentCount & 0x0000FFFF);
+
+		replace(iCall, OPCODE::TAILCALL, (const int8_t*)iOperands, sizeof(iOperands));
+		m_vInstructions[iCall].m_vTargetPositions.push_back(1);
+
+		m_vInstructions[iPushRet].m_bRemoved = true;
+		m_vInstructions[iPushRBP].m_bRemoved = true;
+		bChanged = true;
+	}
+
+	return bChanged;
+}
+
+bool PeepholeOptimizer::returnsResult(int32_t iIndex)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Follows the code from iIndex, with the callee's result in RAX.
+	// True if it reaches the epilogue's 'RET' only moving that result
+	// between RAX, the STACK & LOCAL/ARGUMENT slots, all of which the
+	// 'RET' drops. Any other instruction may have an effect.
+	//////////////////////////////////////////////////////////////////////
+	std::set<int32_t> setResultSlots;
+	int32_t iResultsOnStack = 0;
+	bool bInEpilogue = false;
+	bool bPoppedRBP = false;
+
+	int32_t iCount = m_vInstructions.size();
+	for (int32_t iSteps = 0; iIndex >= 0 && iSteps < iCount; iSteps++)
+	{
+		const std::vector<int8_t>& vBytes = m_vInstructions[iIndex].m_vBytes;
+		OPCODE eOpCode = opCodeOf(iIndex);
+
+		if (bInEpilogue && eOpCode != OPCODE::SUB_REG && eOpCode != OPCODE::POPR && eOpCode != OPCODE::RET)
+			return false;
+
+		if (bPoppedRBP && eOpCode != OPCODE::RET)
+			return false;
+
+		switch (eOpCode)
+		{
+			case OPCODE::PUSHR:
+			{
+				if (vBytes[1] != (int8_t)EREGISTERS::RAX)
+					return false;
+				iResultsOnStack++;
+			}
+			break;
+			case OPCODE::DUP:
+			{
+				if (iResultsOnStack == 0)
+					return false;
+				iResultsOnStack++;
+			}
+			break;
+			case OPCODE::STORE:
+			case OPCODE::FETCH:
+			{
+				int32_t iVariable = operandOf(iIndex, 1);
+				E_VARIABLESCOPE eVariableType = (E_VARIABLESCOPE)(iVariable >> (sizeof(int16_t) * 8));
+				if (eVariableType != E_VARIABLESCOPE::LOCAL && eVariableType != E_VARIABLESCOPE::ARGUMENT)
+					return false;
+
+				if (eOpCode == OPCODE::STORE)
+				{
+					if (iResultsOnStack == 0)
+						return false;
+					iResultsOnStack--;
+					setResultSlots.insert(iVariable);
+				}
+				else
+				{
+					if (setResultSlots.find(iVariable) == setResultSlots.end())
+						return false;
+					iResultsOnStack++;
+				}
+			}
+			break;
+			case OPCODE::POPR:
+			{
+				if (vBytes[1] == (int8_t)EREGISTERS::RAX && NOT bInEpilogue)
+				{
+					if (iResultsOnStack == 0)
+						return false;
+					iResultsOnStack--;
+				}
+				else
+				if (vBytes[1] == (int8_t)EREGISTERS::RBP && iResultsOnStack == 0)
+				{
+					// 'Old EBP', the 'RET' must come next.
+					bInEpilogue = true;
+					bPoppedRBP = true;
+				}
+				else
+					return false;
+			}
+			break;
+			case OPCODE::SUB_REG:
+			{
+				// The epilogue drops the locals & arguments, nothing of the result may be left on the STACK.
+				if (vBytes[1] != (int8_t)EREGISTERS::RSP || vBytes[2] < 0 || iResultsOnStack != 0)
+					return false;
+				bInEpilogue = true;
+			}
+			break;
+			case OPCODE::RET:
+				return bPoppedRBP;
+			case OPCODE::JMP:
+			{
+				iIndex = indexAt(targetOf(iIndex, 1));
+				if (iIndex >= 0 && m_vInstructions[iIndex].m_bRemoved)
+					iIndex = nextLive(iIndex);
+			}
+			continue;
+			default:
+				return false;
+		}
+
+		iIndex = nextLive(iIndex);
+	}
+
+	return false;
+}
+
+void PeepholeOptimizer::markLabels()
+{
+	m_vIsLabel.assign(m_vInstructions.size(), false);
+
+	//////////////////////////////////////////////////////////////////////
+	// Something referring to a removed instruction lands on the live one
+	// after it, see relocate().
+	//////////////////////////////////////////////////////////////////////
+	for (int32_t iTarget : m_vExternalTargets)
+	{
+		int32_t iIndex = indexAt(iTarget);
+		if (iIndex >= 0 && m_vInstructions[iIndex].m_bRemoved)
+			iIndex = nextLive(iIndex);
+
+		if (iIndex >= 0)
+			m_vIsLabel[iIndex] = true;
+	}
+
+	for (size_t i = 0; i < m_vInstructions.size(); i++)
+	{
+		if (m_vInstructions[i].m_bRemoved)
+			continue;
+
+		for (int32_t iPosition : m_vInstructions[i].m_vTargetPositions)
+		{
+			int32_t iIndex = indexAt(targetOf(i, iPosition));
+			if (iIndex >= 0 && m_vInstructions[iIndex].m_bRemoved)
+				iIndex = nextLive(iIndex);
+
+			if (iIndex >= 0)
+				m_vIsLabel[iIndex] = true;
+		}
+	}
+}
+
+bool PeepholeOptimizer::isLabel(int32_t iIndex)
+{
+	return m_vIsLabel[iIndex];
+}
+
+int32_t PeepholeOptimizer::nextLive(int32_t iIndex)
+{
+	for (int32_t i = iIndex + 1; i < (int32_t)m_vInstructions.size(); i++)
+	{
+		if (NOT m_vInstructions[i].m_bRemoved)
+			return i;
+	}
+
+	return -1;
+}
+
+int32_t PeepholeOptimizer::indexAt(int32_t iOffset)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Index of the instruction containing iOffset, -1 if it is outside
+	// the code. A 'VTBL' offset points past its first 2 bytes.
+	// Code hoistLoopInvariants() moved shares the offset of the instruction it went
+	// after, which comes first.
+	//////////////////////////////////////////////////////////////////////
+	if (iOffset < 0 || m_vInstructions.empty())
+		return -1;
+
+	const PeepholeInstruction& pLast = m_vInstructions.back();
+	if (iOffset >= pLast.m_iOffset + (int32_t)pLast.m_vBytes.size())
+		return -1;
+
+	std::vector<PeepholeInstruction>::const_iterator itr = std::upper_bound(	m_vInstructions.begin(),
+																				m_vInstructions.end(),
+																				iOffset,
+																				[](int32_t iValue, const PeepholeInstruction& pInstruction) { return iValue < pInstruction.m_iOffset; }
+																			);
+	int32_t iIndex = (int32_t)(itr - m_vInstructions.begin()) - 1;
+	while (iIndex > 0 && m_vInstructions[iIndex - 1].m_iOffset == m_vInstructions[iIndex].m_iOffset)
+		iIndex--;
+
+	return iIndex;
+}
+
+int32_t PeepholeOptimizer::relocate(int32_t iOffset, const std::vector<int32_t>& vNewOffsets, int32_t iCodeSize)
+{
+	int32_t iIndex = indexAt(iOffset);
+	if (iIndex < 0)
+		return iOffset;
+
+	if (NOT m_vInstructions[iIndex].m_bRemoved)
+		return vNewOffsets[iIndex] + (iOffset - m_vInstructions[iIndex].m_iOffset);
+
+	// A removed instruction did nothing, land on the one after it.
+	int32_t iNext = nextLive(iIndex);
+	return (iNext >= 0) ? vNewOffsets[iNext] : iCodeSize;
+}
+
+OPCODE PeepholeOptimizer::opCodeOf(int32_t iIndex)
+{
+	return (OPCODE)m_vInstructions[iIndex].m_vBytes[0];
+}
+
+int32_t PeepholeOptimizer::operandOf(int32_t iIndex, int32_t iPosition)
+{
+	int32_t iOperand = 0;
+	memcpy(&iOperand, &m_vInstructions[iIndex].m_vBytes[iPosition], sizeof(int32_t));
+
+	return iOperand;
+}
+
+void PeepholeOptimizer::setOperand(int32_t iIndex, int32_t iPosition, int32_t iValue)
+{
+	memcpy(&m_vInstructions[iIndex].m_vBytes[iPosition], &iValue, sizeof(int32_t));
+}
+
+int32_t PeepholeOptimizer::targetOf(int32_t iIndex, int32_t iPosition)
+{
+	int32_t iOperand = operandOf(iIndex, iPosition);
+	if (opCodeOf(iIndex) == OPCODE::CALL || opCodeOf(iIndex) == OPCODE::TAILCALL)
+		iOperand &= 0x0000FFFF;
+
+	return iOperand;
+}
+
+void PeepholeOptimizer::setTarget(int32_t iIndex, int32_t iPosition, int32_t iTarget)
+{
+	if (opCodeOf(iIndex) == OPCODE::CALL || opCodeOf(iIndex) == OPCODE::TAILCALL)
+		iTarget = (operandOf(iIndex, iPosition) & 0xFFFF0000) | (iTarget & 0x0000FFFF);
+
+	setOperand(iIndex, iPosition, iTarget);
+}
+
+void PeepholeOptimizer::replace(int32_t iIndex, OPCODE eOpCode, const int8_t* pOperands, int32_t iOperandSize)
+{
+	PeepholeInstruction& pInstruction = m_vInstructions[iIndex];
+
+	pInstruction.m_vBytes.assign(1, (int8_t)eOpCode);
+	if (pOperands != nullptr)
+		pInstruction.m_vBytes.insert(pInstruction.m_vBytes.end(), pOperands, pOperands + iOperandSize);
+
+	pInstruction.m_vTargetPositions.clear();
+}
+
+void PeepholeOptimizer::optimizeFunctions()
+{
+	//////////////////////////////////////////////////////////////////////
+	// 1. Every external target that is not a 'VTBL' starts a function().
+	// 2. Run each pass over every function(), rebuilding its blocks &
+	//    values after each change, till a round changes nothing.
+	// 3. Print what each pass did & the time it took.
+	//////////////////////////////////////////////////////////////////////
+	typedef int32_t (*DataflowPass)();
+	struct DataflowPassInfo
+	{
+		const char*		sName;
+		DataflowPass			pPass;
+		int32_t			iChanges;
+		int64_t			iMicroSeconds;
+	};
+
+	DataflowPassInfo vPasses[] =
+	{
+		{ "propagateCopies",				&PeepholeOptimizer::propagateCopies,				0, 0 },
+		{ "eliminateCommonSubexpressions",	&PeepholeOptimizer::eliminateCommonSubexpressions,	0, 0 },
+		{ "eliminateDeadCode",				&PeepholeOptimizer::eliminateDeadCode,				0, 0 },
+		{ "hoistLoopInvariants",			&PeepholeOptimizer::hoistLoopInvariants,			0, 0 },
+	};
+
+	// 1.
+	findFunctions(m_vExternalTargets);
+
+	// 2.
+	int32_t iRound = 0;
+	bool bChanged = true;
+	while (bChanged && iRound < MAX_DATAFLOW_ROUNDS)
+	{
+		bChanged = false;
+		for (DataflowPassInfo& pPassInfo : vPasses)
+		{
+			std::chrono::high_resolution_clock::time_point tStart = std::chrono::high_resolution_clock::now();
+
+			for (size_t iFunction = 0; iFunction < m_vFunctionStarts.size(); iFunction++)
+			{
+				buildFunction(iFunction);
+				for (int32_t iChanges = pPassInfo.pPass(); iChanges > 0; iChanges = pPassInfo.pPass())
+				{
+					pPassInfo.iChanges += iChanges;
+					bChanged = true;
+
+					buildFunction(iFunction);
+				}
+			}
+
+			std::chrono::high_resolution_clock::time_point tEnd = std::chrono::high_resolution_clock::now();
+			pPassInfo.iMicroSeconds += std::chrono::duration_cast<std::chrono::microseconds>(tEnd - tStart).count();
+		}
+
+		iRound++;
+	}
+
+	// 3.
+	std::cout << "Dataflow: " << m_vFunctionStarts.size() << (m_vFunctionStarts.size() == 1 ? " function, " : " functions, ") << iRound << (iRound == 1 ? " round" : " rounds") << std::endl;
+	for (const DataflowPassInfo& pPassInfo : vPasses)
+	{
+		std::cout << "Dataflow pass " << pPassInfo.sName << ": " << pPassInfo.iChanges << (pPassInfo.iChanges == 1 ? " change, " : " changes, ") << pPassInfo.iMicroSeconds << " us" << std::endl;
+	}
+}
+
+void PeepholeOptimizer::findFunctions(const std::vector<int32_t>& vExternalTargets)
+{
+	std::set<int32_t> setStarts;
+	for (int32_t iTarget : vExternalTargets)
+	{
+		int32_t iIndex = indexAt(iTarget);
+		if (iIndex < 0 || m_vInstructions[iIndex].m_iOffset != iTarget)
+			continue;
+
+		if (opCodeOf(iIndex) == OPCODE::VTBL)
+			continue;
+
+		setStarts.insert(iTarget);
+	}
+
+	m_vFunctionStarts.assign(setStarts.begin(), setStarts.end());
+}
+
+void PeepholeOptimizer::buildFunction(int32_t iFunction)
+{
+	//////////////////////////////////////////////////////////////////////
+	// A function() runs from its start to the next start, 'VTBL' or 'HLT'.
+	// Everything here only looks at the instructions in that range, so
+	// rebuilding after a change costs the size of the function(), not of
+	// the whole program.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeInstruction>& vInstructions = m_vInstructions;
+
+	m_Function = PeepholeFunction();
+
+	int32_t iFirst = indexAt(m_vFunctionStarts[iFunction]);
+	int32_t iEnd = iFirst;
+	for (; iEnd < (int32_t)vInstructions.size(); iEnd++)
+	{
+		if (iEnd > iFirst && vInstructions[iEnd].m_iOffset != vInstructions[iEnd - 1].m_iOffset)
+		{
+			if (std::binary_search(m_vFunctionStarts.begin(), m_vFunctionStarts.end(), vInstructions[iEnd].m_iOffset))
+				break;
+		}
+
+		if (vInstructions[iEnd].m_bRemoved)
+			continue;
+
+		OPCODE eOpCode = opCodeOf(iEnd);
+		if (eOpCode == OPCODE::VTBL || eOpCode == OPCODE::HLT)
+			break;
+	}
+
+	m_Function.m_iFirstIndex = iFirst;
+	m_Function.m_iEndIndex = iEnd;
+	m_Function.m_vPositionOf.assign(iEnd - iFirst, -1);
+	for (int32_t i = iFirst; i < iEnd; i++)
+	{
+		if (vInstructions[i].m_bRemoved)
+			continue;
+
+		m_Function.m_vPositionOf[i - iFirst] = m_Function.m_vCode.size();
+		m_Function.m_vCode.push_back(i);
+	}
+
+	markFunctionLabels(iFunction);
+
+	int32_t iSize = m_Function.m_vCode.size();
+	m_Function.m_vInputs.assign(iSize, std::vector<int32_t>());
+	m_Function.m_vOutputs.assign(iSize, std::vector<int32_t>());
+	m_Function.m_vBlockOf.assign(iSize, -1);
+
+	for (int32_t iPosition = 0; iPosition < iSize; iPosition++)
+	{
+		int32_t iSlot = slotOf(iPosition);
+		if (iSlot != NOT_A_SLOT)
+			m_Function.m_SetSlots.insert(iSlot);
+	}
+
+	buildBlocks();
+	for (const PeepholeBlock& pBlock : m_Function.m_vBlocks)
+		buildValues(pBlock);
+}
+
+void PeepholeOptimizer::markFunctionLabels(int32_t iFunction)
+{
+	//////////////////////////////////////////////////////////////////////
+	// markLabels() for one function(). Code elsewhere
+	// only ever lands on its start: 'CALL', 'TAILCALL' & 'VTBL' entries
+	// go there & return addresses point into the caller.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeInstruction>& vInstructions = m_vInstructions;
+	int32_t iSize = m_Function.m_vCode.size();
+
+	m_Function.m_vIsLabel.assign(iSize, false);
+
+	int32_t iStart = positionOf(m_vFunctionStarts[iFunction]);
+	if (iStart >= 0)
+		m_Function.m_vIsLabel[iStart] = true;
+
+	for (int32_t iPosition = 0; iPosition < iSize; iPosition++)
+	{
+		int32_t iIndex = m_Function.m_vCode[iPosition];
+		for (int32_t iTargetPosition : vInstructions[iIndex].m_vTargetPositions)
+		{
+			int32_t iTarget = positionOf(targetOf(iIndex, iTargetPosition));
+			if (iTarget >= 0)
+				m_Function.m_vIsLabel[iTarget] = true;
+		}
+	}
+}
+
+void PeepholeOptimizer::buildBlocks()
+{
+	//////////////////////////////////////////////////////////////////////
+	// A block starts at the function() start, at anything jumped to from
+	// anywhere in the code & after a jump, 'RET' or 'JMPTABLE'.
+	// A return address does not start a block, the 'CALL' before it is a
+	// barrier anyway.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeInstruction>& vInstructions = m_vInstructions;
+	int32_t iSize = m_Function.m_vCode.size();
+	if (iSize == 0)
+		return;
+
+	std::vector<bool> vIsLeader(iSize, false);
+	vIsLeader[0] = true;
+
+	for (int32_t iPosition = 0; iPosition < iSize; iPosition++)
+	{
+		int32_t i = m_Function.m_vCode[iPosition];
+		OPCODE eOpCode = opCodeOf(i);
+		if (eOpCode == OPCODE::CALL || eOpCode == OPCODE::PUSHI || eOpCode == OPCODE::VTBL)
+			continue;
+
+		for (int32_t iTargetPosition : vInstructions[i].m_vTargetPositions)
+		{
+			int32_t iTarget = positionOf(targetOf(i, iTargetPosition));
+			if (iTarget >= 0)
+				vIsLeader[iTarget] = true;
+		}
+	}
+
+	for (int32_t iPosition = 0; iPosition < iSize - 1; iPosition++)
+	{
+		if (NOT m_vInstructions[m_Function.m_vCode[iPosition]].m_vTargetPositions.empty() && opCodeAt(iPosition) != OPCODE::PUSHI && opCodeAt(iPosition) != OPCODE::CALL)
+			vIsLeader[iPosition + 1] = true;
+		else
+		if (opCodeAt(iPosition) == OPCODE::RET)
+			vIsLeader[iPosition + 1] = true;
+	}
+
+	for (int32_t iPosition = 0; iPosition < iSize; iPosition++)
+	{
+		if (vIsLeader[iPosition])
+		{
+			PeepholeBlock pBlock;
+			pBlock.m_iFirst = iPosition;
+			pBlock.m_iLast = iPosition;
+			pBlock.m_bLeavesFunction = false;
+			m_Function.m_vBlocks.push_back(pBlock);
+		}
+
+		m_Function.m_vBlocks.back().m_iLast = iPosition;
+		m_Function.m_vBlockOf[iPosition] = m_Function.m_vBlocks.size() - 1;
+	}
+
+	for (PeepholeBlock& pBlock : m_Function.m_vBlocks)
+	{
+		int32_t iLast = pBlock.m_iLast;
+		int32_t iIndex = m_Function.m_vCode[iLast];
+		OPCODE eOpCode = opCodeAt(iLast);
+
+		std::vector<int32_t> vTargets;
+		if (eOpCode != OPCODE::CALL && eOpCode != OPCODE::PUSHI)
+		{
+			for (int32_t iTargetPosition : vInstructions[iIndex].m_vTargetPositions)
+				vTargets.push_back(positionOf(targetOf(iIndex, iTargetPosition)));
+		}
+
+		bool bFallsThrough = (eOpCode != OPCODE::JMP && eOpCode != OPCODE::JMPTABLE && eOpCode != OPCODE::RET);
+		if (bFallsThrough)
+			vTargets.push_back((iLast + 1 < iSize) ? (iLast + 1) : -1);
+
+		for (int32_t iTarget : vTargets)
+		{
+			if (iTarget < 0)
+				pBlock.m_bLeavesFunction = true;
+			else
+				pBlock.m_vSuccessors.push_back(m_Function.m_vBlockOf[iTarget]);
+		}
+	}
+}
+
+void PeepholeOptimizer::buildValues(const PeepholeBlock& pBlock)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Runs the block over an abstract STACK of value ids. A value popped
+	// off an empty STACK came from before the block & is opaque, so is
+	// everything a barrier leaves behind.
+	// LOCAL/ARGUMENT reads are numbered by what the slot was last set to.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeValue>& vValues = m_Function.m_vValues;
+
+	std::vector<int32_t> vStack;
+	std::map<int32_t, int32_t> mapSlotNumber;
+	std::map<std::string, int32_t> mapNumbers;
+
+	for (int32_t iPosition = pBlock.m_iFirst; iPosition <= pBlock.m_iLast; iPosition++)
+	{
+		int32_t iPops = 0, iPushes = 0;
+		E_PEEPHOLEKIND eKind = kindOf(iPosition, iPops, iPushes);
+		OPCODE eOpCode = opCodeAt(iPosition);
+		int32_t iSlot = slotOf(iPosition);
+
+		if (killsSlots(iPosition))
+			mapSlotNumber.clear();
+
+		if (eKind == E_PEEPHOLEKIND::BARRIER)
+		{
+			for (int32_t iValue : vStack)
+				vValues[iValue].m_iUses++;
+
+			vStack.clear();
+			continue;
+		}
+
+		// Inputs, the deepest first.
+		std::vector<int32_t>& vInputs = m_Function.m_vInputs[iPosition];
+		vInputs.assign(iPops, -1);
+		for (int32_t i = iPops - 1; i >= 0; i--)
+		{
+			if (vStack.empty())
+			{
+				PeepholeValue pValue = { -1, -1, 0, (int32_t)vValues.size(), 0, false, false, true };
+				vValues.push_back(pValue);
+				vStack.push_back(vValues.size() - 1);
+			}
+
+			vInputs[i] = vStack.back();
+			vValues[vStack.back()].m_iUses++;
+			vStack.pop_back();
+		}
+
+		// Outputs.
+		if (eOpCode == OPCODE::DUP)
+		{
+			for (int32_t i = 0; i < 2; i++)
+			{
+				PeepholeValue pValue = { iPosition, -1, 0, vValues[vInputs[0]].m_iNumber, 0, false, false, false };
+				vValues.push_back(pValue);
+				m_Function.m_vOutputs[iPosition].push_back(vValues.size() - 1);
+				vStack.push_back(vValues.size() - 1);
+			}
+		}
+		else
+		if (iPushes > 0)
+		{
+			PeepholeValue pValue = { iPosition, iPosition, 1, -1, 0, false, false, false };
+			pValue.m_bIsPure = (eKind == E_PEEPHOLEKIND::PURE || eKind == E_PEEPHOLEKIND::TRAPS);
+			pValue.m_bCanTrap = (eKind == E_PEEPHOLEKIND::TRAPS);
+			pValue.m_bHasEffects = (eKind == E_PEEPHOLEKIND::EFFECTS);
+
+			std::string sKey = keyOf(iPosition);
+			for (int32_t iInput : vInputs)
+			{
+				const PeepholeValue& pInput = vValues[iInput];
+
+				pValue.m_iSize += pInput.m_iSize;
+				pValue.m_iFirst = (pInput.m_iFirst < 0 || pValue.m_iFirst < 0) ? -1 : std::min(pValue.m_iFirst, pInput.m_iFirst);
+				pValue.m_bIsPure &= pInput.m_bIsPure;
+				pValue.m_bCanTrap |= pInput.m_bCanTrap;
+				pValue.m_bHasEffects |= pInput.m_bHasEffects;
+
+				sKey += "," + std::to_string(pInput.m_iNumber);
+			}
+
+			if (iSlot != NOT_A_SLOT)
+			{
+				std::map<int32_t, int32_t>::iterator itr = mapSlotNumber.find(iSlot);
+				if (itr == mapSlotNumber.end())
+					itr = mapSlotNumber.insert(std::make_pair(iSlot, (int32_t)vValues.size())).first;
+
+				pValue.m_iNumber = itr->second;
+			}
+			else
+			if (pValue.m_bIsPure)
+			{
+				std::map<std::string, int32_t>::iterator itr = mapNumbers.find(sKey);
+				if (itr == mapNumbers.end())
+					itr = mapNumbers.insert(std::make_pair(sKey, (int32_t)vValues.size())).first;
+
+				pValue.m_iNumber = itr->second;
+			}
+			else
+			{
+				pValue.m_iNumber = vValues.size();
+			}
+
+			vValues.push_back(pValue);
+			m_Function.m_vOutputs[iPosition].push_back(vValues.size() - 1);
+			vStack.push_back(vValues.size() - 1);
+		}
+
+		if (eOpCode == OPCODE::STORE && iSlot != NOT_A_SLOT)
+			mapSlotNumber[iSlot] = vValues[vInputs[0]].m_iNumber;
+	}
+}
+
+void PeepholeOptimizer::computeLiveness()
+{
+	//////////////////////////////////////////////////////////////////////
+	// Backward liveness of LOCAL/ARGUMENT slots over the blocks, nothing
+	// is live after a 'RET'.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeBlock>& vBlocks = m_Function.m_vBlocks;
+	std::vector<std::set<int32_t>> vUses(vBlocks.size()), vDefs(vBlocks.size());
+
+	for (size_t iBlock = 0; iBlock < vBlocks.size(); iBlock++)
+	{
+		for (int32_t iPosition = vBlocks[iBlock].m_iFirst; iPosition <= vBlocks[iBlock].m_iLast; iPosition++)
+		{
+			int32_t iSlot = slotOf(iPosition);
+			if (iSlot == NOT_A_SLOT)
+				continue;
+
+			if (opCodeAt(iPosition) == OPCODE::STORE)
+				vDefs[iBlock].insert(iSlot);
+			else
+			if (vDefs[iBlock].find(iSlot) == vDefs[iBlock].end())
+				vUses[iBlock].insert(iSlot);
+		}
+	}
+
+	bool bChanged = true;
+	while (bChanged)
+	{
+		bChanged = false;
+		for (int32_t iBlock = vBlocks.size() - 1; iBlock >= 0; iBlock--)
+		{
+			PeepholeBlock& pBlock = vBlocks[iBlock];
+
+			std::set<int32_t> setLiveOut;
+			if (pBlock.m_bLeavesFunction)
+				setLiveOut = m_Function.m_SetSlots;
+
+			for (int32_t iSuccessor : pBlock.m_vSuccessors)
+				setLiveOut.insert(vBlocks[iSuccessor].m_SetLiveIn.begin(), vBlocks[iSuccessor].m_SetLiveIn.end());
+
+			std::set<int32_t> setLiveIn = vUses[iBlock];
+			for (int32_t iSlot : setLiveOut)
+			{
+				if (vDefs[iBlock].find(iSlot) == vDefs[iBlock].end())
+					setLiveIn.insert(iSlot);
+			}
+
+			if (setLiveIn != pBlock.m_SetLiveIn || setLiveOut != pBlock.m_SetLiveOut)
+			{
+				pBlock.m_SetLiveIn = setLiveIn;
+				pBlock.m_SetLiveOut = setLiveOut;
+				bChanged = true;
+			}
+		}
+	}
+}
+
+int32_t PeepholeOptimizer::propagateCopies()
+{
+	//////////////////////////////////////////////////////////////////////
+	// Within a block:
+	// 1. 'STORE x; FETCH x' ==> 'DUP; STORE x'
+	// 2. 'FETCH x' where x holds a literal ==> the literal.
+	// 3. 'FETCH x' where x holds what y still holds ==> 'FETCH y'
+	// 4. 'CAST INT_32 <int>' & 'CAST FLOAT FLOAT' ==> nothing
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeInstruction>& vInstructions = m_vInstructions;
+	const std::vector<PeepholeValue>& vValues = m_Function.m_vValues;
+	int32_t iChanges = 0;
+
+	for (const PeepholeBlock& pBlock : m_Function.m_vBlocks)
+	{
+		std::map<int32_t, int32_t> mapSlotValue;
+		for (int32_t iPosition = pBlock.m_iFirst; iPosition <= pBlock.m_iLast; iPosition++)
+		{
+			int32_t iIndex = m_Function.m_vCode[iPosition];
+			if (vInstructions[iIndex].m_bRemoved)
+				continue;
+
+			OPCODE eOpCode = opCodeAt(iPosition);
+			int32_t iSlot = slotOf(iPosition);
+
+			if (killsSlots(iPosition))
+				mapSlotValue.clear();
+
+			if (eOpCode == OPCODE::FETCH && iSlot != NOT_A_SLOT)
+			{
+				// 1.
+				if (iPosition > pBlock.m_iFirst && NOT m_Function.m_vIsLabel[iPosition] && NOT vInstructions[m_Function.m_vCode[iPosition - 1]].m_bRemoved)
+				{
+					if (opCodeAt(iPosition - 1) == OPCODE::STORE && operandAt(iPosition - 1) == operandAt(iPosition))
+					{
+						int32_t iVariable = operandAt(iPosition);
+						replace(m_Function.m_vCode[iPosition - 1], OPCODE::DUP, nullptr, 0);
+						replace(iIndex, OPCODE::STORE, (const int8_t*)&iVariable, sizeof(int32_t));
+						iChanges++;
+						continue;
+					}
+				}
+
+				std::map<int32_t, int32_t>::iterator itr = mapSlotValue.find(iSlot);
+				if (itr == mapSlotValue.end())
+				{
+					mapSlotValue[iSlot] = m_Function.m_vOutputs[iPosition][0];
+					continue;
+				}
+
+				int32_t iDefinition = vValues[itr->second].m_iDefinition;
+				if (iDefinition < 0 || vInstructions[m_Function.m_vCode[iDefinition]].m_bRemoved)
+					continue;
+
+				// 2.
+				if (isConstant(iDefinition))
+				{
+					const std::vector<int8_t>& vBytes = vInstructions[m_Function.m_vCode[iDefinition]].m_vBytes;
+					replace(iIndex, (OPCODE)vBytes[0], &vBytes[1], vBytes.size() - 1);
+					iChanges++;
+				}
+				else
+				// 3.
+				if (opCodeAt(iDefinition) == OPCODE::FETCH && slotOf(iDefinition) != NOT_A_SLOT && slotOf(iDefinition) != iSlot)
+				{
+					std::map<int32_t, int32_t>::iterator itrSource = mapSlotValue.find(slotOf(iDefinition));
+					if (itrSource != mapSlotValue.end() && itrSource->second == itr->second)
+					{
+						int32_t iVariable = operandAt(iDefinition);
+						replace(iIndex, OPCODE::FETCH, (const int8_t*)&iVariable, sizeof(int32_t));
+						iChanges++;
+					}
+				}
+			}
+			else
+			if (eOpCode == OPCODE::STORE && iSlot != NOT_A_SLOT)
+			{
+				mapSlotValue[iSlot] = m_Function.m_vInputs[iPosition][0];
+			}
+			else
+			// 4.
+			if (isIdentityCast(iPosition))
+			{
+				vInstructions[iIndex].m_bRemoved = true;
+				iChanges++;
+			}
+		}
+	}
+
+	return iChanges;
+}
+
+int32_t PeepholeOptimizer::eliminateCommonSubexpressions()
+{
+	//////////////////////////////////////////////////////////////////////
+	// Within a block, a pure expression of 2 or more instructions whose
+	// value number a slot holds is replaced by 'FETCH' of that slot.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeInstruction>& vInstructions = m_vInstructions;
+	const std::vector<PeepholeValue>& vValues = m_Function.m_vValues;
+	int32_t iChanges = 0;
+
+	for (const PeepholeBlock& pBlock : m_Function.m_vBlocks)
+	{
+		std::map<int32_t, int32_t> mapSlotNumber;		// Slot ==> value number it holds.
+		std::map<int32_t, int32_t> mapHolder;			// Value number ==> variable holding it.
+
+		for (int32_t iPosition = pBlock.m_iFirst; iPosition <= pBlock.m_iLast; iPosition++)
+		{
+			if (vInstructions[m_Function.m_vCode[iPosition]].m_bRemoved)
+				continue;
+
+			if (killsSlots(iPosition))
+			{
+				mapSlotNumber.clear();
+				mapHolder.clear();
+			}
+
+			if (m_Function.m_vOutputs[iPosition].size() == 1)
+			{
+				int32_t iValue = m_Function.m_vOutputs[iPosition][0];
+				const PeepholeValue& pValue = vValues[iValue];
+
+				std::map<int32_t, int32_t>::iterator itr = mapHolder.find(pValue.m_iNumber);
+				if (pValue.m_bIsPure && pValue.m_iSize >= 2 && itr != mapHolder.end() && isInOneRun(iValue, iPosition))
+				{
+					int32_t iVariable = itr->second;
+					removeRange(pValue.m_iFirst, iPosition - 1);
+					replace(m_Function.m_vCode[iPosition], OPCODE::FETCH, (const int8_t*)&iVariable, sizeof(int32_t));
+					iChanges++;
+				}
+			}
+
+			int32_t iSlot = slotOf(iPosition);
+			if (opCodeAt(iPosition) == OPCODE::STORE && iSlot != NOT_A_SLOT)
+			{
+				std::map<int32_t, int32_t>::iterator itrSlot = mapSlotNumber.find(iSlot);
+				if (itrSlot != mapSlotNumber.end())
+				{
+					std::map<int32_t, int32_t>::iterator itrHolder = mapHolder.find(itrSlot->second);
+					if (itrHolder != mapHolder.end() && itrHolder->second == operandAt(iPosition))
+						mapHolder.erase(itrHolder);
+				}
+
+				int32_t iNumber = vValues[m_Function.m_vInputs[iPosition][0]].m_iNumber;
+				mapSlotNumber[iSlot] = iNumber;
+				if (mapHolder.find(iNumber) == mapHolder.end())
+					mapHolder[iNumber] = operandAt(iPosition);
+			}
+		}
+	}
+
+	return iChanges;
+}
+
+int32_t PeepholeOptimizer::eliminateDeadCode()
+{
+	//////////////////////////////////////////////////////////////////////
+	// A 'STORE' to a slot that is not live after it is removed:
+	// 1. 'DUP; STORE x' ==> nothing
+	// 2. 'expr; STORE x' ==> nothing, if expr can not fault, has no
+	//    effects & nothing but its first instruction is jumped to.
+	//////////////////////////////////////////////////////////////////////
+	const std::vector<PeepholeValue>& vValues = m_Function.m_vValues;
+	int32_t iChanges = 0;
+
+	computeLiveness();
+
+	for (const PeepholeBlock& pBlock : m_Function.m_vBlocks)
+	{
+		std::set<int32_t> setLive = pBlock.m_SetLiveOut;
+		for (int32_t iPosition = pBlock.m_iLast; iPosition >= pBlock.m_iFirst; iPosition--)
+		{
+			int32_t iSlot = slotOf(iPosition);
+			if (iSlot == NOT_A_SLOT)
+				continue;
+
+			if (opCodeAt(iPosition) != OPCODE::STORE)
+			{
+				setLive.insert(iSlot);
+				continue;
+			}
+
+			if (setLive.find(iSlot) != setLive.end())
+			{
+				setLive.erase(iSlot);
+				continue;
+			}
+
+			int32_t iValue = m_Function.m_vInputs[iPosition][0];
+			const PeepholeValue& pValue = vValues[iValue];
+
+			// 1.
+			if (iPosition > pBlock.m_iFirst && opCodeAt(iPosition - 1) == OPCODE::DUP && NOT m_Function.m_vIsLabel[iPosition])
+			{
+				if (m_Function.m_vOutputs[iPosition - 1].size() == 2 && m_Function.m_vOutputs[iPosition - 1][1] == iValue)
+				{
+					removeRange(iPosition - 1, iPosition);
+					iChanges++;
+					iPosition--;
+				}
+				continue;
+			}
+
+			// 2.
+			if (pValue.m_iDefinition == iPosition - 1 && pValue.m_iUses == 1 && NOT pValue.m_bHasEffects && NOT pValue.m_bCanTrap && isInOneRun(iValue, iPosition - 1))
+			{
+				if (NOT m_Function.m_vIsLabel[iPosition])
+				{
+					removeRange(pValue.m_iFirst, iPosition);
+					iChanges++;
+					iPosition = pValue.m_iFirst;
+				}
+			}
+		}
+	}
+
+	return iChanges;
+}
+
+int32_t PeepholeOptimizer::hoistLoopInvariants()
+{
+	//////////////////////////////////////////////////////////////////////
+	// A loop is a 'JMP' back to h, entered only by falling into h.
+	// 'expr; STORE x' in it moves in front of h when:
+	// 1. expr is pure, can not fault & reads no slot written in the loop.
+	// 2. x is written nowhere else in the loop & is not live at h or
+	//    where the loop exits, so every read of x in the loop follows
+	//    this 'STORE'.
+	// 3. Nothing in it is jumped to.
+	// One 'STORE' moves per call, the blocks & values are stale
+	// after that.
+	//////////////////////////////////////////////////////////////////////
+	std::vector<PeepholeInstruction>& vInstructions = m_vInstructions;
+	const std::vector<PeepholeValue>& vValues = m_Function.m_vValues;
+	int32_t iSize = m_Function.m_vCode.size();
+
+	computeLiveness();
+
+	for (int32_t iJump = 0; iJump < iSize; iJump++)
+	{
+		if (opCodeAt(iJump) != OPCODE::JMP)
+			continue;
+
+		int32_t iHead = positionOf(targetOf(m_Function.m_vCode[iJump], 1));
+		if (iHead <= 0 || iHead > iJump)
+			continue;
+
+		OPCODE eBefore = opCodeAt(iHead - 1);
+		if (eBefore == OPCODE::JMP || eBefore == OPCODE::JMPTABLE || eBefore == OPCODE::RET)
+			continue;
+
+		// Nothing outside [iHead, iJump] may land inside it, code outside the function() never does.
+		bool bEnteredFromOutside = false;
+		for (int32_t iPosition = 0; iPosition < iSize && NOT bEnteredFromOutside; iPosition++)
+		{
+			int32_t i = m_Function.m_vCode[iPosition];
+			if (opCodeOf(i) == OPCODE::CALL)
+				continue;
+
+			if (iPosition >= iHead && iPosition <= iJump)
+				continue;
+
+			for (int32_t iTargetPosition : vInstructions[i].m_vTargetPositions)
+			{
+				int32_t iTarget = positionOf(targetOf(i, iTargetPosition));
+				if (iTarget >= iHead && iTarget <= iJump)
+					bEnteredFromOutside = true;
+			}
+		}
+
+		if (bEnteredFromOutside)
+			continue;
+
+		std::map<int32_t, int32_t> mapStores;
+		std::set<int32_t> setLiveAtExits;
+		bool bLeaves = false;
+		for (int32_t iBlock = m_Function.m_vBlockOf[iHead]; iBlock <= m_Function.m_vBlockOf[iJump]; iBlock++)
+		{
+			const PeepholeBlock& pBlock = m_Function.m_vBlocks[iBlock];
+			bLeaves |= pBlock.m_bLeavesFunction;
+
+			for (int32_t iSuccessor : pBlock.m_vSuccessors)
+			{
+				const PeepholeBlock& pSuccessor = m_Function.m_vBlocks[iSuccessor];
+				if (pSuccessor.m_iFirst < iHead || pSuccessor.m_iFirst > iJump)
+					setLiveAtExits.insert(pSuccessor.m_SetLiveIn.begin(), pSuccessor.m_SetLiveIn.end());
+			}
+
+			for (int32_t iPosition = pBlock.m_iFirst; iPosition <= pBlock.m_iLast; iPosition++)
+			{
+				if (opCodeAt(iPosition) == OPCODE::STORE && slotOf(iPosition) != NOT_A_SLOT)
+					mapStores[slotOf(iPosition)]++;
+			}
+		}
+
+		if (bLeaves)
+			continue;
+
+		const std::set<int32_t>& setLiveAtHead = m_Function.m_vBlocks[m_Function.m_vBlockOf[iHead]].m_SetLiveIn;
+		for (int32_t iStore = iHead; iStore <= iJump; iStore++)
+		{
+			int32_t iSlot = slotOf(iStore);
+			if (opCodeAt(iStore) != OPCODE::STORE || iSlot == NOT_A_SLOT || mapStores[iSlot] != 1)
+				continue;
+
+			if (setLiveAtHead.find(iSlot) != setLiveAtHead.end() || setLiveAtExits.find(iSlot) != setLiveAtExits.end())
+				continue;
+
+			// 1.
+			int32_t iValue = m_Function.m_vInputs[iStore][0];
+			const PeepholeValue& pValue = vValues[iValue];
+			if (pValue.m_iDefinition != iStore - 1 || pValue.m_iUses != 1 || NOT pValue.m_bIsPure || pValue.m_bCanTrap || NOT isInOneRun(iValue, iStore - 1))
+				continue;
+
+			bool bInvariant = true;
+			for (int32_t iPosition = pValue.m_iFirst; iPosition <= iStore; iPosition++)
+			{
+				// 3.
+				if (m_Function.m_vIsLabel[iPosition])
+					bInvariant = false;
+
+				if (iPosition < iStore && slotOf(iPosition) != NOT_A_SLOT && mapStores.find(slotOf(iPosition)) != mapStores.end())
+					bInvariant = false;
+			}
+
+			if (NOT bInvariant)
+				continue;
+
+			////////////////////////////////////////////////////////////
+			// Copies go right after the last live instruction before
+			// h, sharing its offset, so whatever refers to that one
+			// still finds it first.
+			int32_t iBefore = m_Function.m_vCode[iHead - 1];
+			std::vector<PeepholeInstruction> vMoved;
+			for (int32_t iPosition = pValue.m_iFirst; iPosition <= iStore; iPosition++)
+			{
+				PeepholeInstruction pInstruction = vInstructions[m_Function.m_vCode[iPosition]];
+				pInstruction.m_iOffset = vInstructions[iBefore].m_iOffset;
+				vMoved.push_back(pInstruction);
+			}
+
+			removeRange(pValue.m_iFirst, iStore);
+			vInstructions.insert(vInstructions.begin() + iBefore + 1, vMoved.begin(), vMoved.end());
+			////////////////////////////////////////////////////////////
+
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+E_PEEPHOLEKIND PeepholeOptimizer::kindOf(int32_t iPosition, int32_t& iPops, int32_t& iPushes)
+{
+	iPops = 0;
+	iPushes = 0;
+
+	OPCODE eOpCode = opCodeAt(iPosition);
+	switch (eOpCode)
+	{
+		case OPCODE::FETCH:
+			iPushes = 1;
+		return (slotOf(iPosition) != NOT_A_SLOT) ? E_PEEPHOLEKIND::PURE : E_PEEPHOLEKIND::READS;
+		case OPCODE::PUSH:
+		case OPCODE::PUSHF:
+		case OPCODE::LEA:						// An address in the STACK FRAME, the same all through the call.
+			iPushes = 1;
+		return E_PEEPHOLEKIND::PURE;
+		case OPCODE::PUSHI:
+			iPushes = 1;
+		return isConstant(iPosition) ? E_PEEPHOLEKIND::PURE : E_PEEPHOLEKIND::EFFECTS;		// Return address or VTABLE offset.
+		case OPCODE::PUSHR:
+			iPushes = 1;
+		return E_PEEPHOLEKIND::READS;
+		case OPCODE::RANDF:
+			iPushes = 1;
+		return E_PEEPHOLEKIND::EFFECTS;
+
+		case OPCODE::MUL:
+		case OPCODE::ADD:
+		case OPCODE::SUB:
+		case OPCODE::JMP_LT:
+		case OPCODE::JMP_LTEQ:
+		case OPCODE::JMP_GT:
+		case OPCODE::JMP_GTEQ:
+		case OPCODE::JMP_EQ:
+		case OPCODE::JMP_NEQ:
+		case OPCODE::LOGICALOR:
+		case OPCODE::LOGICALAND:
+		case OPCODE::BITWISEOR:
+		case OPCODE::BITWISEAND:
+		case OPCODE::BITWISEXOR:
+		case OPCODE::BITWISELEFTSHIFT:
+		case OPCODE::BITWISERIGHTSHIFT:
+		case OPCODE::MULF:
+		case OPCODE::DIVF:
+		case OPCODE::ADDF:
+		case OPCODE::SUBF:
+		case OPCODE::MODF:
+		case OPCODE::MINF:
+		case OPCODE::MAXF:
+			iPops = 2;
+			iPushes = 1;
+		return E_PEEPHOLEKIND::PURE;
+		case OPCODE::DIV:
+		case OPCODE::MOD:
+			iPops = 2;
+			iPushes = 1;
+		return E_PEEPHOLEKIND::TRAPS;
+		case OPCODE::BITWISENOT:
+		case OPCODE::_NOT:
+		case OPCODE::NEGATE:
+		case OPCODE::CAST:
+		case OPCODE::SINF:
+		case OPCODE::COSF:
+		case OPCODE::SQRTF:
+		case OPCODE::ABSF:
+		case OPCODE::FLOORF:
+			iPops = 1;
+			iPushes = 1;
+		return E_PEEPHOLEKIND::PURE;
+		case OPCODE::LERPF:
+			iPops = 3;
+			iPushes = 1;
+		return E_PEEPHOLEKIND::PURE;
+
+		case OPCODE::DUP:
+			iPops = 1;
+			iPushes = 2;
+		return E_PEEPHOLEKIND::EFFECTS;
+		case OPCODE::MALLOC:
+			iPops = 1;
+			iPushes = 1;
+		return E_PEEPHOLEKIND::EFFECTS;
+		case OPCODE::LDA:
+			iPops = 3;
+			iPushes = 1;
+		return E_PEEPHOLEKIND::EFFECTS;
+		case OPCODE::STA:
+			iPops = 3;
+		return E_PEEPHOLEKIND::EFFECTS;
+		case OPCODE::STORE:
+		case OPCODE::POPR:
+		case OPCODE::PRTS:
+		case OPCODE::PRTC:
+		case OPCODE::PRTI:
+		case OPCODE::PRTF:
+		case OPCODE::SRAND:
+		case OPCODE::JZ:
+		case OPCODE::JNZ:
+		case OPCODE::JMPTABLE:
+		case OPCODE::RET:
+			iPops = 1;
+		return E_PEEPHOLEKIND::EFFECTS;
+		case OPCODE::BR_LT:
+		case OPCODE::BR_LTEQ:
+		case OPCODE::BR_GT:
+		case OPCODE::BR_GTEQ:
+		case OPCODE::BR_EQ:
+		case OPCODE::BR_NEQ:
+		case OPCODE::BR_LTF:
+		case OPCODE::BR_LTEQF:
+		case OPCODE::BR_GTF:
+		case OPCODE::BR_GTEQF:
+		case OPCODE::BR_EQF:
+		case OPCODE::BR_NEQF:
+			iPops = 2;
+		return E_PEEPHOLEKIND::EFFECTS;
+		case OPCODE::JMP:
+		case OPCODE::FREE:
+		case OPCODE::CLR:
+		return E_PEEPHOLEKIND::EFFECTS;
+	}
+
+	// 'CALL', 'SYSCALL', 'SUB_REG', 'AWAIT', 'MEM*', 'NOP', 'POP', 'POPI', 'VTBL' & 'HLT'.
+	return E_PEEPHOLEKIND::BARRIER;
+}
+
+int32_t PeepholeOptimizer::slotOf(int32_t iPosition)
+{
+	//////////////////////////////////////////////////////////////////////
+	// The slot a FETCH, STORE, STA, FREE or CLR variable lives in, as its
+	// distance from RBP: an ARGUMENT at RBP + pos, a LOCAL at RBP - pos.
+	//////////////////////////////////////////////////////////////////////
+	OPCODE eOpCode = opCodeAt(iPosition);
+	if (eOpCode != OPCODE::FETCH && eOpCode != OPCODE::STORE && eOpCode != OPCODE::STA && eOpCode != OPCODE::FREE && eOpCode != OPCODE::CLR)
+		return NOT_A_SLOT;
+
+	int32_t iVariable = operandAt(iPosition);
+	int16_t iVariablePos = (iVariable & 0x0000FFFF);
+	E_VARIABLESCOPE eVariableType = (E_VARIABLESCOPE)(iVariable >> (sizeof(int16_t) * 8));
+
+	if (eVariableType == E_VARIABLESCOPE::ARGUMENT)
+		return iVariablePos;
+	else
+	if (eVariableType == E_VARIABLESCOPE::LOCAL)
+		return -iVariablePos;
+
+	return NOT_A_SLOT;
+}
+
+bool PeepholeOptimizer::killsSlots(int32_t iPosition)
+{
+	// 'POPR RBP' & 'SUB_REG RBP n' move every slot.
+	const std::vector<int8_t>& vBytes = m_vInstructions[m_Function.m_vCode[iPosition]].m_vBytes;
+	OPCODE eOpCode = (OPCODE)vBytes[0];
+
+	return (eOpCode == OPCODE::POPR || eOpCode == OPCODE::SUB_REG) && vBytes[1] == (int8_t)EREGISTERS::RBP;
+}
+
+bool PeepholeOptimizer::isIdentityCast(int32_t iPosition)
+{
+	// 'CAST INT_32 <int>' & 'CAST FLOAT FLOAT' leave the STACK as it is, see VirtualMachine::cast().
+	const std::vector<int8_t>& vBytes = m_vInstructions[m_Function.m_vCode[iPosition]].m_vBytes;
+	if ((OPCODE)vBytes[0] != OPCODE::CAST)
+		return false;
+
+	PRIMIIVETYPE eLVal = (PRIMIIVETYPE)vBytes[1];
+	PRIMIIVETYPE eRVal = (PRIMIIVETYPE)vBytes[2];
+
+	return (eLVal == PRIMIIVETYPE::INT_32 && eRVal != PRIMIIVETYPE::FLOAT) || (eLVal == PRIMIIVETYPE::FLOAT && eRVal == PRIMIIVETYPE::FLOAT);
+}
+
+bool PeepholeOptimizer::isConstant(int32_t iPosition)
+{
+	const PeepholeInstruction& pInstruction = m_vInstructions[m_Function.m_vCode[iPosition]];
+	OPCODE eOpCode = (OPCODE)pInstruction.m_vBytes[0];
+
+	return (eOpCode == OPCODE::PUSHI && pInstruction.m_vTargetPositions.empty()) || eOpCode == OPCODE::PUSHF || eOpCode == OPCODE::PUSH;
+}
+
+bool PeepholeOptimizer::isInOneRun(int32_t iValue, int32_t iPosition)
+{
+	//////////////////////////////////////////////////////////////////////
+	// true if iValue is computed by exactly the instructions in
+	// [m_iFirst, iPosition] & only m_iFirst may be jumped to.
+	//////////////////////////////////////////////////////////////////////
+	const PeepholeValue& pValue = m_Function.m_vValues[iValue];
+	if (pValue.m_iFirst < 0 || pValue.m_iDefinition != iPosition || (iPosition - pValue.m_iFirst + 1) != pValue.m_iSize)
+		return false;
+
+	for (int32_t i = pValue.m_iFirst + 1; i <= iPosition; i++)
+	{
+		if (m_Function.m_vIsLabel[i])
+			return false;
+	}
+
+	return true;
+}
+
+int32_t PeepholeOptimizer::positionOf(int32_t iTarget)
+{
+	// Position of the live instruction a code offset lands on, -1 if that is outside the function().
+	int32_t iIndex = indexAt(iTarget);
+	if (iIndex >= 0 && m_vInstructions[iIndex].m_bRemoved)
+		iIndex = nextLive(iIndex);
+
+	if (iIndex < m_Function.m_iFirstIndex || iIndex >= m_Function.m_iEndIndex)
+		return -1;
+
+	return m_Function.m_vPositionOf[iIndex - m_Function.m_iFirstIndex];
+}
+
+void PeepholeOptimizer::removeRange(int32_t iFirst, int32_t iLast)
+{
+	for (int32_t iPosition = iFirst; iPosition <= iLast; iPosition++)
+		m_vInstructions[m_Function.m_vCode[iPosition]].m_bRemoved = true;
+}
+
+OPCODE PeepholeOptimizer::opCodeAt(int32_t iPosition)
+{
+	return opCodeOf(m_Function.m_vCode[iPosition]);
+}
+
+int32_t PeepholeOptimizer::operandAt(int32_t iPosition)
+{
+	// The 4 byte variable of a FETCH, STORE, STA, FREE or CLR.
+	return operandOf(m_Function.m_vCode[iPosition], 1);
+}
+
+std::string PeepholeOptimizer::keyOf(int32_t iPosition)
+{
+	const std::vector<int8_t>& vBytes = m_vInstructions[m_Function.m_vCode[iPosition]].m_vBytes;
+	return std::string(vBytes.begin(), vBytes.end());
+}
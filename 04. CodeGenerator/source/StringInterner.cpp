@@ -0,0 +1,95 @@
+#include "StringInterner.h"
+#include <cstring>
+#include <assert.h>
+
+#define INITIAL_SLOT_COUNT	1024
+
+std::deque<std::string>		StringInterner::m_vSymbols;
+std::vector<uint32_t>		StringInterner::m_vHashes;
+std::vector<int32_t>		StringInterner::m_vSlots;
+
+uint32_t StringInterner::hash(const char* sText, int32_t iLength)
+{
+	// FNV-1a
+	uint32_t iHash = 2166136261u;
+	for (int32_t i = 0; i < iLength; i++)
+	{
+		iHash ^= (uint8_t)sText[i];
+		iHash *= 16777619u;
+	}
+
+	return iHash;
+}
+
+int32_t StringInterner::findSlot(const char* sText, int32_t iLength, uint32_t iHash)
+{
+	// Linear probing, the table is at most half full so an empty slot is always reached.
+	uint32_t iMask = (uint32_t)m_vSlots.size() - 1;
+	uint32_t iSlot = iHash & iMask;
+	while (true)
+	{
+		int32_t iSymbol = m_vSlots[iSlot];
+		if (iSymbol == INVALID_SYMBOL)
+			return iSlot;
+
+		const std::string& sSymbol = m_vSymbols[iSymbol];
+		if (	m_vHashes[iSymbol] == iHash
+				&&
+				sSymbol.length() == (size_t)iLength
+				&&
+				memcmp(sSymbol.c_str(), sText, iLength) == 0
+		) {
+			return iSlot;
+		}
+
+		iSlot = (iSlot + 1) & iMask;
+	}
+}
+
+void StringInterner::grow()
+{
+	size_t iNewSize = m_vSlots.empty() ? INITIAL_SLOT_COUNT : m_vSlots.size() * 2;
+	m_vSlots.assign(iNewSize, INVALID_SYMBOL);
+
+	uint32_t iMask = (uint32_t)iNewSize - 1;
+	for (int32_t iSymbol = 0; iSymbol < (int32_t)m_vSymbols.size(); iSymbol++)
+	{
+		uint32_t iSlot = m_vHashes[iSymbol] & iMask;
+		while (m_vSlots[iSlot] != INVALID_SYMBOL)
+			iSlot = (iSlot + 1) & iMask;
+
+		m_vSlots[iSlot] = iSymbol;
+	}
+}
+
+int32_t StringInterner::intern(const char* sText, int32_t iLength)
+{
+	if ((m_vSymbols.size() + 1) * 2 > m_vSlots.size())
+		grow();
+
+	uint32_t iHash = hash(sText, iLength);
+	int32_t iSlot = findSlot(sText, iLength, iHash);
+	if (m_vSlots[iSlot] == INVALID_SYMBOL)
+	{
+		m_vSlots[iSlot] = (int32_t)m_vSymbols.size();
+		m_vSymbols.push_back(std::string(sText, iLength));
+		m_vHashes.push_back(iHash);
+	}
+
+	return m_vSlots[iSlot];
+}
+
+int32_t StringInterner::find(const char* sText, int32_t iLength)
+{
+	if (m_vSlots.empty())
+		return INVALID_SYMBOL;
+
+	int32_t iSlot = findSlot(sText, iLength, hash(sText, iLength));
+	return m_vSlots[iSlot];
+}
+
+const std::string& StringInterner::toString(int32_t iSymbol)
+{
+	assert(iSymbol >= 0 && iSymbol < (int32_t)m_vSymbols.size());
+	return m_vSymbols[iSymbol];
+}
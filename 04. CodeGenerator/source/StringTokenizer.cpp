@@ -1,4 +1,79 @@
 #include "StringTokenizer.h"
+#include "KeywordTable.h"
+#include <cstring>
+#if (TOKENIZER_SSE2 == 1)
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// Character classes used by the bulk scanners. Only ASCII is classified, which matches
+// what isalpha/isdigit report in the "C" locale. END_OF_INPUT has no class, so every
+// scalar scan stops at the terminating '\0' of the source buffer without a bounds check.
+struct CharClassTable
+{
+	CharClassTable()
+	{
+		memset(m_iClass, 0, sizeof(m_iClass));
+		for (int ch = '0'; ch <= '9'; ch++)
+			m_iClass[ch] |= CHARCLASS_DIGIT | CHARCLASS_IDENTIFIER;
+		for (int ch = 'a'; ch <= 'z'; ch++)
+			m_iClass[ch] |= CHARCLASS_IDENTIFIER;
+		for (int ch = 'A'; ch <= 'Z'; ch++)
+			m_iClass[ch] |= CHARCLASS_IDENTIFIER;
+		m_iClass['_'] |= CHARCLASS_IDENTIFIER;
+		m_iClass[WHITESPACE_SPACE] |= CHARCLASS_WHITESPACE;
+		m_iClass[WHITESPACE_TAB] |= CHARCLASS_WHITESPACE;
+	}
+
+	uint8_t	m_iClass[256];
+};
+
+static const CharClassTable g_CharClassTable;
+
+#if (TOKENIZER_SSE2 == 1)
+// Index of the lowest set bit, iMask must not be 0.
+static inline int lowestSetBit(uint32_t iMask)
+{
+#if defined(_MSC_VER)
+	unsigned long iIndex;
+	_BitScanForward(&iIndex, iMask);
+	return (int)iIndex;
+#else
+	return __builtin_ctz(iMask);
+#endif
+}
+
+// g_CharClassTable for 16 characters at once, bit i is set if vChars[i] is in iCharClass.
+// The compares are signed, so characters >= 0x80 fail every range test just as they have no
+// class in the table.
+static inline int classMask(__m128i vChars, uint8_t iCharClass)
+{
+	__m128i vInClass = _mm_setzero_si128();
+	if (iCharClass & (CHARCLASS_DIGIT | CHARCLASS_IDENTIFIER))
+	{
+		__m128i vDigit = _mm_and_si128(_mm_cmpgt_epi8(vChars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(vChars, _mm_set1_epi8('9' + 1)));
+		vInClass = _mm_or_si128(vInClass, vDigit);
+	}
+
+	if (iCharClass & CHARCLASS_IDENTIFIER)
+	{
+		// Setting bit 5 folds 'A'..'Z' onto 'a'..'z', & nothing else lands in that range.
+		__m128i vLower = _mm_or_si128(vChars, _mm_set1_epi8(0x20));
+		__m128i vAlpha = _mm_and_si128(_mm_cmpgt_epi8(vLower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(vLower, _mm_set1_epi8('z' + 1)));
+		vInClass = _mm_or_si128(vInClass, _mm_or_si128(vAlpha, _mm_cmpeq_epi8(vChars, _mm_set1_epi8('_'))));
+	}
+
+	if (iCharClass & CHARCLASS_WHITESPACE)
+	{
+		__m128i vBlank = _mm_or_si128(_mm_cmpeq_epi8(vChars, _mm_set1_epi8(WHITESPACE_SPACE)), _mm_cmpeq_epi8(vChars, _mm_set1_epi8(WHITESPACE_TAB)));
+		vInClass = _mm_or_si128(vInClass, vBlank);
+	}
+
+	return _mm_movemask_epi8(vInClass);
+}
+#endif
 
 StringTokenizer* StringTokenizer::create(const char* sData, bool bIgnoreBNFNonTerminals)
 {
@@ -6,17 +81,52 @@ StringTokenizer* StringTokenizer::create(const char* sData, bool bIgnoreBNFNonTe
 	return pStringTokenizer;
 }
 
+StringTokenizer* StringTokenizer::create(std::string&& sData, bool bIgnoreBNFNonTerminals)
+{
+	StringTokenizer* pStringTokenizer = new StringTokenizer(std::move(sData), bIgnoreBNFNonTerminals);
+	return pStringTokenizer;
+}
+
+StringTokenizer* StringTokenizer::create(RandomAccessFile* pSource, bool bIgnoreBNFNonTerminals)
+{
+	StringTokenizer* pStringTokenizer = new StringTokenizer(pSource, bIgnoreBNFNonTerminals);
+	return pStringTokenizer;
+}
+
 StringTokenizer::StringTokenizer(const char* sData, bool bIgnoreBNFNonTerminals)
 {
 	init(sData);
 	m_bIgnoreBNFNonTerminals = bIgnoreBNFNonTerminals;
 }
 
+StringTokenizer::StringTokenizer(std::string&& sData, bool bIgnoreBNFNonTerminals)
+: m_sData(std::move(sData))
+{
+	initState();
+	m_bIgnoreBNFNonTerminals = bIgnoreBNFNonTerminals;
+}
+
+StringTokenizer::StringTokenizer(RandomAccessFile* pSource, bool bIgnoreBNFNonTerminals)
+{
+	initState();
+	m_bIgnoreBNFNonTerminals = bIgnoreBNFNonTerminals;
+
+	m_pSource = pSource;
+	m_bSourceExhausted = false;
+	m_vHistory.assign(TOKEN_HISTORY_SIZE, Token(TokenType_::Type::TK_INVALID, "", -1, -1));
+}
+
 void StringTokenizer::init(const char* sData)
 {
 	m_sData = "";
 	if (sData != nullptr)
 		m_sData = sData;
+
+	initState();
+}
+
+void StringTokenizer::initState()
+{
 	m_iDataLength = m_sData.length();
 
 	m_iCurrPos = m_iSavedPos = 0;
@@ -28,11 +138,16 @@ void StringTokenizer::init(const char* sData)
 
 	m_vTokens.clear();
 	m_TokensIterator = m_vTokens.end();
+
+	m_pSource = nullptr;
+	m_bSourceExhausted = true;
+	m_bEOIReached = false;
+	m_iHistoryCount = 0;
 }
 
 void StringTokenizer::reset()
 {
-	init(m_sData.c_str());
+	initState();
 }
 
 void StringTokenizer::setData(const char* sData, bool bIgnoreBNFNonTerminals)
@@ -43,25 +158,67 @@ void StringTokenizer::setData(const char* sData, bool bIgnoreBNFNonTerminals)
 
 bool StringTokenizer::hasMoreTokens()
 {
+	if (m_pSource != nullptr)
+		return NOT m_bEOIReached;
+
 	return (m_TokensIterator != m_vTokens.end());
 }
 
 Token StringTokenizer::nextToken()
 {
-	Token tok = *m_TokensIterator;
+	if (m_pSource != nullptr)
+	{
+		// The span points into the window, copy the text out before the window moves on.
+		Token tok = toToken(streamNextToken());
+		addToHistory(tok);
+
+		return tok;
+	}
+
+	const TokenSpan& tokenSpan = *m_TokensIterator;
 	m_TokensIterator++;
 
-	return tok;
+	return toToken(tokenSpan);
+}
+
+Token StringTokenizer::toToken(const TokenSpan& tokenSpan) const
+{
+	return Token(tokenSpan.m_eTokenType, std::string(getTokenText(tokenSpan), tokenSpan.m_iLength), tokenSpan.m_iLine, tokenSpan.m_iColumn, tokenSpan.m_eKeywordType, tokenSpan.m_eKeyword);
 }
 
 Token StringTokenizer::prevToken()
 {
 	Token tok(TokenType_::Type::TK_INVALID, "", -1, -1);
+	if (m_pSource != nullptr)
+	{
+		int iAvailable = (m_iHistoryCount < TOKEN_HISTORY_SIZE) ? m_iHistoryCount : TOKEN_HISTORY_SIZE;
+		for (int i = 1; i <= iAvailable; i++)
+		{
+			const Token& recentToken = m_vHistory[(m_iHistoryCount - i) % TOKEN_HISTORY_SIZE];
+			TokenType_::Type eTokenType = recentToken.m_eTokenType;
+			if (	eTokenType == TokenType_::Type::TK_WHITESPACE
+					||
+					eTokenType == TokenType_::Type::TK_EOL
+					||
+					eTokenType == TokenType_::Type::TK_EOI
+					||
+					eTokenType == TokenType_::Type::TK_COMMA
+			) {
+				continue;
+			}
+
+			tok = recentToken;
+			break;
+		}
+
+		return tok;
+	}
+
 	if (m_TokensIterator != m_vTokens.begin())
 	{
 		int iCount = 1;
-		tok = *(m_TokensIterator - iCount++);
-		TokenType_::Type eTokenType = tok.m_eTokenType;
+		std::vector<TokenSpan>::const_iterator itSpan = m_TokensIterator - iCount++;
+		TokenType_::Type eTokenType = itSpan->m_eTokenType;
 		while (	eTokenType == TokenType_::Type::TK_WHITESPACE 
 				||
 				eTokenType == TokenType_::Type::TK_EOL
@@ -70,9 +227,11 @@ Token StringTokenizer::prevToken()
 				|| 
 				eTokenType == TokenType_::Type::TK_COMMA
 		) {
-			tok = *(m_TokensIterator - iCount++);
-			eTokenType = tok.m_eTokenType;
+			itSpan = m_TokensIterator - iCount++;
+			eTokenType = itSpan->m_eTokenType;
 		}
+
+		tok = toToken(*itSpan);
 	}
 
 	return tok;
@@ -85,26 +244,34 @@ void StringTokenizer::ignoreBNFNonTerminals(bool bIgnore)
 
 void StringTokenizer::tokenize()
 {
+	// A streaming tokenizer lexes in nextToken(), one token at a time.
+	if (m_pSource != nullptr)
+		return;
+
+	// Single character tokens keep the token count a large fraction of the source length.
+	// Reserve up front so the loop below rarely has to reallocate.
+	m_vTokens.reserve(m_iDataLength / 2 + 1);
+
 	while (true)
 	{
-		Token tok = getNextToken();
+		TokenSpan tok = getNextToken();
 
-		//if( NOT (tok.getType() == TokenType::Type::TK_EOL || tok.getType() == TokenType::Type::TK_WHITESPACE))
-		//	printf("tok = %s ==> %s\n", tok.getText(), TokenType::toString(tok.getType()).c_str());
+		//if( NOT (tok.m_eTokenType == TokenType::Type::TK_EOL || tok.m_eTokenType == TokenType::Type::TK_WHITESPACE))
+		//	printf("tok = %.*s ==> %s\n", tok.m_iLength, getTokenText(tok), TokenType::toString(tok.m_eTokenType).c_str());
 
 		m_vTokens.push_back(tok);
 
-		if (tok.getType() == TokenType_::Type::TK_FLOAT)
+		if (tok.m_eTokenType == TokenType_::Type::TK_FLOAT)
 			m_bHasFloatingPoint = true;
 
-		if (tok.getType() == TokenType_::Type::TK_EOI)
+		if (tok.m_eTokenType == TokenType_::Type::TK_EOI)
 			break;
 	};
 
 	m_TokensIterator = m_vTokens.begin();
 }
 
-Token StringTokenizer::getNextToken()
+TokenSpan StringTokenizer::getNextToken()
 {
 	initRead();
 	while (true)
@@ -114,6 +281,73 @@ Token StringTokenizer::getNextToken()
 	}
 }
 
+TokenSpan StringTokenizer::streamNextToken()
+{
+	//////////////////////////////////////////////////////////////////////
+	// 1. Keep at least half a chunk ahead of the current position, so a token nearly
+	//    always lies completely inside the window.
+	// 2. Lex it like tokenize() does.
+	// 3. A longer token (a big comment or string) runs into the end of the window, rewind
+	//    & lex it again once the next chunk is in.
+	if (NOT m_bSourceExhausted && m_iDataLength - m_iCurrPos < TOKENIZER_CHUNK_SIZE / 2)
+		readChunk();
+
+	while (true)
+	{
+		int iPos = m_iCurrPos, iLine = m_iCurrLine, iColumn = m_iCurrColumn;
+
+		TokenSpan tok = getNextToken();
+		if (NOT m_bSourceExhausted && m_iCurrPos + TOKENIZER_LOOKAHEAD > m_iDataLength)
+		{
+			m_iCurrPos = iPos;
+			m_iCurrLine = iLine;
+			m_iCurrColumn = iColumn;
+
+			readChunk();
+			continue;
+		}
+
+		if (tok.m_eTokenType == TokenType_::Type::TK_FLOAT)
+			m_bHasFloatingPoint = true;
+
+		if (tok.m_eTokenType == TokenType_::Type::TK_EOI)
+			m_bEOIReached = true;
+
+		return tok;
+	}
+}
+
+void StringTokenizer::readChunk()
+{
+	// Tokens before m_iCurrPos were already copied out by nextToken(), drop them.
+	m_sData.erase(0, m_iCurrPos);
+	m_iCurrPos = m_iSavedPos = 0;
+
+	size_t iKept = m_sData.length();
+	m_sData.resize(iKept + TOKENIZER_CHUNK_SIZE + 1);		// RandomAccessFile::read() terminates the chunk.
+
+	unsigned long iBytesRead = m_pSource->read(&m_sData[iKept], 0, TOKENIZER_CHUNK_SIZE);
+	if (iBytesRead > TOKENIZER_CHUNK_SIZE)
+		iBytesRead = 0;
+
+	// Like GrammerUtils::read() used to, the source ends at the first '\0'.
+	size_t iLength = strnlen(m_sData.c_str() + iKept, iBytesRead);
+	m_sData.resize(iKept + iLength);
+	m_iDataLength = m_sData.length();
+
+	if (iLength < TOKENIZER_CHUNK_SIZE)
+	{
+		m_bSourceExhausted = true;
+		m_pSource->close();
+	}
+}
+
+void StringTokenizer::addToHistory(const Token& tok)
+{
+	m_vHistory[m_iHistoryCount % TOKEN_HISTORY_SIZE] = tok;
+	m_iHistoryCount++;
+}
+
 void StringTokenizer::initRead()
 {
 	m_iSavedPos = m_iCurrPos;
@@ -121,6 +355,63 @@ void StringTokenizer::initRead()
 	m_iSavedColumn = m_iCurrColumn;
 }
 
+int StringTokenizer::scanWhile(uint8_t iCharClass)
+{
+	const unsigned char* pStart = reinterpret_cast<const unsigned char*>(m_sData.c_str() + m_iCurrPos);
+	const unsigned char* pCurr = pStart;
+
+#if (TOKENIZER_SSE2 == 1)
+	// 16 characters at a time while a whole block lies inside the buffer...
+	const unsigned char* pEnd = reinterpret_cast<const unsigned char*>(m_sData.c_str() + m_iDataLength);
+	while (pEnd - pCurr >= 16)
+	{
+		int iMask = classMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCurr)), iCharClass);
+		if (iMask != 0xFFFF)
+			return (int)(pCurr - pStart) + lowestSetBit(~iMask & 0xFFFF);
+
+		pCurr += 16;
+	}
+#endif
+
+	// ...& the tail through the table.
+	while (g_CharClassTable.m_iClass[*pCurr] & iCharClass)
+		pCurr++;
+
+	return (int)(pCurr - pStart);
+}
+
+int StringTokenizer::scanUntil(char ch0, char ch1, char ch2)
+{
+	const char* pStart = m_sData.c_str() + m_iCurrPos;
+	const char* pCurr = pStart;
+
+#if (TOKENIZER_SSE2 == 1)
+	// 16 characters at a time while a whole block lies inside the buffer...
+	const char* pEnd = m_sData.c_str() + m_iDataLength;
+	__m128i vStop0 = _mm_set1_epi8(ch0);
+	__m128i vStop1 = _mm_set1_epi8(ch1);
+	__m128i vStop2 = _mm_set1_epi8(ch2);
+	__m128i vEndOfInput = _mm_setzero_si128();
+	while (pEnd - pCurr >= 16)
+	{
+		__m128i vChars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCurr));
+		__m128i vStop = _mm_or_si128(	_mm_or_si128(_mm_cmpeq_epi8(vChars, vStop0), _mm_cmpeq_epi8(vChars, vStop1)),
+										_mm_or_si128(_mm_cmpeq_epi8(vChars, vStop2), _mm_cmpeq_epi8(vChars, vEndOfInput)));
+		int iMask = _mm_movemask_epi8(vStop);
+		if (iMask != 0)
+			return (int)(pCurr - pStart) + lowestSetBit(iMask);
+
+		pCurr += 16;
+	}
+#endif
+
+	// ...& the tail a character at a time, up to the terminating '\0' at the latest.
+	while (*pCurr != ch0 && *pCurr != ch1 && *pCurr != ch2 && *pCurr != END_OF_INPUT)
+		pCurr++;
+
+	return (int)(pCurr - pStart);
+}
+
 char StringTokenizer::peek(int iOffset)
 {
 	int iPeekOffset = m_iCurrPos + iOffset;
@@ -136,39 +427,36 @@ void StringTokenizer::consume(int iOffset)
 	m_iCurrColumn += iOffset;
 }
 
-Token StringTokenizer::createToken(TokenType_::Type eTokenType)
+TokenSpan StringTokenizer::createToken(TokenType_::Type eTokenType)
 {
-	std::string sText = m_sData.substr(m_iSavedPos, m_iCurrPos - m_iSavedPos);
-	return Token(eTokenType, sText, m_iSavedLine, m_iSavedColumn);
+	int32_t iLength = m_iCurrPos - m_iSavedPos;
+	const KeywordEntry* pKeyword = findKeyword(m_sData.c_str() + m_iSavedPos, iLength);
+	KeywordType_::Type eKeywordType = (pKeyword != nullptr) ? pKeyword->m_eKeywordType : KeywordType_::Type::KW_NONE;
+	KeywordID_::Type eKeyword = (pKeyword != nullptr) ? pKeyword->m_eKeyword : KeywordID_::Type::KW_INVALID;
+
+	return TokenSpan{ eTokenType, m_iSavedPos, iLength, m_iSavedLine, m_iSavedColumn, eKeywordType, eKeyword };
 }
 
-Token StringTokenizer::readNumber()
+TokenSpan StringTokenizer::readNumber()
 {
 	initRead();
 	bool bHasDot = false;
 
 	// Read the 1st digit
 	consume(1);
+	consume(scanWhile(CHARCLASS_DIGIT));
 
-	while (true)
+	if (peek(0) == '.')
 	{
-		char ch = peek(0);
-		if (::isdigit(ch))
-			consume(1);
-		else
-		if (ch == '.' && NOT bHasDot)
-		{
-			bHasDot = true;
-			consume(1);
-		}
-		else
-			break;
+		bHasDot = true;
+		consume(1);
+		consume(scanWhile(CHARCLASS_DIGIT));
 	}
 
 	return createToken( bHasDot ? TokenType_::Type::TK_FLOAT : TokenType_::Type::TK_INTEGER);
 }
 
-Token StringTokenizer::readEOL()
+TokenSpan StringTokenizer::readEOL()
 {
 	char ch = peek(0);
 	if (ch == LINE_FEED)
@@ -180,15 +468,20 @@ Token StringTokenizer::readEOL()
 	return createToken(TokenType_::Type::TK_EOL);
 }
 
-Token StringTokenizer::readString()
+TokenSpan StringTokenizer::readString()
 {
 	consume(1);
 	initRead();
 
+	// Most strings sit on one line, jump straight to the closing quote.
+	int iLength = scanUntil('"', CARRIAGE_RETURN, LINE_FEED);
+	if (peek(iLength) == '"')
+		consume(iLength);
+
 	while (true)
 	{
 		char ch = peek(0);
-		if (ch == '"')
+		if (ch == '"' || ch == END_OF_INPUT)
 			break;
 		if (ch == CARRIAGE_RETURN)
 		{
@@ -210,13 +503,13 @@ Token StringTokenizer::readString()
 			consume(1);
 	}
 
-	Token tok = createToken(TokenType_::Type::TK_STRING);
+	TokenSpan tok = createToken(TokenType_::Type::TK_STRING);
 	consume(1);
 
 	return tok;
 }
 
-Token StringTokenizer::readCharacter()
+TokenSpan StringTokenizer::readCharacter()
 {
 	consume(1);
 	initRead();
@@ -224,52 +517,45 @@ Token StringTokenizer::readCharacter()
 	char ch = peek(0);
 	consume(1);
 
-	Token tok = createToken(TokenType_::Type::TK_CHARACTER);
+	TokenSpan tok = createToken(TokenType_::Type::TK_CHARACTER);
 	consume(1);
 
 	return tok;
 }
 
-Token StringTokenizer::readSingleLineComment()
+TokenSpan StringTokenizer::readSingleLineComment()
 {
 	consume(2);
 	initRead();
 
-	while (true)
-	{
-		char ch = peek(0);
-		if (ch == CARRIAGE_RETURN || ch == LINE_FEED)
-			break;
-		else
-			consume(1);
-	}
+	// Runs up to the next CR/LF, or to the end of the input on the last line.
+	consume(scanUntil(CARRIAGE_RETURN, LINE_FEED));
 
 	return createToken(TokenType_::Type::TK_SINGLELINECOMMENT);
 }
 
-Token StringTokenizer::readMultiLineComment()
+TokenSpan StringTokenizer::readMultiLineComment()
 {
 	consume(2);
 	initRead();
 
+	// Jump from '*' to '*' till one closes the comment, or to the end of the input.
 	while (true)
 	{
-		char ch = peek(0);
-		if (ch == '*' && peek(1) == '/')
-		{
+		consume(scanUntil('*'));
+		if (peek(0) == END_OF_INPUT || peek(1) == '/')
 			break;
-		}
-		else
-			consume(1);
+
+		consume(1);
 	}
-	
-	Token tok = createToken(TokenType_::Type::TK_MULTILINECOMMENT);
+
+	TokenSpan tok = createToken(TokenType_::Type::TK_MULTILINECOMMENT);
 	consume(2);
 
 	return tok;
 }
 
-Token StringTokenizer::readDefault(char ch0)
+TokenSpan StringTokenizer::readDefault(char ch0)
 {
 	char ch1 = peek(1);
 	char ch2 = peek(2);
@@ -281,7 +567,7 @@ Token StringTokenizer::readDefault(char ch0)
 	else if(ch0 == 'f' && ch1 == 'o' && ch2 == 'r' && peek(3) == '(')		{ initRead(); consume(3); return createToken(TokenType_::Type::TK_FOR); }
 	else if(ch0 == 'i' && ch1 == 'f' && ch2 == '(')							{ initRead(); consume(2); return createToken(TokenType_::Type::TK_IF); }
 	else if(ch0 == 'e' && ch1 == 'l' && ch2 == 's' && peek(3) == 'e')		{ initRead(); consume(4); return createToken(TokenType_::Type::TK_ELSE); }
-	else if(ch0 == WHITESPACE_SPACE || ch0 == WHITESPACE_TAB)				{ initRead(); consume(1); return createToken(TokenType_::Type::TK_WHITESPACE); }
+	else if(ch0 == WHITESPACE_SPACE || ch0 == WHITESPACE_TAB)				{ initRead(); consume(1); consume(scanWhile(CHARCLASS_WHITESPACE)); return createToken(TokenType_::Type::TK_WHITESPACE); }
 	else if(ch0 == 'N' && ch1 == 'E' && ch2 == 'G' && peek(3) == 'A' && peek(4) == 'T' && peek(5) == 'E')
 																			{ initRead(); consume(6); return createToken(TokenType_::Type::TK_NEGATE); }
 
@@ -348,64 +634,57 @@ Token StringTokenizer::readDefault(char ch0)
 	else																	{ initRead(); consume(1); return createToken(TokenType_::Type::TK_UNKNOWN); }
 }
 
-Token StringTokenizer::readIdentifier()
+TokenSpan StringTokenizer::readIdentifier()
 {
 	initRead();
 	consume(1);
+	consume(scanWhile(CHARCLASS_IDENTIFIER));
 
-	while (true)
+	char ch = peek(0);
+	if (ch == '(')
 	{
-		char ch = peek(0);
-		if (isalpha(ch) || ch == '_' || isdigit(ch))
-			consume(1);
-		else
-		if (ch == '(')
-		{
-			Token tok = createToken(TokenType_::Type::TK_FUNCTIONCALL);
-			return tok;
-		}
-		else
-		if (ch == '-' && peek(1) == '>')
-		{
-			Token tok = createToken(TokenType_::Type::TK_MEMBERACCESS);
-			return tok;
-		}
-		else
-		if (ch == '[')
-		{
-			Token tok = createToken(TokenType_::Type::TK_DEREFARRAY);
-			return tok;
-		}
-		else
-		if (ch == '-' && peek(1) == '-')
-		{
-			Token tok = createToken(TokenType_::Type::TK_POSTFIXDECR);
-			consume(2);
+		TokenSpan tok = createToken(TokenType_::Type::TK_FUNCTIONCALL);
+		return tok;
+	}
+	else
+	if (ch == '-' && peek(1) == '>')
+	{
+		TokenSpan tok = createToken(TokenType_::Type::TK_MEMBERACCESS);
+		return tok;
+	}
+	else
+	if (ch == '[')
+	{
+		TokenSpan tok = createToken(TokenType_::Type::TK_DEREFARRAY);
+		return tok;
+	}
+	else
+	if (ch == '-' && peek(1) == '-')
+	{
+		TokenSpan tok = createToken(TokenType_::Type::TK_POSTFIXDECR);
+		consume(2);
 
-			return tok;
-		}
-		else
-		if (ch == '+' && peek(1) == '+')
-		{	
-			Token tok = createToken(TokenType_::Type::TK_POSTFIXINCR);
-			consume(2);
+		return tok;
+	}
+	else
+	if (ch == '+' && peek(1) == '+')
+	{	
+		TokenSpan tok = createToken(TokenType_::Type::TK_POSTFIXINCR);
+		consume(2);
 
-			return tok;
-		}
-		else
-		if (ch == ':' && peek(1) == ':')
-		{	
-			Token tok = createToken(TokenType_::Type::TK_STATICMEMBERACCESS);
-			return tok;
-		}
-		else
-			break;
+		return tok;
+	}
+	else
+	if (ch == ':' && peek(1) == ':')
+	{	
+		TokenSpan tok = createToken(TokenType_::Type::TK_STATICMEMBERACCESS);
+		return tok;
 	}
 
 	return createToken(TokenType_::Type::TK_IDENTIFIER);
 }
 
-Token StringTokenizer::readSystemIdentifier()
+TokenSpan StringTokenizer::readSystemIdentifier()
 {
 	consume(2);
 	initRead();
@@ -416,51 +695,37 @@ Token StringTokenizer::readSystemIdentifier()
 		if (isalpha(ch) || ch == '_' || isdigit(ch))
 			consume(1);
 		else
-		if (ch == '(')
+		if (ch == '(' || ch == END_OF_INPUT)
 		{
 			break;
 		}
 	}
 
-	Token tok = createToken(TokenType_::Type::TK_SYSTEMFUNCTIONCALL);
+	TokenSpan tok = createToken(TokenType_::Type::TK_SYSTEMFUNCTIONCALL);
 	return tok;
 }
 
-Token StringTokenizer::readPrefixIncrDecr(bool bIsIncr)
+TokenSpan StringTokenizer::readPrefixIncrDecr(bool bIsIncr)
 {
 	consume(2);
 	initRead();
 
-	while (true)
-	{
-		char ch = peek(0);
-		if (isalpha(ch) || ch == '_' || isdigit(ch))
-			consume(1);
-		else
-			break;
-	}
+	consume(scanWhile(CHARCLASS_IDENTIFIER));
 
 	return createToken(bIsIncr ? TokenType_::Type::TK_PREFIXINCR : TokenType_::Type::TK_PREFIXDECR);
 }
 
-Token StringTokenizer::readPointerDeref()
+TokenSpan StringTokenizer::readPointerDeref()
 {
 	consume(1);
 	initRead();
 
-	while (true)
-	{
-		char ch = peek(0);
-		if (isalpha(ch) || ch == '_' || isdigit(ch))
-			consume(1);
-		else
-			break;
-	}
+	consume(scanWhile(CHARCLASS_IDENTIFIER));
 
 	return createToken(TokenType_::Type::TK_DEREF);
 }
 
-Token StringTokenizer::readBNFNonTerminal()
+TokenSpan StringTokenizer::readBNFNonTerminal()
 {
 	consume(1);
 	initRead();
@@ -468,7 +733,7 @@ Token StringTokenizer::readBNFNonTerminal()
 	while (true)
 	{
 		char ch = peek(0);
-		if (ch != '>')
+		if (ch != '>' && ch != END_OF_INPUT)
 		{
 			consume(1);
 		}
@@ -476,7 +741,7 @@ Token StringTokenizer::readBNFNonTerminal()
 			break;
 	}
 
-	Token tok = createToken(TokenType_::Type::TK_BNFNONTERMINAL);
+	TokenSpan tok = createToken(TokenType_::Type::TK_BNFNONTERMINAL);
 	consume(1);
 
 	return tok;
@@ -505,7 +770,7 @@ bool StringTokenizer::isBNFCode(bool bStartTag)
 			);
 }
 
-Token StringTokenizer::readBNFCode()
+TokenSpan StringTokenizer::readBNFCode()
 {
 	consume(8);
 	initRead();
@@ -513,7 +778,7 @@ Token StringTokenizer::readBNFCode()
 	while (true)
 	{
 		char ch = peek(0);
-		if (ch == '"' && isBNFCode(false))
+		if ((ch == '"' && isBNFCode(false)) || ch == END_OF_INPUT)
 		{
 			break;
 		}
@@ -521,7 +786,7 @@ Token StringTokenizer::readBNFCode()
 			consume(1);
 	}
 
-	Token tok = createToken(TokenType_::Type::TK_BNFCODE);
+	TokenSpan tok = createToken(TokenType_::Type::TK_BNFCODE);
 	consume(9);
 
 	return tok;
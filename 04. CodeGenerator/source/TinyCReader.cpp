@@ -34,6 +34,7 @@
 #define SAVED_TOKEN_TEXT 											GrammerUtils::m_pSavedToken.getText()
 #define PREV_TOKEN 													GrammerUtils::m_pPrevToken
 #define PREV_TOKEN_TEXT 											GrammerUtils::m_pPrevToken.getText()
+#define PREV_TOKEN_KEYWORD 										GrammerUtils::m_pPrevToken.m_eKeyword
 
 #define GET_INFO_FOR_KEY(__node__, __key__)							__node__->getAdditionalInfoFor(__key__)
 #define SET_INFO_FOR_KEY(__node__, __key__, __info__)				__node__->setAdditionalInfo(__key__, __info__)
@@ -56,10 +57,9 @@ void TinyCReader::read(const char* sFile)
 	//////////////// THIS PIECE OF CODE WILL REMAIN COMMON FOR ALL //////////////////
 	if (GrammerUtils::read(sFile))
 	{
-		addKeywords();
 		GrammerUtils::getNextToken();
 
-		m_pASTRootNode = new Tree();
+		m_pASTRootNode = TreeArena::allocate();
 		{
 			m_pASTRootNode->m_eASTNodeType = ASTNodeType::ASTNode_ROOT;
 			m_pASTCurrentNode = m_pASTRootNode;
@@ -68,199 +68,142 @@ void TinyCReader::read(const char* sFile)
 		def();
 
 		GrammerUtils::generateCode(m_pASTRootNode);
+
+		ExprArena::release();
+		TreeArena::release();
+		m_pASTRootNode = nullptr;
+		m_pASTCurrentNode = nullptr;
 	}
 	/////////////////////////////////////////////////////////////////////////////////
 }
 
-std::string TinyCReader::popOperator()
+ENUM_OP_PRECEDENCE TinyCReader::binaryPrecedence(TokenType_::Type eTokenType)
+{
+	switch (eTokenType)
+	{
+		case TokenType_::Type::TK_LOGICALOR:			return ENUM_OP_PRECEDENCE::OP_LOGICALOR;
+		case TokenType_::Type::TK_LOGICALAND:			return ENUM_OP_PRECEDENCE::OP_LOGICALAND;
+		case TokenType_::Type::TK_BITWISEOR:			return ENUM_OP_PRECEDENCE::OP_BITWISEOR;
+		case TokenType_::Type::TK_BITWISEAND:			return ENUM_OP_PRECEDENCE::OP_BITWISEAND;
+		case TokenType_::Type::TK_BITWISEXOR:			return ENUM_OP_PRECEDENCE::OP_BITWISEXOR;
+		case TokenType_::Type::TK_BITWISELEFTSHIFT:		return ENUM_OP_PRECEDENCE::OP_BITWISELEFTSHIFT;
+		case TokenType_::Type::TK_BITWISERIGHTSHIFT:	return ENUM_OP_PRECEDENCE::OP_BITWISERIGHTSHIFT;
+		case TokenType_::Type::TK_EQ:					return ENUM_OP_PRECEDENCE::OP_EQ;
+		case TokenType_::Type::TK_NEQ:					return ENUM_OP_PRECEDENCE::OP_NEQ;
+		case TokenType_::Type::TK_LT:					return ENUM_OP_PRECEDENCE::OP_LT;
+		case TokenType_::Type::TK_LTEQ:					return ENUM_OP_PRECEDENCE::OP_LTEQ;
+		case TokenType_::Type::TK_GT:					return ENUM_OP_PRECEDENCE::OP_GT;
+		case TokenType_::Type::TK_GTEQ:					return ENUM_OP_PRECEDENCE::OP_GTEQ;
+		case TokenType_::Type::TK_ADD:					return ENUM_OP_PRECEDENCE::OP_ADD;
+		case TokenType_::Type::TK_SUB:					return ENUM_OP_PRECEDENCE::OP_SUB;
+		case TokenType_::Type::TK_MUL:					return ENUM_OP_PRECEDENCE::OP_MUL;
+		case TokenType_::Type::TK_DIV:					return ENUM_OP_PRECEDENCE::OP_DIV;
+		case TokenType_::Type::TK_MOD:					return ENUM_OP_PRECEDENCE::OP_MOD;
+	}
+
+	return ENUM_OP_PRECEDENCE::OP_INVALID;
+}
+
+ExprNode* TinyCReader::pushOperand(ExprNodeType_::Type eExprNodeType, const std::string& sText)
 {
-	if (!m_vOperatorStack.empty())
+	ExprNode* pOperand = ExprArena::allocate();
 	{
-		std::string sTop = m_vOperatorStack.top();
-		m_vOperatorStack.pop();
-
-		return sTop;
+		pOperand->m_eExprNodeType = eExprNodeType;
+		pOperand->m_sText = sText;
 	}
 
-	return "";
+	m_vOperandStack.push_back(pOperand);
+	return pOperand;
 }
 
-ENUM_OP_PRECEDENCE TinyCReader::opFromString(std::string sOperator)
+ExprNode* TinyCReader::popOperand()
 {
-	ENUM_OP_PRECEDENCE eOperator = ENUM_OP_PRECEDENCE::OP_INVALID;
+	assert(NOT m_vOperandStack.empty() && m_vOperandStack.back() != nullptr);
+	if (m_vOperandStack.empty() || m_vOperandStack.back() == nullptr)
+		return nullptr;
 
-	if (sOperator == "||")
-		eOperator = ENUM_OP_PRECEDENCE::OP_LOGICALOR;
-	else
-		if (sOperator == "&&")
-			eOperator = ENUM_OP_PRECEDENCE::OP_LOGICALAND;
-		else
-			if (sOperator == "|")
-				eOperator = ENUM_OP_PRECEDENCE::OP_BITWISEOR;
-			else
-				if (sOperator == "&")
-					eOperator = ENUM_OP_PRECEDENCE::OP_BITWISEAND;
-				else
-					if (sOperator == "^")
-						eOperator = ENUM_OP_PRECEDENCE::OP_BITWISEXOR;
-					else
-						if (sOperator == "~")
-							eOperator = ENUM_OP_PRECEDENCE::OP_BITWISENOT;
-						else
-							if (sOperator == "<<")
-								eOperator = ENUM_OP_PRECEDENCE::OP_BITWISELEFTSHIFT;
-							else
-								if (sOperator == ">>")
-									eOperator = ENUM_OP_PRECEDENCE::OP_BITWISERIGHTSHIFT;
-								else
-									if (sOperator == "==")
-										eOperator = ENUM_OP_PRECEDENCE::OP_EQ;
-									else
-										if (sOperator == "!=")
-											eOperator = ENUM_OP_PRECEDENCE::OP_NEQ;
-										else
-											if (sOperator == "<")
-												eOperator = ENUM_OP_PRECEDENCE::OP_LT;
-											else
-												if (sOperator == "<=")
-													eOperator = ENUM_OP_PRECEDENCE::OP_LTEQ;
-												else
-													if (sOperator == ">")
-														eOperator = ENUM_OP_PRECEDENCE::OP_GT;
-													else
-														if (sOperator == ">=")
-															eOperator = ENUM_OP_PRECEDENCE::OP_GTEQ;
-														else
-															if (sOperator == "+")
-																eOperator = ENUM_OP_PRECEDENCE::OP_ADD;
-															else
-																if (sOperator == "-")
-																	eOperator = ENUM_OP_PRECEDENCE::OP_SUB;
-																else
-																	if (sOperator == "*")
-																		eOperator = ENUM_OP_PRECEDENCE::OP_MUL;
-																	else
-																		if (sOperator == "/")
-																			eOperator = ENUM_OP_PRECEDENCE::OP_DIV;
-																		else
-																			if (sOperator == "(")
-																				eOperator = ENUM_OP_PRECEDENCE::OP_LPAREN;
-																			else
-																				if (sOperator == ")")
-																					eOperator = ENUM_OP_PRECEDENCE::OP_RPAREN;
-																				else
-																					if (sOperator == "%")
-																						eOperator = ENUM_OP_PRECEDENCE::OP_MOD;
-																					else
-																						if (sOperator == "!")
-																							eOperator = ENUM_OP_PRECEDENCE::OP_NOT;
-																						else
-																							if (sOperator == "NEGATE")
-																								eOperator = ENUM_OP_PRECEDENCE::OP_NEGATE;
-
-	return eOperator;
+	ExprNode* pOperand = m_vOperandStack.back();
+	m_vOperandStack.pop_back();
+
+	return pOperand;
 }
 
-void TinyCReader::checkOpPrecedenceAndPush(std::string sCurrentOperator)
+void TinyCReader::reduceOperator(TokenType_::Type eOperator, const std::string& sText, bool bIsUnary)
 {
-	if (m_vOperatorStack.empty()) m_vOperatorStack.push(sCurrentOperator);
-	else
+	ExprNode* pOperatorNode = ExprArena::allocate();
 	{
-		if (sCurrentOperator == ")")
-		{
-			while (NOT m_vOperatorStack.empty())
-			{
-				std::string sOp = m_vOperatorStack.top();
-				popOperator();
+		pOperatorNode->m_eExprNodeType = bIsUnary ? ExprNodeType_::Type::EXPR_UNARY : ExprNodeType_::Type::EXPR_BINARY;
+		pOperatorNode->m_eOperator = eOperator;
+		pOperatorNode->m_sText = sText;
 
-				if (sOp != "(")
-				{
-					m_vPostFix.push_back(sOp);
-				}
-				else
-				{
-					break;
-				}
-			}
-		}
-		else
-		{
-			if (sCurrentOperator == "(")
-			{
-				m_vOperatorStack.push(sCurrentOperator);
-			}
-			else
-			{
-				int eCurrOp = (int)opFromString(sCurrentOperator);
+		if (NOT bIsUnary)
+			pOperatorNode->m_pRight = popOperand();
+		pOperatorNode->m_pLeft = popOperand();
+	}
 
-				std::string sTopOfStack = m_vOperatorStack.top();
-				int eTopOfStack = (int)opFromString(sTopOfStack);
+	// The right operand of '&&' & '||' is only evaluated if the left one does not decide the result,
+	// so the calls hoisted out of it must not run ahead of the expression.
+	if (eOperator == TokenType_::Type::TK_LOGICALAND || eOperator == TokenType_::Type::TK_LOGICALOR)
+		markConditionalCalls(pOperatorNode->m_pRight);
 
-				if (eCurrOp > eTopOfStack)
-					m_vOperatorStack.push(sCurrentOperator);
-				else
-				{
-					popOperator();
-					m_vPostFix.push_back(sTopOfStack);
-					m_vOperatorStack.push(sCurrentOperator);
-				}
-			}
-		}
-	}
+	m_vOperandStack.push_back(pOperatorNode);
 }
 
-Tree* TinyCReader::createPostFixExpr(Tree* pLeaf /* = nullptr*/)
+void TinyCReader::markConditionalCalls(ExprNode* pExprNode)
 {
-	if (!m_vOperatorStack.empty())
-	{
-		std::string sTop = m_vOperatorStack.top();
-		while (NOT(m_vOperatorStack.empty() || sTop == "_START_"))
-		{
-			m_vPostFix.push_back(sTop);
-			m_vOperatorStack.pop();
+	if (pExprNode == nullptr)
+		return;
 
-			if (NOT m_vOperatorStack.empty())
-				sTop = m_vOperatorStack.top();
-		}
+	if (pExprNode->m_pCallNode != nullptr)
+		pExprNode->m_pCallNode->m_bIsConditionalCall = true;
 
-		if (sTop == "_START_")
-			m_vOperatorStack.pop();
-	}
+	markConditionalCalls(pExprNode->m_pLeft);
+	markConditionalCalls(pExprNode->m_pRight);
+}
 
-	std::string sPostFixExpr = "";
+bool TinyCReader::parseExpression(ENUM_OP_PRECEDENCE eMinPrecedence)
+{
+	//////////////////////////////////////////////////////////////////////
+	// Precedence climbing:
+	// 1. primary() pushes the left operand, unary operators & parentheses included.
+	// 2. Every binary operator binding tighter than eMinPrecedence is consumed, its
+	//    right operand is parsed with the operator's own precedence (left associative)
+	//    & both operands are reduced to one node.
+	// So m_vOperandStack grows by exactly one node per call.
+	if (!primary())
+		return false;
 
-	int iSize = m_vPostFix.size(), i = 0, iStartPos = 0;
-	while (i < iSize)
+	while (true)
 	{
-		if (m_vPostFix[i] == "_START_")
-		{
-			iStartPos = i + 1;
-		}
-		i++;
-	}
+		TokenType_::Type eOperator = GrammerUtils::m_pToken.getType();
+		ENUM_OP_PRECEDENCE ePrecedence = binaryPrecedence(eOperator);
+		if ((int)ePrecedence <= (int)eMinPrecedence)
+			break;
 
-	for (int i = iStartPos; i < iSize; i++)
-	{
-		sPostFixExpr += m_vPostFix[i];
-		if (i < iSize - 1)
-			sPostFixExpr += ", ";
-	}
+		std::string sOperator = GrammerUtils::m_pToken.getText();
+		GrammerUtils::match(sOperator, MANDATORY_);
 
-	if (iStartPos >= 1)
-	{
-		iStartPos--;
-		while (iStartPos != m_vPostFix.size())
-		{
-			m_vPostFix.erase(m_vPostFix.begin() + iStartPos);
-		}
+		if (!parseExpression(ePrecedence))
+			return false;
+
+		reduceOperator(eOperator, sOperator, false);
 	}
-	else
-		m_vPostFix.clear();
+
+	return true;
+}
+
+Tree* TinyCReader::createExpressionLeaf(Tree* pLeaf /* = nullptr*/)
+{
+	//////////////////////////////////////////////////////////////////////
+	// The expression just parsed sits on top of the operand stack. A start
+	// marker on top means the expression produced no operand (malloc etc).
+	ExprNode* pExpression = nullptr;
+	if (NOT m_vOperandStack.empty() && m_vOperandStack.back() != nullptr)
+		pExpression = popOperand();
 
 	if (pLeaf == nullptr)
-		pLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, sPostFixExpr.c_str());
-	else
-		pLeaf->setAdditionalInfo("text", sPostFixExpr);
+		pLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
+	pLeaf->m_pExpression = pExpression;
 
 	return pLeaf;
 }
@@ -268,10 +211,10 @@ Tree* TinyCReader::createPostFixExpr(Tree* pLeaf /* = nullptr*/)
 
 Tree* TinyCReader::makeLeaf(ASTNodeType eASTNodeType, const char* sText)
 {
-	Tree* pLeaf = new Tree();
+	Tree* pLeaf = TreeArena::allocate();
 	{
 		pLeaf->m_eASTNodeType = eASTNodeType;
-		pLeaf->setAdditionalInfo("text", sText);
+		SET_INFO_FOR_KEY(pLeaf, ASTInfo::TEXT, sText);
 	}
 
 	return pLeaf;
@@ -279,7 +222,7 @@ Tree* TinyCReader::makeLeaf(ASTNodeType eASTNodeType, const char* sText)
 
 Tree* TinyCReader::makeNode(ASTNodeType eASTNodeType, Tree* pLeft, Tree* pRight)
 {
-	Tree* pNode = new Tree();
+	Tree* pNode = TreeArena::allocate();
 	{
 		pNode->m_eASTNodeType = eASTNodeType;
 		pNode->m_pLeftNode = pLeft;
@@ -319,105 +262,97 @@ void TinyCReader::removeLastFromBlockString()
 
 std::string	TinyCReader::getFullyQualifiedNameForVariable(Tree* pNode, std::string sVariable)
 {
-	std::string sFullyQualifiedName;
-	bool bFound = false;
-
-	if (NOT bFound)
-	{
-		for (Tree* pChild : pNode->m_vStatements)
+	//////////////////////////////////////////////////////////////////////
+	// Each block keeps its declarations in a hashed scope (Tree::findSymbol),
+	// so this walks the scope chain from the current block outwards and does
+	// one hash lookup per level instead of scanning every statement.
+	//
+	// Per level:
+	// 1. Declarations of this block.
+	// 2. 'Static' & 'Host Data' variables.
+	// 3. 'Member Variables' of the enclosing 'Struct' & its parents.
+	// 4. Move to the 'Arg list' of a function or to the parent block.
+	//
+	// Names are compared by their interned symbol, a name that was never
+	// interned cannot have been declared.
+	//////////////////////////////////////////////////////////////////////
+	int32_t iSymbol = StringInterner::find(sVariable);
+	if (iSymbol == INVALID_SYMBOL)
+		return "";
+
+	while (pNode != nullptr)
+	{
+		// 1.
+		Tree* pDeclaration = pNode->findSymbol(iSymbol);
+		if (pDeclaration != nullptr)
+			return pDeclaration->getAdditionalInfoFor(ASTInfo::TEXT);
+
+		// 2.
+		int32_t iIndex = FunctionInfo::findStaticVariable(iSymbol);
+		if (iIndex >= 0)
+			return GET_INFO_FOR_KEY(FunctionInfo::m_vStaticVariables[iIndex], ASTInfo::TEXT);
+
+		iIndex = FunctionInfo::findHostVariable(iSymbol);
+		if (iIndex >= 0)
+			return GET_INFO_FOR_KEY(FunctionInfo::m_vHostVariables[iIndex], ASTInfo::TEXT);
+
+		// 3.
+		Tree* pStructNode = pNode->m_pParentNode;
+		while (pStructNode != nullptr && pStructNode->m_eASTNodeType == ASTNodeType::ASTNode_STRUCTDEF)
 		{
-			if (pChild->m_eASTNodeType == ASTNodeType::ASTNode_TYPE
-				|
-				pChild->m_eASTNodeType == ASTNodeType::ASTNode_TYPEARRAY
-				|
-				pChild->m_eASTNodeType == ASTNodeType::ASTNode_TYPESTRUCT
-				) {
-				if (pChild->m_sAdditionalInfo == sVariable)
-				{
-					sFullyQualifiedName = pChild->getAdditionalInfoFor("text");
-					bFound = true;
-					break;
-				}
-			}
-		}
-	}
+			Tree* pMemberNode = pStructNode->findSymbol(iSymbol);
+			if (pMemberNode != nullptr && pMemberNode->m_eASTNodeType != ASTNodeType::ASTNode_TYPESTRUCT)
+				return pMemberNode->getAdditionalInfoFor(ASTInfo::TEXT);
 
-	if (NOT bFound)
-	{
-		for (Tree* pStaticVar : FunctionInfo::m_vStaticVariables)
-		{
-			if (pStaticVar->getAdditionalInfoFor("text") == sVariable)
-			{
-				sFullyQualifiedName = pStaticVar->getAdditionalInfoFor("text");
-				bFound = true;
+			std::string sStructParentName = GET_INFO_FOR_KEY(pStructNode, ASTInfo::EXTENDS);
+			if (sStructParentName.empty())
 				break;
-			}
-		}
-	}
 
-	// Check for 'Member Variables'
-	if (NOT bFound)
-	{
-		Tree* pStructNode = pNode->m_pParentNode;
-	LABEL_STRUCT_INFO:
-		if (pStructNode->m_eASTNodeType == ASTNodeType::ASTNode_STRUCTDEF)
-		{
-			// 1. Check if its a Member Variable of the 'Struct'
-			for (Tree* pChildNode : pStructNode->m_vStatements) // Starts with index 0
-			{
-				if (pChildNode->m_eASTNodeType == ASTNodeType::ASTNode_TYPE
-					||
-					pChildNode->m_eASTNodeType == ASTNodeType::ASTNode_TYPEARRAY
-					) {
-					if (pChildNode->m_sAdditionalInfo == sVariable)
-					{
-						sFullyQualifiedName = pChildNode->getAdditionalInfoFor("text");
-						bFound = true;
-						break;
-					}
-				}
-			}
-
-			// 2. Check if its a Member Variable of the Parent 'Struct'
-			if (NOT bFound)
-			{
-				std::string sStructParentName = GET_INFO_FOR_KEY(pStructNode, "extends");
-				if (NOT sStructParentName.empty())
-				{
-					pStructNode = getStructNodeByName(sStructParentName);
-					goto LABEL_STRUCT_INFO;
-				}
-			}
+			pStructNode = getStructNodeByName(sStructParentName);
 		}
 
-	}
-
-	if (sFullyQualifiedName.empty())
-	{
+		// 4.
 		if (pNode->m_eASTNodeType == ASTNodeType::ASTNode_FUNCTIONDEF)
-		{
-			sFullyQualifiedName = getFullyQualifiedNameForVariable(pNode->m_pRightNode, sVariable); // Search in the 'Arg list'.
-		}
+			pNode = pNode->m_pRightNode; // Search in the 'Arg list'.
 		else
-		{
-			sFullyQualifiedName = getFullyQualifiedNameForVariable(pNode->m_pParentNode, sVariable);
-		}
+			pNode = pNode->m_pParentNode;
 	}
 
-	return sFullyQualifiedName;
+	return "";
 }
 
 
 void TinyCReader::addType(std::string sType)
 {
-	GrammerUtils::m_vTypes.push_back(sType);
+	// Builtin types are fixed at compile time in KeywordTable.h.
+	assert(GrammerUtils::isABuiltInType(sType.c_str()));
 }
 
 bool TinyCReader::isValidType(std::string sType)
 {
-	for (std::string sInBuiltType : GrammerUtils::m_vTypes)
+	if (GrammerUtils::isABuiltInType(sType.c_str()))
 	{
-		if (sType == sInBuiltType)
+		GrammerUtils::m_pPrevToken = GrammerUtils::m_pToken;
+		GrammerUtils::getNextToken();
+
+		return true;
+	}
+
+	return false;
+}
+
+void TinyCReader::addIntrinsic(std::string sIntrinsic)
+{
+	// Intrinsic names are reserved as keywords in KeywordTable.h.
+	assert(GrammerUtils::isAKeyword(sIntrinsic.c_str()));
+	GrammerUtils::m_vIntrinsics.push_back(sIntrinsic);
+}
+
+bool TinyCReader::isValidIntrinsic(std::string sIntrinsic)
+{
+	for (std::string sInBuiltIntrinsic : GrammerUtils::m_vIntrinsics)
+	{
+		if (sIntrinsic == sInBuiltIntrinsic)
 		{
 			GrammerUtils::m_pPrevToken = GrammerUtils::m_pToken;
 			GrammerUtils::getNextToken();
@@ -431,20 +366,17 @@ bool TinyCReader::isValidType(std::string sType)
 
 void TinyCReader::addStructType(std::string sType)
 {
-	GrammerUtils::m_vUserDefinedTypes.push_back(sType);
+	GrammerUtils::m_SetUserDefinedTypes.insert(StringInterner::intern(sType));
 }
 
 bool TinyCReader::isValidStructType(std::string sType)
 {
-	for (std::string sInBuiltType : GrammerUtils::m_vUserDefinedTypes)
+	if (GrammerUtils::isAUserDefinedType(sType.c_str()))
 	{
-		if (sType == sInBuiltType)
-		{
-			GrammerUtils::m_pPrevToken = GrammerUtils::m_pToken;
-			GrammerUtils::getNextToken();
+		GrammerUtils::m_pPrevToken = GrammerUtils::m_pToken;
+		GrammerUtils::getNextToken();
 
-			return true;
-		}
+		return true;
 	}
 
 	return false;
@@ -452,20 +384,17 @@ bool TinyCReader::isValidStructType(std::string sType)
 
 void TinyCReader::addInterfaceType(std::string sType)
 {
-	GrammerUtils::m_vUserDefinedInterfaces.push_back(sType);
+	GrammerUtils::m_SetUserDefinedInterfaces.insert(StringInterner::intern(sType));
 }
 
 bool TinyCReader::isValidInterfaceType(std::string sType)
 {
-	for (std::string sInBuiltInterface : GrammerUtils::m_vUserDefinedInterfaces)
+	if (GrammerUtils::isAUserDefinedInterface(sType.c_str()))
 	{
-		if (sType == sInBuiltInterface)
-		{
-			GrammerUtils::m_pPrevToken = GrammerUtils::m_pToken;
-			GrammerUtils::getNextToken();
+		GrammerUtils::m_pPrevToken = GrammerUtils::m_pToken;
+		GrammerUtils::getNextToken();
 
-			return true;
-		}
+		return true;
 	}
 
 	return false;
@@ -555,16 +484,11 @@ E_VARIABLESCOPE TinyCReader::getCurrentScope()
 	return eCurrentScope;
 }
 
-std::string TinyCReader::getCurrentScopeString()
-{
-	return toString(getCurrentScope());
-}
-
 Tree* TinyCReader::getStructNodeByName(std::string sStructName)
 {
 	for (Tree* pStruct : m_vStructs)
 	{
-		if (GET_INFO_FOR_KEY(pStruct, "text") == sStructName)
+		if (GET_INFO_FOR_KEY(pStruct, ASTInfo::TEXT) == sStructName)
 		{
 			return pStruct;
 		}
@@ -597,9 +521,9 @@ void TinyCReader::handleFunctionCallInExpr(std::string sFunctionType)
 		char sUniqueFuncName[255] = {};
 		sprintf_s(sUniqueFuncName, "%u", pFunctionCallNode);
 
-		std::string sFuncName = GET_INFO_FOR_KEY(pFunctionCallNode, "text");
+		std::string sFuncName = GET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::TEXT);
 		std::string sFullyQualifiedTempVariableName;
-		sFullyQualifiedTempVariableName.append(GET_INFO_FOR_KEY(pAssignNode, "text"));
+		sFullyQualifiedTempVariableName.append(GET_INFO_FOR_KEY(pAssignNode, ASTInfo::TEXT));
 		sFullyQualifiedTempVariableName.append("_");
 		sFullyQualifiedTempVariableName.append(sFuncName);
 		sFullyQualifiedTempVariableName.append("_");
@@ -607,17 +531,17 @@ void TinyCReader::handleFunctionCallInExpr(std::string sFunctionType)
 
 		Tree* pPrimIntNode = makeLeaf(ASTNodeType::ASTNode_TYPE, sFullyQualifiedTempVariableName.c_str());
 		{
-			GrammerUtils::m_vUserDefinedVariables.push_back(sFullyQualifiedTempVariableName);
-			GrammerUtils::m_vUserDefinedVariables.push_back(sFuncName);
+			GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sFullyQualifiedTempVariableName));
+			GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sFuncName));
 
-			pPrimIntNode->m_sAdditionalInfo.append(sFullyQualifiedTempVariableName);
-			SET_INFO_FOR_KEY(pPrimIntNode, "givenName", sFuncName);
+			APPEND_INFO_FOR_KEY(pPrimIntNode, ASTInfo::SYMBOL, sFullyQualifiedTempVariableName);
+			SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::GIVENNAME, sFuncName);
 			if (NOT sFunctionType.empty())
 			{
-				SET_INFO_FOR_KEY(pPrimIntNode, "modifyType", sFunctionType.c_str());
+				SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::MODIFYTYPE, sFunctionType.c_str());
 			}
-			SET_INFO_FOR_KEY(pPrimIntNode, "type", "int32_t");
-			SET_INFO_FOR_KEY(pPrimIntNode, "scope", getCurrentScopeString());
+			SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::TYPE, "int32_t");
+			pPrimIntNode->m_eScope = getCurrentScope();
 			m_pASTCurrentBlockNode->addChild(pPrimIntNode);
 		}
 
@@ -628,24 +552,17 @@ void TinyCReader::handleFunctionCallInExpr(std::string sFunctionType)
 			pExpressionLeftLeaf->addChild(pFunctionCallNode);
 		}
 
-		m_vPostFix.push_back(sFullyQualifiedTempVariableName);
+		ExprNode* pTempNode = pushOperand(ExprNodeType_::Type::EXPR_VARIABLE, sFullyQualifiedTempVariableName);
+		pTempNode->m_pCallNode = pPrimIntNode;
 	}
 }
 
 void TinyCReader::clearTopOfExpressionStack()
 {
-	int32_t iPostFixSize = m_vPostFix.size();
-	if (iPostFixSize > 0)
-	{
-		if (iPostFixSize == 1 && m_vPostFix[0] == "_START_")
-			m_vPostFix.clear();
-		else
-			if (m_vPostFix[iPostFixSize - 1] == "_START_")
-				m_vPostFix.erase(m_vPostFix.begin() + iPostFixSize - 1);
-	}
-
-	if (m_vOperatorStack.size() > 0 && m_vOperatorStack.top() == "_START_")
-		m_vOperatorStack.pop();
+	// Pops the start marker pushed by the function call, the arguments have consumed their operands by now.
+	assert(NOT m_vOperandStack.empty() && m_vOperandStack.back() == nullptr);
+	if (NOT m_vOperandStack.empty() && m_vOperandStack.back() == nullptr)
+		m_vOperandStack.pop_back();
 }
 
 
@@ -656,6 +573,18 @@ bool TinyCReader::def() {
 	addType("int32_t");
 	addType("float");
 
+	addIntrinsic("sin");
+	addIntrinsic("cos");
+	addIntrinsic("sqrt");
+	addIntrinsic("abs");
+	addIntrinsic("min");
+	addIntrinsic("max");
+	addIntrinsic("floor");
+	addIntrinsic("lerp");
+	addIntrinsic("rand");
+	addIntrinsic("srand");
+	addIntrinsic("await");
+
 	while (true) {
 		if (objectList()) {
 		}
@@ -688,14 +617,18 @@ bool TinyCReader::objectList() {
 						return true;
 					}
 					else
-						return false;
+						if (hostDataDeclaration()) {
+							return true;
+						}
+						else
+							return false;
 
 	return true;
 
 }
 
 bool TinyCReader::interfaceDeclaration() {
-	if (!GrammerUtils::match("interface", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_INTERFACE, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, MANDATORY_))
 		return false;
@@ -740,7 +673,7 @@ bool TinyCReader::interfaceDeclaration() {
 		}
 
 
-		SET_INFO_FOR_KEY(pInterfaceDefNode, "extends", sStructParentList);
+		SET_INFO_FOR_KEY(pInterfaceDefNode, ASTInfo::EXTENDS, sStructParentList);
 
 	}
 
@@ -797,10 +730,10 @@ bool TinyCReader::interfaceObjectList() {
 }
 
 bool TinyCReader::functionDeclaration() {
-	if (!GrammerUtils::match("inline", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_INLINE, MANDATORY_))
 		return false;
 
-	std::string sPrevText = PREV_TOKEN_TEXT;
+	KeywordID_::Type ePrevKeyword = PREV_TOKEN_KEYWORD;
 
 	if (!GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, MANDATORY_))
 		return false;
@@ -824,9 +757,9 @@ bool TinyCReader::functionDeclaration() {
 		pFunctionDefNode->m_pLeftNode = pReturnTypeNode;
 		pFunctionDefNode->m_pRightNode = pArgListNode;
 
-		if (sPrevText == "virtual")
+		if (ePrevKeyword == KeywordID_::Type::KW_VIRTUAL)
 		{
-			SET_INFO_FOR_KEY(pFunctionDefNode, "isVirtual", "virtual");
+			SET_INFO_FOR_KEY(pFunctionDefNode, ASTInfo::ISVIRTUAL, "virtual");
 		}
 	}
 
@@ -850,7 +783,7 @@ bool TinyCReader::functionDeclaration() {
 	if (!GrammerUtils::match(')', MANDATORY_))
 		return false;
 
-	SET_INFO_FOR_KEY(pFunctionDefNode, "isPure", "pure");
+	SET_INFO_FOR_KEY(pFunctionDefNode, ASTInfo::ISPURE, "pure");
 
 	Tree* pFuncEndNode = makeLeaf(ASTNodeType::ASTNode_FUNCTIONEND, "");
 	m_pASTCurrentNode->addChild(pFuncEndNode);
@@ -860,7 +793,7 @@ bool TinyCReader::functionDeclaration() {
 }
 
 bool TinyCReader::structDeclaration() {
-	if (!GrammerUtils::match("struct", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_STRUCT, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, MANDATORY_))
 		return false;
@@ -888,11 +821,11 @@ bool TinyCReader::structDeclaration() {
 			return false;
 
 		std::string sStructParentName = PREV_TOKEN_TEXT;
-		SET_INFO_FOR_KEY(pStructDefNode, "extends", sStructParentName);
+		SET_INFO_FOR_KEY(pStructDefNode, ASTInfo::EXTENDS, sStructParentName);
 
 	}
 
-	if (!GrammerUtils::match("implements", OPTIONAL_)) {
+	if (!GrammerUtils::match(KeywordID_::Type::KW_IMPLEMENTS, OPTIONAL_)) {
 
 	}
 
@@ -994,9 +927,9 @@ bool TinyCReader::structInlineFunction() {
 
 	}
 
-	if (!GrammerUtils::match("inline", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_INLINE, MANDATORY_))
 		return false;
-	if (!GrammerUtils::match("virtual", OPTIONAL_)) {
+	if (!GrammerUtils::match(KeywordID_::Type::KW_VIRTUAL, OPTIONAL_)) {
 
 	}
 
@@ -1004,7 +937,7 @@ bool TinyCReader::structInlineFunction() {
 
 	}
 
-	if (!GrammerUtils::match("static", OPTIONAL_)) {
+	if (!GrammerUtils::match(KeywordID_::Type::KW_STATIC, OPTIONAL_)) {
 
 	}
 
@@ -1022,7 +955,7 @@ bool TinyCReader::structInlineFunction() {
 		NOT sOverrideOrImplementor.empty()
 		)
 	{
-		SET_INFO_FOR_KEY(pFunctionDefNode, "@Override | @Implementor", sOverrideOrImplementor);
+		SET_INFO_FOR_KEY(pFunctionDefNode, ASTInfo::ANNOTATION, sOverrideOrImplementor);	// "@Override" | "@Implementor"
 	}
 
 	return true;
@@ -1030,7 +963,7 @@ bool TinyCReader::structInlineFunction() {
 }
 
 bool TinyCReader::staticDeclaration() {
-	if (!GrammerUtils::match("static", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_STATIC, MANDATORY_))
 		return false;
 	if (staticPtr()) {
 		return true;
@@ -1073,12 +1006,12 @@ bool TinyCReader::staticPtr() {
 
 	Tree* pStaticPtrNode = makeLeaf(ASTNodeType::ASTNode_TYPESTATIC, PREV_TOKEN_TEXT);
 	{
-		GrammerUtils::m_vUserDefinedVariables.push_back(PREV_TOKEN_TEXT);
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(PREV_TOKEN_TEXT));
 
 		pStaticPtrNode->m_bIsPointerType = true;
-		SET_INFO_FOR_KEY(pStaticPtrNode, "givenName", PREV_TOKEN_TEXT);
-		SET_INFO_FOR_KEY(pStaticPtrNode, "type", sPointerType);
-		SET_INFO_FOR_KEY(pStaticPtrNode, "scope", toString(E_VARIABLESCOPE::STATIC));
+		SET_INFO_FOR_KEY(pStaticPtrNode, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
+		SET_INFO_FOR_KEY(pStaticPtrNode, ASTInfo::TYPE, sPointerType);
+		pStaticPtrNode->m_eScope = E_VARIABLESCOPE::STATIC;
 
 		m_pASTCurrentNode->addChild(pStaticPtrNode);
 		FunctionInfo::addStaticVariable(pStaticPtrNode);
@@ -1091,7 +1024,7 @@ bool TinyCReader::staticPtr() {
 }
 
 bool TinyCReader::systemFunctionDef() {
-	if (!GrammerUtils::match("SYSFUNC", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_SYSFUNC, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, MANDATORY_))
 		return false;
@@ -1140,9 +1073,39 @@ bool TinyCReader::systemFunctionDef() {
 
 }
 
+bool TinyCReader::hostDataDeclaration() {
+	if (!GrammerUtils::match(KeywordID_::Type::KW_HOSTDATA, MANDATORY_))
+		return false;
+	if (!primitiveType())
+		return false;
+
+	std::string sType = PREV_TOKEN_TEXT;
+	assert(sType == "int32_t" || sType == "float");
+
+	if (!GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, MANDATORY_))
+		return false;
+
+	Tree* pHostDataNode = makeLeaf(ASTNodeType::ASTNode_TYPEHOSTDATA, PREV_TOKEN_TEXT);
+	{
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(PREV_TOKEN_TEXT));
+
+		SET_INFO_FOR_KEY(pHostDataNode, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
+		SET_INFO_FOR_KEY(pHostDataNode, ASTInfo::TYPE, sType);
+		pHostDataNode->m_eScope = E_VARIABLESCOPE::HOST;
+
+		m_pASTCurrentNode->addChild(pHostDataNode);
+		FunctionInfo::addHostVariable(pHostDataNode);
+	}
+
+	if (!GrammerUtils::match(';', MANDATORY_))
+		return false;
+	return true;
+
+}
+
 bool TinyCReader::functionDef() {
 
-	std::string sPrevText = PREV_TOKEN_TEXT;
+	KeywordID_::Type ePrevKeyword = PREV_TOKEN_KEYWORD;
 
 	if (!GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, MANDATORY_))
 		return false;
@@ -1168,14 +1131,14 @@ bool TinyCReader::functionDef() {
 		pFunctionDefNode->m_pLeftNode = pReturnTypeNode;
 		pFunctionDefNode->m_pRightNode = pArgListNode;
 
-		if (sPrevText == "virtual")
+		if (ePrevKeyword == KeywordID_::Type::KW_VIRTUAL)
 		{
-			SET_INFO_FOR_KEY(pFunctionDefNode, "isVirtual", "virtual");
+			SET_INFO_FOR_KEY(pFunctionDefNode, ASTInfo::ISVIRTUAL, "virtual");
 		}
 
-		if (sPrevText == "static")
+		if (ePrevKeyword == KeywordID_::Type::KW_STATIC)
 		{
-			SET_INFO_FOR_KEY(pFunctionDefNode, "isStatic", "static");
+			SET_INFO_FOR_KEY(pFunctionDefNode, ASTInfo::ISSTATIC, "static");
 		}
 	}
 
@@ -1281,14 +1244,14 @@ bool TinyCReader::argumentType() {
 
 	Tree* pPrimIntNode = makeLeaf(ASTNodeType::ASTNode_TYPE, sFullyQualifiedArgName.c_str());
 	{
-		pPrimIntNode->m_sAdditionalInfo.append(sArgName);
-		SET_INFO_FOR_KEY(pPrimIntNode, "givenName", sArgName);
-		SET_INFO_FOR_KEY(pPrimIntNode, "type", sType);
-		SET_INFO_FOR_KEY(pPrimIntNode, "scope", toString(E_VARIABLESCOPE::ARGUMENT));
+		APPEND_INFO_FOR_KEY(pPrimIntNode, ASTInfo::SYMBOL, sArgName);
+		SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::GIVENNAME, sArgName);
+		SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::TYPE, sType);
+		pPrimIntNode->m_eScope = E_VARIABLESCOPE::ARGUMENT;
 		pPrimIntNode->m_bIsPointerType = bIsAPointer;
 
 		m_pASTCurrentNode->addChild(pPrimIntNode);
-		m_pASTCurrentNode->m_sAdditionalInfo.append("int32_t_");
+		APPEND_INFO_FOR_KEY(m_pASTCurrentNode, ASTInfo::SYMBOL, "int32_t_");
 	}
 
 	return true;
@@ -1335,79 +1298,83 @@ bool TinyCReader::stmt() {
 		return true;
 	}
 	else
-		if (functionCall()) {
+		if (intrinsicCall()) {
 			return true;
 		}
 		else
-			if (structMemberVariableAssignmentOrFunctionCall()) {
+			if (functionCall()) {
 				return true;
 			}
 			else
-				if (prePostFixedIncrDecr()) {
+				if (structMemberVariableAssignmentOrFunctionCall()) {
 					return true;
 				}
 				else
-					if (assignmentDerefArray()) {
+					if (prePostFixedIncrDecr()) {
 						return true;
 					}
 					else
-						if (newPtrOrArrayOrInt()) {
+						if (assignmentDerefArray()) {
 							return true;
 						}
 						else
-							if (newStructPtr()) {
+							if (newPtrOrArrayOrInt()) {
 								return true;
 							}
 							else
-								if (assignmentRHS()) {
+								if (newStructPtr()) {
 									return true;
 								}
 								else
-									if (ifelseStatement()) {
+									if (assignmentRHS()) {
 										return true;
 									}
 									else
-										if (whileStatement()) {
+										if (ifelseStatement()) {
 											return true;
 										}
 										else
-											if (forStatement()) {
+											if (whileStatement()) {
 												return true;
 											}
 											else
-												if (switchStatement()) {
+												if (forStatement()) {
 													return true;
 												}
 												else
-													if (print()) {
+													if (switchStatement()) {
 														return true;
 													}
 													else
-														if (putc()) {
+														if (print()) {
 															return true;
 														}
 														else
-															if (memSet()) {
+															if (putc()) {
 																return true;
 															}
 															else
-																if (memCpy()) {
+																if (memSet()) {
 																	return true;
 																}
 																else
-																	if (bracesstmtlist()) {
+																	if (memCpy()) {
 																		return true;
 																	}
 																	else
-																		if (returnStatement()) {
+																		if (bracesstmtlist()) {
 																			return true;
 																		}
 																		else
-																			if (freePtrStatement()) {
+																			if (returnStatement()) {
 																				return true;
 																			}
 																			else
-																				return false;
+																				if (freePtrStatement()) {
+																					return true;
+																				}
+																				else
+																					return false;
 
 	return true;
 
@@ -1436,7 +1403,7 @@ bool TinyCReader::preFixIncrDecr() {
 		Tree* pPreDecrNode = makeLeaf(ASTNodeType::ASTNode_PREDECR, sFullyQualifiedVariableName.c_str());
 		{
 			m_pASTCurrentNode->addChild(pPreDecrNode);
-			SET_INFO_FOR_KEY(pPreDecrNode, "givenName", sVariableName);
+			SET_INFO_FOR_KEY(pPreDecrNode, ASTInfo::GIVENNAME, sVariableName);
 		}
 
 		return true;
@@ -1449,7 +1416,7 @@ bool TinyCReader::preFixIncrDecr() {
 			Tree* pPreDecrNode = makeLeaf(ASTNodeType::ASTNode_PREINCR, sFullyQualifiedVariableName.c_str());
 			{
 				m_pASTCurrentNode->addChild(pPreDecrNode);
-				SET_INFO_FOR_KEY(pPreDecrNode, "givenName", sVariableName);
+				SET_INFO_FOR_KEY(pPreDecrNode, ASTInfo::GIVENNAME, sVariableName);
 			}
 
 			return true;
@@ -1469,7 +1436,7 @@ bool TinyCReader::postFixIncrDecr() {
 		Tree* pPreDecrNode = makeLeaf(ASTNodeType::ASTNode_POSTDECR, sFullyQualifiedVariableName.c_str());
 		{
 			m_pASTCurrentNode->addChild(pPreDecrNode);
-			SET_INFO_FOR_KEY(pPreDecrNode, "givenName", sVariableName);
+			SET_INFO_FOR_KEY(pPreDecrNode, ASTInfo::GIVENNAME, sVariableName);
 		}
 
 		return true;
@@ -1482,7 +1449,7 @@ bool TinyCReader::postFixIncrDecr() {
 			Tree* pPreDecrNode = makeLeaf(ASTNodeType::ASTNode_POSTINCR, sFullyQualifiedVariableName.c_str());
 			{
 				m_pASTCurrentNode->addChild(pPreDecrNode);
-				SET_INFO_FOR_KEY(pPreDecrNode, "givenName", sVariableName);
+				SET_INFO_FOR_KEY(pPreDecrNode, ASTInfo::GIVENNAME, sVariableName);
 			}
 
 			return true;
@@ -1495,7 +1462,7 @@ bool TinyCReader::postFixIncrDecr() {
 }
 
 bool TinyCReader::returnStatement() {
-	if (!GrammerUtils::match("return", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_RETURN, MANDATORY_))
 		return false;
 
 	__END_CURRENT_BLOCK__					// Sort of a hack, as this will be the last statement of the function,
@@ -1522,7 +1489,7 @@ bool TinyCReader::returnStatement() {
 
 	__END_CURRENT_BLOCK__
 
-		m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+		m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 	pReturnStmtNode->addChild(pExpressionLeftLeaf);
 
 	m_pASTCurrentNode = pTemp;
@@ -1549,8 +1516,7 @@ bool TinyCReader::systemFunctionCall() {
 		pTemp = m_pASTCurrentNode;
 		m_pASTCurrentNode = pSystemFunctionCallNode;
 
-		m_vPostFix.push_back("_START_");
-		m_vOperatorStack.push("_START_");
+		m_vOperandStack.push_back(nullptr);
 	}
 
 	if (!functionArgumentList()) {
@@ -1573,6 +1539,52 @@ bool TinyCReader::systemFunctionCall() {
 
 }
 
+bool TinyCReader::intrinsicCall() {
+	if (!intrinsicName())
+		return false;
+
+	std::string sIdentifier = PREV_TOKEN_TEXT;
+
+	if (!GrammerUtils::match('(', MANDATORY_))
+		return false;
+
+	Tree* pIntrinsicNode = makeLeaf(ASTNodeType::ASTNode_INTRINSIC, sIdentifier.c_str());
+	Tree* pTemp = nullptr;
+	{
+		m_pASTCurrentNode->addChild(pIntrinsicNode);
+
+		pTemp = m_pASTCurrentNode;
+		m_pASTCurrentNode = pIntrinsicNode;
+
+		m_vOperandStack.push_back(nullptr);
+	}
+
+	if (!functionArgumentList()) {
+	}
+	else {
+	}
+
+	if (!GrammerUtils::match(')', MANDATORY_))
+		return false;
+
+	// Clear Up Expression engine.
+	clearTopOfExpressionStack();
+
+	m_pASTCurrentNode = pTemp;
+
+	return true;
+
+}
+
+bool TinyCReader::intrinsicName() {
+
+	std::string sName = GrammerUtils::m_pToken.getText();
+	return isValidIntrinsic(sName);
+
+	return true;
+
+}
+
 bool TinyCReader::functionCall() {
 	if (!GrammerUtils::match(TokenType_::Type::TK_FUNCTIONCALL, MANDATORY_))
 		return false;
@@ -1590,8 +1602,7 @@ bool TinyCReader::functionCall() {
 		pTemp = m_pASTCurrentNode;
 		m_pASTCurrentNode = pFunctionCallNode;
 
-		m_vPostFix.push_back("_START_");
-		m_vOperatorStack.push("_START_");
+		m_vOperandStack.push_back(nullptr);
 	}
 
 	if (!functionArgumentList()) {
@@ -1632,7 +1643,7 @@ bool TinyCReader::functionArgumentItem() {
 		Tree* pStringNode = makeLeaf(ASTNodeType::ASTNode_STRING, PREV_TOKEN_TEXT);
 		{
 			m_pASTCurrentNode->addChild(pStringNode);
-			m_pASTCurrentNode->m_sAdditionalInfo.append("string_");
+			APPEND_INFO_FOR_KEY(m_pASTCurrentNode, ASTInfo::SYMBOL, "string_");
 		}
 
 		if (!GrammerUtils::match(',', OPTIONAL_)) {
@@ -1648,12 +1659,12 @@ bool TinyCReader::functionArgumentItem() {
 	else
 		if (expr()) {
 
-			Tree* pExpressionLeftLeaf = createPostFixExpr();
+			Tree* pExpressionLeftLeaf = createExpressionLeaf();
 			{
 				m_pASTCurrentNode->addChild(pExpressionLeftLeaf);
 				pExpressionLeftLeaf->m_pParentNode = m_pASTCurrentNode;
 
-				m_pASTCurrentNode->m_sAdditionalInfo.append("int32_t_");
+				APPEND_INFO_FOR_KEY(m_pASTCurrentNode, ASTInfo::SYMBOL, "int32_t_");
 			}
 
 			if (!GrammerUtils::match(',', OPTIONAL_)) {
@@ -1681,7 +1692,7 @@ bool TinyCReader::ifelseStatement() {
 }
 
 bool TinyCReader::ifStatement() {
-	if (!GrammerUtils::match("if", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_IF, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -1706,7 +1717,7 @@ bool TinyCReader::ifStatement() {
 	if (!expr())
 		return false;
 
-	m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+	m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 	m_pASTCurrentNode = pIfNode;
 	__CURRENT_BLOCK_NODE__(m_pASTCurrentNode)
 
@@ -1736,7 +1747,7 @@ bool TinyCReader::ifStatement() {
 }
 
 bool TinyCReader::elseStatement() {
-	if (!GrammerUtils::match("else", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_ELSE, MANDATORY_))
 		return false;
 
 	__START_BLOCK_STRING__("else")
@@ -1771,7 +1782,7 @@ bool TinyCReader::elseStatement() {
 }
 
 bool TinyCReader::whileStatement() {
-	if (!GrammerUtils::match("while", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_WHILE, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -1796,7 +1807,7 @@ bool TinyCReader::whileStatement() {
 	if (!expr())
 		return false;
 
-	m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+	m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 	m_pASTCurrentNode = pWhileNode;
 	__CURRENT_BLOCK_NODE__(m_pASTCurrentNode)
 
@@ -1832,7 +1843,7 @@ bool TinyCReader::whileStatement() {
 }
 
 bool TinyCReader::switchStatement() {
-	if (!GrammerUtils::match("switch", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_SWITCH, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -1877,7 +1888,7 @@ bool TinyCReader::switchArgument() {
 
 		Tree* pSwitchArgumentNode = makeLeaf(ASTNodeType::ASTNode_IDENTIFIER, sFullyQualifiedVariableName.c_str());
 		m_pASTCurrentNode->m_pLeftNode = pSwitchArgumentNode;
-		SET_INFO_FOR_KEY(pSwitchArgumentNode, "givenName", PREV_TOKEN_TEXT);
+		SET_INFO_FOR_KEY(pSwitchArgumentNode, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
 
 		return true;
 	}
@@ -1924,7 +1935,7 @@ bool TinyCReader::oneOrMoreSwitchCases() {
 }
 
 bool TinyCReader::switchCase() {
-	if (!GrammerUtils::match("case", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_CASE, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match(TokenType_::Type::TK_INTEGER, MANDATORY_))
 		return false;
@@ -1960,7 +1971,7 @@ bool TinyCReader::switchCase() {
 
 	}
 
-	if (!GrammerUtils::match("break", OPTIONAL_)) {
+	if (!GrammerUtils::match(KeywordID_::Type::KW_BREAK, OPTIONAL_)) {
 
 	}
 
@@ -1985,7 +1996,7 @@ bool TinyCReader::switchCase() {
 }
 
 bool TinyCReader::defaultCase() {
-	if (!GrammerUtils::match("default", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_DEFAULT, MANDATORY_))
 		return false;
 
 	__START_BLOCK_STRING__("switchcase")
@@ -2025,7 +2036,7 @@ bool TinyCReader::defaultCase() {
 
 		m_pASTCurrentNode = pTemp;
 
-	if (!GrammerUtils::match("break", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_BREAK, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match(';', MANDATORY_))
 		return false;
@@ -2034,7 +2045,7 @@ bool TinyCReader::defaultCase() {
 }
 
 bool TinyCReader::forStatement() {
-	if (!GrammerUtils::match("for", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_FOR, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -2087,7 +2098,7 @@ bool TinyCReader::forStatement() {
 		if (!expr())
 			return false;
 
-		m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+		m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 
 		if (!GrammerUtils::match(';', MANDATORY_))
 			return false;
@@ -2208,7 +2219,7 @@ bool TinyCReader::loopExpr() {
 }
 
 bool TinyCReader::print() {
-	if (!GrammerUtils::match("print", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_PRINT, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -2266,7 +2277,7 @@ bool TinyCReader::print_list_0() {
 	else
 		if (expr()) {
 
-			Tree* pExpressionLeftLeaf = createPostFixExpr();
+			Tree* pExpressionLeftLeaf = createExpressionLeaf();
 			{
 				m_pASTCurrentNode->addChild(pExpressionLeftLeaf);
 				pExpressionLeftLeaf->m_pParentNode = m_pASTCurrentNode;
@@ -2300,7 +2311,7 @@ bool TinyCReader::print_list_0() {
 }
 
 bool TinyCReader::putc() {
-	if (!GrammerUtils::match("putc", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_PUTC, MANDATORY_))
 		return false;
 
 	Tree* pPutCNode = makeLeaf(ASTNodeType::ASTNode_PUTC, PREV_TOKEN_TEXT);
@@ -2326,7 +2337,7 @@ bool TinyCReader::putc() {
 }
 
 bool TinyCReader::memSet() {
-	if (!GrammerUtils::match("memSet", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_MEMSET, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -2341,7 +2352,7 @@ bool TinyCReader::memSet() {
 	std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sIdentifier.c_str());
 	assert(!sFullyQualifiedVariableName.empty());
 
-	SET_INFO_FOR_KEY(pAST_MemSet, "src", sFullyQualifiedVariableName);
+	SET_INFO_FOR_KEY(pAST_MemSet, ASTInfo::SRC, sFullyQualifiedVariableName);
 
 	Tree* pExpressionMemSetValueLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
 	{
@@ -2354,7 +2365,7 @@ bool TinyCReader::memSet() {
 	if (!expr())
 		return false;
 
-	pExpressionMemSetValueLeaf = createPostFixExpr(m_pASTCurrentNode);
+	pExpressionMemSetValueLeaf = createExpressionLeaf(m_pASTCurrentNode);
 	pAST_MemSet->m_pLeftNode = pExpressionMemSetValueLeaf;
 
 	Tree* pExpressionMemSetSizeLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
@@ -2367,7 +2378,7 @@ bool TinyCReader::memSet() {
 	if (!expr())
 		return false;
 
-	pExpressionMemSetSizeLeaf = createPostFixExpr(m_pASTCurrentNode);
+	pExpressionMemSetSizeLeaf = createExpressionLeaf(m_pASTCurrentNode);
 	pAST_MemSet->m_pRightNode = pExpressionMemSetSizeLeaf;
 
 	if (!GrammerUtils::match(')', MANDATORY_))
@@ -2381,7 +2392,7 @@ bool TinyCReader::memSet() {
 }
 
 bool TinyCReader::memCpy() {
-	if (!GrammerUtils::match("memCpy", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_MEMCPY, MANDATORY_))
 		return false;
 
 	Tree* pAST_MemCpy = makeLeaf(ASTNodeType::ASTNode_MEMCPY, "");
@@ -2395,7 +2406,7 @@ bool TinyCReader::memCpy() {
 	std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sIdentifier.c_str());
 	assert(!sFullyQualifiedVariableName.empty());
 
-	SET_INFO_FOR_KEY(pAST_MemCpy, "src", sFullyQualifiedVariableName);
+	SET_INFO_FOR_KEY(pAST_MemCpy, ASTInfo::SRC, sFullyQualifiedVariableName);
 
 	if (!GrammerUtils::match(',', MANDATORY_))
 		return false;
@@ -2406,7 +2417,7 @@ bool TinyCReader::memCpy() {
 	sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sIdentifier.c_str());
 	assert(!sFullyQualifiedVariableName.empty());
 
-	SET_INFO_FOR_KEY(pAST_MemCpy, "dst", sFullyQualifiedVariableName);
+	SET_INFO_FOR_KEY(pAST_MemCpy, ASTInfo::DST, sFullyQualifiedVariableName);
 
 	Tree* pSizeExpressionLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
 	Tree* pTemp;
@@ -2420,7 +2431,7 @@ bool TinyCReader::memCpy() {
 	if (!expr())
 		return false;
 
-	pSizeExpressionLeaf = createPostFixExpr(m_pASTCurrentNode);
+	pSizeExpressionLeaf = createExpressionLeaf(m_pASTCurrentNode);
 	pAST_MemCpy->m_pRightNode = pSizeExpressionLeaf;
 
 	if (!GrammerUtils::match(')', MANDATORY_))
@@ -2434,7 +2445,7 @@ bool TinyCReader::memCpy() {
 }
 
 bool TinyCReader::memCmp() {
-	if (!GrammerUtils::match("memCmp", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_MEMCMP, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -2448,7 +2459,7 @@ bool TinyCReader::memCmp() {
 	std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sIdentifier.c_str());
 	assert(!sFullyQualifiedVariableName.empty());
 
-	SET_INFO_FOR_KEY(pAST_MemCmp, "src", sFullyQualifiedVariableName);
+	SET_INFO_FOR_KEY(pAST_MemCmp, ASTInfo::SRC, sFullyQualifiedVariableName);
 
 	if (!GrammerUtils::match(',', MANDATORY_))
 		return false;
@@ -2459,7 +2470,7 @@ bool TinyCReader::memCmp() {
 	sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sIdentifier.c_str());
 	assert(!sFullyQualifiedVariableName.empty());
 
-	SET_INFO_FOR_KEY(pAST_MemCmp, "dst", sFullyQualifiedVariableName);
+	SET_INFO_FOR_KEY(pAST_MemCmp, ASTInfo::DST, sFullyQualifiedVariableName);
 
 	Tree* pSizeExpressionLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
 	Tree* pTemp;
@@ -2473,7 +2484,7 @@ bool TinyCReader::memCmp() {
 	if (!expr())
 		return false;
 
-	pSizeExpressionLeaf = createPostFixExpr(m_pASTCurrentNode);
+	pSizeExpressionLeaf = createExpressionLeaf(m_pASTCurrentNode);
 	pAST_MemCmp->m_pRightNode = pSizeExpressionLeaf;
 
 	if (!GrammerUtils::match(')', MANDATORY_))
@@ -2487,7 +2498,7 @@ bool TinyCReader::memCmp() {
 }
 
 bool TinyCReader::memChr() {
-	if (!GrammerUtils::match("memChr", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_MEMCHR, MANDATORY_))
 		return false;
 
 	Tree* pAST_MemChr = makeLeaf(ASTNodeType::ASTNode_MEMCHR, "");
@@ -2501,7 +2512,7 @@ bool TinyCReader::memChr() {
 	std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sIdentifier.c_str());
 	assert(!sFullyQualifiedVariableName.empty());
 
-	SET_INFO_FOR_KEY(pAST_MemChr, "src", sFullyQualifiedVariableName);
+	SET_INFO_FOR_KEY(pAST_MemChr, ASTInfo::SRC, sFullyQualifiedVariableName);
 
 	Tree* pExpressionMemValueLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
 	Tree* pTemp;
@@ -2517,7 +2528,7 @@ bool TinyCReader::memChr() {
 	if (!expr())
 		return false;
 
-	pExpressionMemValueLeaf = createPostFixExpr(m_pASTCurrentNode);
+	pExpressionMemValueLeaf = createExpressionLeaf(m_pASTCurrentNode);
 
 	Tree* pExpressionMemSizeLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
 	{
@@ -2530,7 +2541,7 @@ bool TinyCReader::memChr() {
 	if (!expr())
 		return false;
 
-	pExpressionMemSizeLeaf = createPostFixExpr(m_pASTCurrentNode);
+	pExpressionMemSizeLeaf = createExpressionLeaf(m_pASTCurrentNode);
 
 	if (!GrammerUtils::match(')', MANDATORY_))
 		return false;
@@ -2543,7 +2554,7 @@ bool TinyCReader::memChr() {
 }
 
 bool TinyCReader::sizeOf() {
-	if (!GrammerUtils::match("sizeOf", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_SIZEOF, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -2573,7 +2584,7 @@ bool TinyCReader::putcList() {
 
 		Tree* pIdentifierNode = makeLeaf(ASTNodeType::ASTNode_IDENTIFIER, sFullyQualifiedVariableName.c_str());
 		m_pASTCurrentNode->addChild(pIdentifierNode);
-		SET_INFO_FOR_KEY(pIdentifierNode, "givenName", PREV_TOKEN_TEXT);
+		SET_INFO_FOR_KEY(pIdentifierNode, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
 
 		return true;
 	}
@@ -2648,14 +2659,14 @@ bool TinyCReader::newStructPtr() {
 	Tree* pStructPtrNode = makeLeaf(ASTNodeType::ASTNode_TYPESTRUCT, sFullyQualifiedVariableName.c_str());
 	Tree* pTemp = nullptr;
 	{
-		GrammerUtils::m_vUserDefinedVariables.push_back(sFullyQualifiedVariableName);
-		GrammerUtils::m_vUserDefinedVariables.push_back(sVariableName);
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sFullyQualifiedVariableName));
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sVariableName));
 
-		pStructPtrNode->m_sAdditionalInfo.append(sVariableName);
+		APPEND_INFO_FOR_KEY(pStructPtrNode, ASTInfo::SYMBOL, sVariableName);
 		pStructPtrNode->m_bIsPointerType = true;
-		SET_INFO_FOR_KEY(pStructPtrNode, "givenName", sVariableName);
-		SET_INFO_FOR_KEY(pStructPtrNode, "type", sStructType);
-		SET_INFO_FOR_KEY(pStructPtrNode, "scope", getCurrentScopeString());
+		SET_INFO_FOR_KEY(pStructPtrNode, ASTInfo::GIVENNAME, sVariableName);
+		SET_INFO_FOR_KEY(pStructPtrNode, ASTInfo::TYPE, sStructType);
+		pStructPtrNode->m_eScope = getCurrentScope();
 		pStructPtrNode->m_pParentNode = m_pASTCurrentNode;
 
 		pTemp = m_pASTCurrentNode;
@@ -2668,7 +2679,7 @@ bool TinyCReader::newStructPtr() {
 
 	else {
 
-		if (!GrammerUtils::match("new", MANDATORY_))
+		if (!GrammerUtils::match(KeywordID_::Type::KW_NEW, MANDATORY_))
 			return false;
 		if (!functionCall())
 			return false;
@@ -2689,7 +2700,7 @@ bool TinyCReader::newStructPtr() {
 			pushLocalHeapVar(sFullyQualifiedVariableName);
 	}
 
-	SET_INFO_FOR_KEY(pFunctionCallNode, "memberFunctionOf", sStructType);
+	SET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::MEMBERFUNCTIONOF, sStructType);
 
 	m_pASTCurrentNode = pTemp;
 	m_pASTCurrentNode->addChild(pStructPtrNode);
@@ -2755,14 +2766,14 @@ bool TinyCReader::primPtr() {
 	{
 		pTemp = m_pASTCurrentNode;
 
-		GrammerUtils::m_vUserDefinedVariables.push_back(sFullyQualifiedVariableName);
-		GrammerUtils::m_vUserDefinedVariables.push_back(sVariableName);
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sFullyQualifiedVariableName));
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sVariableName));
 
-		pPrimPtrNode->m_sAdditionalInfo.append(sVariableName);
+		APPEND_INFO_FOR_KEY(pPrimPtrNode, ASTInfo::SYMBOL, sVariableName);
 		pPrimPtrNode->m_bIsPointerType = true;
-		SET_INFO_FOR_KEY(pPrimPtrNode, "givenName", sVariableName);
-		SET_INFO_FOR_KEY(pPrimPtrNode, "type", sPointerType);
-		SET_INFO_FOR_KEY(pPrimPtrNode, "scope", getCurrentScopeString());
+		SET_INFO_FOR_KEY(pPrimPtrNode, ASTInfo::GIVENNAME, sVariableName);
+		SET_INFO_FOR_KEY(pPrimPtrNode, ASTInfo::TYPE, sPointerType);
+		pPrimPtrNode->m_eScope = getCurrentScope();
 		pPrimPtrNode->m_pParentNode = m_pASTCurrentNode;
 
 		m_pASTCurrentNode = pPrimPtrNode;
@@ -2828,14 +2839,14 @@ bool TinyCReader::primArray() {
 	{
 		pTemp = m_pASTCurrentNode;
 
-		GrammerUtils::m_vUserDefinedVariables.push_back(sFullyQualifiedVariableName);
-		GrammerUtils::m_vUserDefinedVariables.push_back(sVariableName);
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sFullyQualifiedVariableName));
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sVariableName));
 
-		pPrimTypeArrayNode->m_sAdditionalInfo.append(sVariableName);
+		APPEND_INFO_FOR_KEY(pPrimTypeArrayNode, ASTInfo::SYMBOL, sVariableName);
 		pPrimTypeArrayNode->m_bIsPointerType = true;
-		SET_INFO_FOR_KEY(pPrimTypeArrayNode, "givenName", sVariableName);
-		SET_INFO_FOR_KEY(pPrimTypeArrayNode, "type", sPrimitiveType);
-		SET_INFO_FOR_KEY(pPrimTypeArrayNode, "scope", getCurrentScopeString());
+		SET_INFO_FOR_KEY(pPrimTypeArrayNode, ASTInfo::GIVENNAME, sVariableName);
+		SET_INFO_FOR_KEY(pPrimTypeArrayNode, ASTInfo::TYPE, sPrimitiveType);
+		pPrimTypeArrayNode->m_eScope = getCurrentScope();
 		pPrimTypeArrayNode->m_pParentNode = m_pASTCurrentNode;
 	}
 
@@ -2895,7 +2906,7 @@ bool TinyCReader::primArrayOptionalRHS() {
 
 		if (expr()) {
 
-			m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+			m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 			pArrayElementsLeaf->addChild(pExpressionArrayElementLeaf);
 
 			if (!GrammerUtils::match(',', OPTIONAL_)) {
@@ -2934,13 +2945,13 @@ bool TinyCReader::primType() {
 	{
 		pTemp = m_pASTCurrentNode;
 
-		GrammerUtils::m_vUserDefinedVariables.push_back(sFullyQualifiedVariableName);
-		GrammerUtils::m_vUserDefinedVariables.push_back(sVariableName);
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sFullyQualifiedVariableName));
+		GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sVariableName));
 
-		pPrimIntNode->m_sAdditionalInfo.append(sVariableName);
-		SET_INFO_FOR_KEY(pPrimIntNode, "givenName", sVariableName);
-		SET_INFO_FOR_KEY(pPrimIntNode, "type", sPrimitiveType);
-		SET_INFO_FOR_KEY(pPrimIntNode, "scope", getCurrentScopeString());
+		APPEND_INFO_FOR_KEY(pPrimIntNode, ASTInfo::SYMBOL, sVariableName);
+		SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::GIVENNAME, sVariableName);
+		SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::TYPE, sPrimitiveType);
+		pPrimIntNode->m_eScope = getCurrentScope();
 
 		pPrimIntNode->m_pParentNode = m_pASTCurrentNode;
 		m_pASTCurrentNode = pPrimIntNode;
@@ -2974,7 +2985,7 @@ bool TinyCReader::primTypeOptionalRHS() {
 	if (!expr())
 		return false;
 
-	m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+	m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 
 	return true;
 
@@ -2996,7 +3007,7 @@ bool TinyCReader::ptrAssign() {
 }
 
 bool TinyCReader::malloc() {
-	if (!GrammerUtils::match("malloc", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_MALLOC, MANDATORY_))
 		return false;
 
 	Tree* pMallocNode = makeLeaf(ASTNodeType::ASTNode_MALLOC, "");
@@ -3020,7 +3031,7 @@ bool TinyCReader::malloc() {
 	if (!expr())
 		return false;
 
-	m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+	m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 
 	m_pASTCurrentNode = pTemp;
 	m_pASTCurrentNode->addChild(pMallocNode);
@@ -3044,14 +3055,14 @@ bool TinyCReader::assignmentDerefArray() {
 	Tree* pAssignmentNode = makeLeaf(ASTNodeType::ASTNode_ASSIGN, sFullyQualifiedVariableName.c_str());
 	{
 		pAssignmentNode->m_pParentNode = m_pASTCurrentNode;
-		SET_INFO_FOR_KEY(pAssignmentNode, "givenName", sVariableName);
+		SET_INFO_FOR_KEY(pAssignmentNode, ASTInfo::GIVENNAME, sVariableName);
 	}
 
 	Tree* pIdentifierLeaf = makeLeaf(ASTNodeType::ASTNode_DEREFARRAY, sFullyQualifiedVariableName.c_str());
 	Tree* pArrayIndexExpressionLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
 	{
-		pIdentifierLeaf->m_sAdditionalInfo = sVariableName;
-		SET_INFO_FOR_KEY(pIdentifierLeaf, "givenName", sVariableName);
+		SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::SYMBOL, sVariableName);
+		SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::GIVENNAME, sVariableName);
 
 		pAssignmentNode->m_pRightNode = pIdentifierLeaf;
 		pIdentifierLeaf->m_pParentNode = pAssignmentNode;
@@ -3069,7 +3080,7 @@ bool TinyCReader::assignmentDerefArray() {
 	if (!expr())
 		return false;
 
-	pArrayIndexExpressionLeaf = createPostFixExpr(pArrayIndexExpressionLeaf);
+	pArrayIndexExpressionLeaf = createExpressionLeaf(pArrayIndexExpressionLeaf);
 	pIdentifierLeaf->addChild(pArrayIndexExpressionLeaf);
 
 	if (!GrammerUtils::match(']', MANDATORY_))
@@ -3088,7 +3099,7 @@ bool TinyCReader::assignmentDerefArray() {
 	if (!expr())
 		return false;
 
-	m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+	m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 
 	m_pASTCurrentNode = pTemp;
 	m_pASTCurrentNode->addChild(pAssignmentNode);
@@ -3163,20 +3174,20 @@ bool TinyCReader::structMemberVariableLValueOrFunctionCall() {
 			sFullyQualifiedObjectName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sObjectName.c_str());
 
 		pAssignmentNode = makeLeaf(ASTNodeType::ASTNode_ASSIGN, sFullyQualifiedObjectName.c_str());
-		SET_INFO_FOR_KEY(pAssignmentNode, "accessType", "object");
+		SET_INFO_FOR_KEY(pAssignmentNode, ASTInfo::ACCESSTYPE, "object");
 	}
 	break;
 	case TokenType_::Type::TK_STATICMEMBERACCESS:
 	{
 		pAssignmentNode = makeLeaf(ASTNodeType::ASTNode_ASSIGN, sObjectName.c_str());
-		SET_INFO_FOR_KEY(pAssignmentNode, "accessType", "static");
+		SET_INFO_FOR_KEY(pAssignmentNode, ASTInfo::ACCESSTYPE, "static");
 	}
 	break;
 	}
 
 	{
 		pAssignmentNode->m_pParentNode = m_pASTCurrentNode;
-		SET_INFO_FOR_KEY(pAssignmentNode, "givenName", sObjectName);
+		SET_INFO_FOR_KEY(pAssignmentNode, ASTInfo::GIVENNAME, sObjectName);
 
 		pTemp = m_pASTCurrentNode;
 		m_pASTCurrentNode = pAssignmentNode;
@@ -3204,7 +3215,7 @@ bool TinyCReader::structMemberVariableLValueOrFunctionCall() {
 		if (!expr())
 			return false;
 
-		m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+		m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 
 	}
 
@@ -3228,8 +3239,8 @@ bool TinyCReader::structVariableLValueOrArrayLValueOrFunctionCall() {
 
 			Tree* pIdentifierLeaf = makeLeaf(ASTNodeType::ASTNode_MEMBERACCESS, PREV_TOKEN_TEXT);
 			{
-				pIdentifierLeaf->m_sAdditionalInfo = PREV_TOKEN_TEXT;
-				SET_INFO_FOR_KEY(pIdentifierLeaf, "givenName", PREV_TOKEN_TEXT);
+				SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::SYMBOL, PREV_TOKEN_TEXT);
+				SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
 				m_pASTCurrentNode->m_pRightNode = pIdentifierLeaf;
 			}
 
@@ -3253,23 +3264,19 @@ bool TinyCReader::structMemberVariableLValueArrayAccess() {
 	Tree* pIdentifierLeaf = makeLeaf(ASTNodeType::ASTNode_MEMBERACCESSDEREF, PREV_TOKEN_TEXT);
 	Tree* pArrayIndexExpressionLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
 	{
-		pIdentifierLeaf->m_sAdditionalInfo = PREV_TOKEN_TEXT;
-		SET_INFO_FOR_KEY(pIdentifierLeaf, "givenName", PREV_TOKEN_TEXT);
+		SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::SYMBOL, PREV_TOKEN_TEXT);
+		SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
 		m_pASTCurrentNode->m_pRightNode = pIdentifierLeaf;
 	}
 
 	if (!GrammerUtils::match('[', MANDATORY_))
 		return false;
 
-	checkOpPrecedenceAndPush("(");
-
 	if (!expr())
 		return false;
 
-	checkOpPrecedenceAndPush(")");
 
-
-	pArrayIndexExpressionLeaf = createPostFixExpr(pArrayIndexExpressionLeaf);
+	pArrayIndexExpressionLeaf = createExpressionLeaf(pArrayIndexExpressionLeaf);
 	pIdentifierLeaf->m_pLeftNode = pArrayIndexExpressionLeaf;
 
 	if (!GrammerUtils::match(']', MANDATORY_))
@@ -3289,13 +3296,13 @@ bool TinyCReader::assignmentRHS() {
 	Tree* pAssignmentNode = makeLeaf(ASTNodeType::ASTNode_ASSIGN, sFullyQualifiedVariableName.c_str());
 	{
 		pAssignmentNode->m_pParentNode = m_pASTCurrentNode;
-		SET_INFO_FOR_KEY(pAssignmentNode, "givenName", sVariableName);
+		SET_INFO_FOR_KEY(pAssignmentNode, ASTInfo::GIVENNAME, sVariableName);
 	}
 
 	Tree* pIdentifierLeaf = makeLeaf(ASTNodeType::ASTNode_IDENTIFIER, sFullyQualifiedVariableName.c_str());
 	{
-		pIdentifierLeaf->m_sAdditionalInfo = sVariableName;
-		SET_INFO_FOR_KEY(pIdentifierLeaf, "givenName", sVariableName);
+		SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::SYMBOL, sVariableName);
+		SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::GIVENNAME, sVariableName);
 
 		pAssignmentNode->m_pRightNode = pIdentifierLeaf;
 	}
@@ -3313,19 +3320,19 @@ bool TinyCReader::assignmentRHS() {
 		m_pASTCurrentNode = pRValueExpressionLeftLeaf;
 	}
 
-	if (GrammerUtils::match("new", OPTIONAL_)) {
+	if (GrammerUtils::match(KeywordID_::Type::KW_NEW, OPTIONAL_)) {
 
 		// Since this will be a 'struct' constructor call, change its type to 'ASTNode_TYPESTRUCT'
 		// & make all necessary changes that suit 'ASTNode_TYPESTRUCT'
 
 		pAssignmentNode->m_eASTNodeType = ASTNodeType::ASTNode_TYPESTRUCT;
-		pAssignmentNode->m_pLeftNode = nullptr; delete pRValueExpressionLeftLeaf; 	// No need for these, hence remove & delete.
-		pAssignmentNode->m_pRightNode = nullptr; delete pIdentifierLeaf;			// No need for these, hence remove & delete.
+		pAssignmentNode->m_pLeftNode = nullptr;		// No need for these, hence remove. The TreeArena frees them.
+		pAssignmentNode->m_pRightNode = nullptr;
 
-		pAssignmentNode->m_sAdditionalInfo.append(sVariableName);
+		APPEND_INFO_FOR_KEY(pAssignmentNode, ASTInfo::SYMBOL, sVariableName);
 		pAssignmentNode->m_bIsPointerType = true;
-		SET_INFO_FOR_KEY(pAssignmentNode, "givenName", sVariableName);
-		SET_INFO_FOR_KEY(pAssignmentNode, "scope", getCurrentScopeString());
+		SET_INFO_FOR_KEY(pAssignmentNode, ASTInfo::GIVENNAME, sVariableName);
+		pAssignmentNode->m_eScope = getCurrentScope();
 
 		m_pASTCurrentNode = pAssignmentNode;
 
@@ -3337,9 +3344,9 @@ bool TinyCReader::assignmentRHS() {
 
 		Tree* pFunctionCallNode = m_pASTCurrentNode->m_vStatements[0];
 		{
-			std::string sStructType = GET_INFO_FOR_KEY(pFunctionCallNode, "text");
-			SET_INFO_FOR_KEY(pFunctionCallNode, "memberFunctionOf", sStructType);
-			SET_INFO_FOR_KEY(pAssignmentNode, "type", sStructType);
+			std::string sStructType = GET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::TEXT);
+			SET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::MEMBERFUNCTIONOF, sStructType);
+			SET_INFO_FOR_KEY(pAssignmentNode, ASTInfo::TYPE, sStructType);
 		}
 
 		m_pASTCurrentNode = pTemp;
@@ -3350,7 +3357,7 @@ bool TinyCReader::assignmentRHS() {
 	else
 		if (expr()) {
 
-			m_pASTCurrentNode = createPostFixExpr(m_pASTCurrentNode);
+			m_pASTCurrentNode = createExpressionLeaf(m_pASTCurrentNode);
 
 			m_pASTCurrentNode = pTemp;
 			m_pASTCurrentNode->addChild(pAssignmentNode);
@@ -3365,7 +3372,7 @@ bool TinyCReader::assignmentRHS() {
 }
 
 bool TinyCReader::freePtrStatement() {
-	if (!GrammerUtils::match("free", MANDATORY_))
+	if (!GrammerUtils::match(KeywordID_::Type::KW_FREE, MANDATORY_))
 		return false;
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
@@ -3376,7 +3383,7 @@ bool TinyCReader::freePtrStatement() {
 	assert(!sFullyQualifiedVariableName.empty());
 
 	Tree* pFreePtrLeaf = makeLeaf(ASTNodeType::ASTNode_FREE, sFullyQualifiedVariableName.c_str());
-	SET_INFO_FOR_KEY(pFreePtrLeaf, "givenName", PREV_TOKEN_TEXT);
+	SET_INFO_FOR_KEY(pFreePtrLeaf, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
 
 	m_pASTCurrentNode->addChild(pFreePtrLeaf);
 
@@ -3402,307 +3409,8 @@ bool TinyCReader::expr() {
 }
 
 bool TinyCReader::startExpr() {
-	if (!equalityExpr())
-		return false;
-	while (true) {
-		if (logicalAndOrExpr()) {
-		}
-		else
-			break;
-	}
-
-	return true;
-
-}
-
-bool TinyCReader::logicalAndOrExpr() {
-	if (!logicalAndOr())
-		return false;
-	if (!equalityExpr())
-		return false;
-	return true;
-
-}
-
-bool TinyCReader::logicalAndOr() {
-	if (GrammerUtils::match("&&", OPTIONAL_)) {
-
-		checkOpPrecedenceAndPush("&&");
-
-		return true;
-	}
-	else
-		if (GrammerUtils::match("||", OPTIONAL_)) {
-
-			checkOpPrecedenceAndPush("||");
-
-			return true;
-		}
-		else
-			return false;
-
-	return true;
-
-}
-
-bool TinyCReader::equalityExpr() {
-	if (!relationalExpr())
-		return false;
-	while (true) {
-		if (eqNeqExpr()) {
-		}
-		else
-			break;
-	}
-
-	return true;
-
-}
-
-bool TinyCReader::eqNeqExpr() {
-	if (!eqNeq())
-		return false;
-	if (!relationalExpr())
-		return false;
-	return true;
-
-}
-
-bool TinyCReader::eqNeq() {
-	if (GrammerUtils::match("==", OPTIONAL_)) {
-
-		checkOpPrecedenceAndPush("==");
-
-		return true;
-	}
-	else
-		if (GrammerUtils::match("!=", OPTIONAL_)) {
-
-			checkOpPrecedenceAndPush("!=");
-
-			return true;
-		}
-		else
-			return false;
-
-	return true;
-
-}
-
-bool TinyCReader::relationalExpr() {
-	if (!addSubExpr())
-		return false;
-	while (true) {
-		if (lteqGteqExpr()) {
-		}
-		else
-			break;
-	}
-
-	return true;
-
-}
-
-bool TinyCReader::lteqGteqExpr() {
-	if (!lteqGteq())
-		return false;
-	if (!addSubExpr())
-		return false;
-	return true;
-
-}
-
-bool TinyCReader::lteqGteq() {
-	if (GrammerUtils::match('<', OPTIONAL_)) {
-
-		checkOpPrecedenceAndPush("<");
-
-		return true;
-	}
-	else
-		if (GrammerUtils::match("<=", OPTIONAL_)) {
-
-			checkOpPrecedenceAndPush("<=");
-
-			return true;
-		}
-		else
-			if (GrammerUtils::match('>', OPTIONAL_)) {
-
-				checkOpPrecedenceAndPush(">");
-
-				return true;
-			}
-			else
-				if (GrammerUtils::match(">=", OPTIONAL_)) {
-
-					checkOpPrecedenceAndPush(">=");
-
-					return true;
-				}
-				else
-					return false;
-
-	return true;
-
-}
-
-bool TinyCReader::addSubExpr() {
-	if (!mulDivExpr())
+	if (!parseExpression(ENUM_OP_PRECEDENCE::OP_INVALID))
 		return false;
-	while (true) {
-		if (plusMinusExpr()) {
-		}
-		else
-			break;
-	}
-
-	return true;
-
-}
-
-bool TinyCReader::plusMinusExpr() {
-	if (!plusMinus())
-		return false;
-	if (!mulDivExpr())
-		return false;
-	return true;
-
-}
-
-bool TinyCReader::plusMinus() {
-	if (GrammerUtils::match('+', OPTIONAL_)) {
-
-		checkOpPrecedenceAndPush("+");
-
-		return true;
-	}
-	else
-		if (GrammerUtils::match('-', OPTIONAL_)) {
-
-			checkOpPrecedenceAndPush("-");
-
-			return true;
-		}
-		else
-			return false;
-
-	return true;
-
-}
-
-bool TinyCReader::mulDivExpr() {
-	if (!bitwiseExpr())
-		return false;
-	while (true) {
-		if (mulDivModExpr()) {
-		}
-		else
-			break;
-	}
-
-	return true;
-
-}
-
-bool TinyCReader::mulDivModExpr() {
-	if (!mulDivMod())
-		return false;
-	if (!bitwiseExpr())
-		return false;
-	return true;
-
-}
-
-bool TinyCReader::mulDivMod() {
-	if (GrammerUtils::match('*', OPTIONAL_)) {
-
-		checkOpPrecedenceAndPush("*");
-
-		return true;
-	}
-	else
-		if (GrammerUtils::match('/', OPTIONAL_)) {
-
-			checkOpPrecedenceAndPush("/");
-
-			return true;
-		}
-		else
-			if (GrammerUtils::match('%', OPTIONAL_)) {
-
-				checkOpPrecedenceAndPush("%");
-
-				return true;
-			}
-			else
-				return false;
-
-	return true;
-
-}
-
-bool TinyCReader::bitwiseExpr() {
-	if (!primary())
-		return false;
-	while (true) {
-		if (bitwiseOrAndXorExpr()) {
-		}
-		else
-			break;
-	}
-
-	return true;
-
-}
-
-bool TinyCReader::bitwiseOrAndXorExpr() {
-	if (!bitwiseOrAndXor())
-		return false;
-	if (!primary())
-		return false;
-	return true;
-
-}
-
-bool TinyCReader::bitwiseOrAndXor() {
-	if (GrammerUtils::match('&', OPTIONAL_)) {
-
-		checkOpPrecedenceAndPush("&");
-
-		return true;
-	}
-	else
-		if (GrammerUtils::match('|', OPTIONAL_)) {
-
-			checkOpPrecedenceAndPush("|");
-
-			return true;
-		}
-		else
-			if (GrammerUtils::match('^', OPTIONAL_)) {
-
-				checkOpPrecedenceAndPush("^");
-
-				return true;
-			}
-			else
-				if (GrammerUtils::match("<<", OPTIONAL_)) {
-
-					checkOpPrecedenceAndPush("<<");
-
-					return true;
-				}
-				else
-					if (GrammerUtils::match(">>", OPTIONAL_)) {
-
-						checkOpPrecedenceAndPush(">>");
-
-						return true;
-					}
-					else
-						return false;
-
 	return true;
 
 }
@@ -3737,63 +3445,70 @@ bool TinyCReader::operands() {
 		return true;
 	}
 	else
-		if (functionCall()) {
+		if (intrinsicCall()) {
 
-			handleFunctionCallInExpr("scriptFunc");
+			handleFunctionCallInExpr("intrinsic");
 
 			return true;
 		}
 		else
-			if (memCmp()) {
+			if (functionCall()) {
 
-				handleFunctionCallInExpr("");
+				handleFunctionCallInExpr("scriptFunc");
 
 				return true;
 			}
 			else
-				if (sizeOf()) {
+				if (memCmp()) {
 
 					handleFunctionCallInExpr("");
 
 					return true;
 				}
 				else
-					if (structStaticOrObjectAccess()) {
+					if (sizeOf()) {
+
+						handleFunctionCallInExpr("");
+
 						return true;
 					}
 					else
-						if (tk_identifier()) {
+						if (structStaticOrObjectAccess()) {
 							return true;
 						}
 						else
-							if (GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
-
-								sOperand = PREV_TOKEN_TEXT;
-								m_vPostFix.push_back(sOperand);
-
+							if (tk_identifier()) {
 								return true;
 							}
 							else
-								if (GrammerUtils::match(TokenType_::Type::TK_FLOAT, OPTIONAL_)) {
+								if (GrammerUtils::match(TokenType_::Type::TK_INTEGER, OPTIONAL_)) {
 
 									sOperand = PREV_TOKEN_TEXT;
-									m_vPostFix.push_back(sOperand);
+									pushOperand(ExprNodeType_::Type::EXPR_INTEGER, sOperand);
 
 									return true;
 								}
 								else
-									if (GrammerUtils::match(TokenType_::Type::TK_CHARACTER, OPTIONAL_)) {
+									if (GrammerUtils::match(TokenType_::Type::TK_FLOAT, OPTIONAL_)) {
 
 										sOperand = PREV_TOKEN_TEXT;
-										char pStr[255] = { 0 };
-										sprintf_s(pStr, "%d", sOperand.c_str()[0]);
-
-										m_vPostFix.push_back(pStr);
+										pushOperand(ExprNodeType_::Type::EXPR_FLOAT, sOperand);
 
 										return true;
 									}
 									else
-										return false;
+										if (GrammerUtils::match(TokenType_::Type::TK_CHARACTER, OPTIONAL_)) {
+
+											sOperand = PREV_TOKEN_TEXT;
+											char pStr[255] = { 0 };
+											sprintf_s(pStr, "%d", sOperand.c_str()[0]);
+
+											pushOperand(ExprNodeType_::Type::EXPR_INTEGER, pStr);
+
+											return true;
+										}
+										else
+											return false;
 
 	return true;
 
@@ -3818,7 +3533,7 @@ bool TinyCReader::tk_identifier() {
 					sOperand = sFullyQualifiedVariableName;
 				}
 
-				m_vPostFix.push_back(sOperand);
+				pushOperand(ExprNodeType_::Type::EXPR_VARIABLE, sOperand);
 
 				return true;
 			}
@@ -3895,20 +3610,20 @@ bool TinyCReader::structMemberVariableOrFunctionCall_RValue() {
 			sFullyQualifiedObjectName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sObjectName);
 
 		pObjectAccessNode = makeLeaf(ASTNodeType::ASTNode_MEMBERACCESS, sFullyQualifiedObjectName.c_str());
-		SET_INFO_FOR_KEY(pObjectAccessNode, "accessType", "object");
+		SET_INFO_FOR_KEY(pObjectAccessNode, ASTInfo::ACCESSTYPE, "object");
 	}
 	break;
 	case TokenType_::Type::TK_STATICMEMBERACCESS:
 	{
 		pObjectAccessNode = makeLeaf(ASTNodeType::ASTNode_MEMBERACCESS, sObjectName.c_str());
-		SET_INFO_FOR_KEY(pObjectAccessNode, "accessType", "static");
+		SET_INFO_FOR_KEY(pObjectAccessNode, ASTInfo::ACCESSTYPE, "static");
 	}
 	break;
 	}
 
 	{
-		pObjectAccessNode->m_sAdditionalInfo.append(sObjectName);
-		SET_INFO_FOR_KEY(pObjectAccessNode, "givenName", sObjectName);
+		APPEND_INFO_FOR_KEY(pObjectAccessNode, ASTInfo::SYMBOL, sObjectName);
+		SET_INFO_FOR_KEY(pObjectAccessNode, ASTInfo::GIVENNAME, sObjectName);
 
 		m_pASTCurrentNode->addChild(pObjectAccessNode);
 
@@ -3933,13 +3648,14 @@ bool TinyCReader::structMemberVariableOrFunctionCall_RValue_1() {
 		if (GrammerUtils::match(TokenType_::Type::TK_IDENTIFIER, OPTIONAL_)) {
 
 			{
-				std::string sOperand = GET_INFO_FOR_KEY(m_pASTCurrentNode, "text");
+				std::string sOperand = GET_INFO_FOR_KEY(m_pASTCurrentNode, ASTInfo::TEXT);
 				sOperand.append("->");
 				sOperand.append(PREV_TOKEN_TEXT);
 
-				GrammerUtils::m_vUserDefinedVariables.push_back(sOperand);
+				GrammerUtils::m_SetUserDefinedVariables.insert(StringInterner::intern(sOperand));
 
-				m_vPostFix.push_back(sOperand);
+				ExprNode* pMemberNode = pushOperand(ExprNodeType_::Type::EXPR_MEMBER, GET_INFO_FOR_KEY(m_pASTCurrentNode, ASTInfo::TEXT));
+				pMemberNode->m_sMemberName = PREV_TOKEN_TEXT;
 			}
 
 			return true;
@@ -3962,7 +3678,7 @@ bool TinyCReader::structMemberVariableArrayInAnExpr() {
 	m_pASTCurrentNode->m_eASTNodeType = ASTNodeType::ASTNode_MEMBERACCESSDEREF;
 	Tree* pIdentifierLeaf = makeLeaf(ASTNodeType::ASTNode_IDENTIFIER, PREV_TOKEN_TEXT);
 	{
-		SET_INFO_FOR_KEY(pIdentifierLeaf, "givenName", PREV_TOKEN_TEXT);
+		SET_INFO_FOR_KEY(pIdentifierLeaf, ASTInfo::GIVENNAME, PREV_TOKEN_TEXT);
 	}
 
 	Tree* pArrayIndexExpressionLeaf = makeLeaf(ASTNodeType::ASTNode_EXPRESSION, "");
@@ -3970,14 +3686,10 @@ bool TinyCReader::structMemberVariableArrayInAnExpr() {
 	if (!GrammerUtils::match('[', MANDATORY_))
 		return false;
 
-	checkOpPrecedenceAndPush("(");
-
 	if (!expr())
 		return false;
 
-	checkOpPrecedenceAndPush(")");
-
-	pArrayIndexExpressionLeaf = createPostFixExpr(pArrayIndexExpressionLeaf);
+	pArrayIndexExpressionLeaf = createExpressionLeaf(pArrayIndexExpressionLeaf);
 	m_pASTCurrentNode->m_pLeftNode = pIdentifierLeaf;
 	m_pASTCurrentNode->m_pRightNode = pArrayIndexExpressionLeaf;
 
@@ -4010,18 +3722,18 @@ bool TinyCReader::structMemberFunctionCallInAnExpr() {
 	}
 	assert(pFunctionCallNode != nullptr);
 	{
-		std::string sFuncName = GET_INFO_FOR_KEY(pFunctionCallNode, "text");
+		std::string sFuncName = GET_INFO_FOR_KEY(pFunctionCallNode, ASTInfo::TEXT);
 		std::string sFullyQualifiedTempVariableName;
-		sFullyQualifiedTempVariableName.append(GET_INFO_FOR_KEY(pAssignNode, "text"));
+		sFullyQualifiedTempVariableName.append(GET_INFO_FOR_KEY(pAssignNode, ASTInfo::TEXT));
 		sFullyQualifiedTempVariableName.append("_");
 		sFullyQualifiedTempVariableName.append(sFuncName);
 
 		Tree* pPrimIntNode = makeLeaf(ASTNodeType::ASTNode_TYPE, sFullyQualifiedTempVariableName.c_str());
 		{
-			pPrimIntNode->m_sAdditionalInfo.append(sFullyQualifiedTempVariableName);
-			SET_INFO_FOR_KEY(pPrimIntNode, "givenName", sFuncName);
-			SET_INFO_FOR_KEY(pPrimIntNode, "type", "int32_t");
-			SET_INFO_FOR_KEY(pPrimIntNode, "scope", getCurrentScopeString());
+			APPEND_INFO_FOR_KEY(pPrimIntNode, ASTInfo::SYMBOL, sFullyQualifiedTempVariableName);
+			SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::GIVENNAME, sFuncName);
+			SET_INFO_FOR_KEY(pPrimIntNode, ASTInfo::TYPE, "int32_t");
+			pPrimIntNode->m_eScope = getCurrentScope();
 			m_pASTCurrentBlockNode->addChild(pPrimIntNode);
 		}
 
@@ -4032,7 +3744,8 @@ bool TinyCReader::structMemberFunctionCallInAnExpr() {
 			pExpressionLeftLeaf->addChild(pFunctionCallNode);
 		}
 
-		m_vPostFix.push_back(sFullyQualifiedTempVariableName);
+		ExprNode* pTempNode = pushOperand(ExprNodeType_::Type::EXPR_VARIABLE, sFullyQualifiedTempVariableName);
+		pTempNode->m_pCallNode = pPrimIntNode;
 	}
 
 	return true;
@@ -4040,38 +3753,32 @@ bool TinyCReader::structMemberFunctionCallInAnExpr() {
 }
 
 bool TinyCReader::unary_expr() {
-	if (!unary_oper())
-		return false;
-	if (!expr())
-		return false;
-	return true;
-
-}
+	TokenType_::Type eOperator = TokenType_::Type::TK_INVALID;
+	std::string sOperator;
 
-bool TinyCReader::unary_oper() {
 	if (GrammerUtils::match('-', OPTIONAL_)) {
-
-		checkOpPrecedenceAndPush("NEGATE");
-
-		return true;
+		eOperator = TokenType_::Type::TK_NEGATE;
+		sOperator = "NEGATE";
 	}
 	else
 		if (GrammerUtils::match('!', OPTIONAL_)) {
-
-			checkOpPrecedenceAndPush("!");
-
-			return true;
+			eOperator = TokenType_::Type::TK_NOT;
+			sOperator = "!";
 		}
 		else
 			if (GrammerUtils::match('~', OPTIONAL_)) {
-
-				checkOpPrecedenceAndPush("~");
-
-				return true;
+				eOperator = TokenType_::Type::TK_BITWISENOT;
+				sOperator = "~";
 			}
 			else
 				return false;
 
+	// Unary operators bind tighter than any binary operator.
+	if (!primary())
+		return false;
+
+	reduceOperator(eOperator, sOperator, true);
+
 	return true;
 
 }
@@ -4089,10 +3796,10 @@ bool TinyCReader::preFixInExpr() {
 		std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
 		Tree* pPreDecrNode = makeLeaf(ASTNodeType::ASTNode_PREDECR, sFullyQualifiedVariableName.c_str());
 		{
-			SET_INFO_FOR_KEY(pPreDecrNode, "givenName", sVariableName);
+			SET_INFO_FOR_KEY(pPreDecrNode, ASTInfo::GIVENNAME, sVariableName);
 
 			m_pASTCurrentNode->m_pLeftNode->addChild(pPreDecrNode);
-			m_vPostFix.push_back(sFullyQualifiedVariableName);
+			pushOperand(ExprNodeType_::Type::EXPR_VARIABLE, sFullyQualifiedVariableName);
 		}
 
 		return true;
@@ -4110,10 +3817,10 @@ bool TinyCReader::preFixInExpr() {
 			std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
 			Tree* pPreIncrNode = makeLeaf(ASTNodeType::ASTNode_PREINCR, sFullyQualifiedVariableName.c_str());
 			{
-				SET_INFO_FOR_KEY(pPreIncrNode, "givenName", sVariableName);
+				SET_INFO_FOR_KEY(pPreIncrNode, ASTInfo::GIVENNAME, sVariableName);
 
 				m_pASTCurrentNode->m_pLeftNode->addChild(pPreIncrNode);
-				m_vPostFix.push_back(sFullyQualifiedVariableName);
+				pushOperand(ExprNodeType_::Type::EXPR_VARIABLE, sFullyQualifiedVariableName);
 			}
 
 			return true;
@@ -4139,16 +3846,13 @@ bool TinyCReader::rValueDeref() {
 	if (!GrammerUtils::match('[', MANDATORY_))
 		return false;
 
-	checkOpPrecedenceAndPush("(");
-
 	if (!expr())
 		return false;
 
-	checkOpPrecedenceAndPush(")");
-
 
-	m_vPostFix.push_back(sFullyQualifiedVariableName);
-	m_vPostFix.push_back("@");
+	ExprNode* pIndexNode = popOperand();
+	ExprNode* pDerefNode = pushOperand(ExprNodeType_::Type::EXPR_DEREF, sFullyQualifiedVariableName);
+	pDerefNode->m_pLeft = pIndexNode;
 
 	if (!GrammerUtils::match(']', MANDATORY_))
 		return false;
@@ -4169,10 +3873,10 @@ bool TinyCReader::postFixIncrDecrInExpr() {
 		std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
 		Tree* pPostDecrNode = makeLeaf(ASTNodeType::ASTNode_POSTDECR, sFullyQualifiedVariableName.c_str());
 		{
-			SET_INFO_FOR_KEY(pPostDecrNode, "givenName", sVariableName);
+			SET_INFO_FOR_KEY(pPostDecrNode, ASTInfo::GIVENNAME, sVariableName);
 
 			m_pASTCurrentNode->m_pRightNode->addChild(pPostDecrNode);
-			m_vPostFix.push_back(sFullyQualifiedVariableName);
+			pushOperand(ExprNodeType_::Type::EXPR_VARIABLE, sFullyQualifiedVariableName);
 		}
 
 		return true;
@@ -4190,10 +3894,10 @@ bool TinyCReader::postFixIncrDecrInExpr() {
 			std::string sFullyQualifiedVariableName = getFullyQualifiedNameForVariable(m_pASTCurrentNode, sVariableName);
 			Tree* pPostIncrNode = makeLeaf(ASTNodeType::ASTNode_POSTINCR, sFullyQualifiedVariableName.c_str());
 			{
-				SET_INFO_FOR_KEY(pPostIncrNode, "givenName", sVariableName);
+				SET_INFO_FOR_KEY(pPostIncrNode, ASTInfo::GIVENNAME, sVariableName);
 
 				m_pASTCurrentNode->m_pRightNode->addChild(pPostIncrNode);
-				m_vPostFix.push_back(sFullyQualifiedVariableName);
+				pushOperand(ExprNodeType_::Type::EXPR_VARIABLE, sFullyQualifiedVariableName);
 			}
 
 			return true;
@@ -4209,15 +3913,11 @@ bool TinyCReader::paren_expr() {
 	if (!GrammerUtils::match('(', MANDATORY_))
 		return false;
 
-	checkOpPrecedenceAndPush("(");
-
-	if (!expr())
+	if (!parseExpression(ENUM_OP_PRECEDENCE::OP_INVALID))
 		return false;
 	if (!GrammerUtils::match(')', MANDATORY_))
 		return false;
 
-	checkOpPrecedenceAndPush(")");
-
 	return true;
 
 }
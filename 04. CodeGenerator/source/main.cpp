@@ -1,20 +1,153 @@
 
 #include <iostream>
 #include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <new>
+#include <windows.h>
+#include <psapi.h>
 #include "TinyCReader.h"
+#include "StringTokenizer.h"
+#include "Inliner.h"
+
+#pragma comment(lib, "psapi.lib")
+
+#define BENCHMARK_ROUNDS	10
+
+// Every operator new in the process goes through here, so the benchmarks can report allocations.
+static uint64_t g_iAllocations = 0;
+
+void* operator new(size_t iSize)
+{
+	g_iAllocations++;
+	void* pMemory = malloc(iSize);
+	if (pMemory == nullptr)
+		throw std::bad_alloc();
+
+	return pMemory;
+}
+
+void operator delete(void* pMemory) noexcept
+{
+	free(pMemory);
+}
+
+static bool readWholeFile(const char* sFile, std::string& sData)
+{
+	std::ifstream file(sFile, std::ios::in | std::ios::binary);
+	if (NOT file.is_open())
+	{
+		std::cout << "could not open " << sFile << std::endl;
+		return false;
+	}
+
+	sData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+// Tokenizer throughput & allocations, best of BENCHMARK_ROUNDS.
+//		- tokenize()			lexes the whole buffer into TokenSpans.
+//		- tokenize() + drain	also turns every span into a Token through nextToken(), as the parser does.
+// A fresh StringTokenizer is created every round. They are not freed, the destructor is private.
+static void lexBenchmark(const char* sFile)
+{
+	std::string sData;
+	if (NOT readWholeFile(sFile, sData))
+		return;
+
+	size_t iTokens = 0;
+	for (int32_t iPass = 0; iPass < 2; iPass++)
+	{
+		bool bDrain = (iPass == 1);
+		double dBestSeconds = 0.0;
+		uint64_t iAllocations = 0;
+		for (int32_t iRound = 0; iRound < BENCHMARK_ROUNDS; iRound++)
+		{
+			uint64_t iAllocationsAtStart = g_iAllocations;
+			std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+			StringTokenizer* pStrTokenizer = StringTokenizer::create(sData.c_str());
+			pStrTokenizer->tokenize();
+			if (bDrain)
+			{
+				while (pStrTokenizer->hasMoreTokens())
+					pStrTokenizer->nextToken();
+			}
+
+			std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+			if (iRound == 0 || elapsed.count() < dBestSeconds)
+				dBestSeconds = elapsed.count();
+
+			iAllocations = g_iAllocations - iAllocationsAtStart;
+			iTokens = pStrTokenizer->getTokenSpans().size();
+		}
+
+		if (iPass == 0)
+			std::cout << sFile << ": " << sData.length() << " bytes, " << iTokens << " tokens" << std::endl;
+
+		std::cout << (bDrain ? "tokenize() + drain : " : "tokenize()         : ")
+				  << (sData.length() / (1024.0 * 1024.0)) / dBestSeconds << " MB/s, "
+				  << iAllocations << " allocations" << std::endl;
+	}
+}
+
+// Compile time & peak memory of one full compile, printed after the compiler's own output.
+// benchmarkCompile.py runs this repeatedly & reports the median. A program the size of
+// generateLargeSource.py's default needs a build with a larger MAX_BYTECODE_SIZE(GrammerUtils.h).
+static void compileBenchmarkReport(double dSeconds)
+{
+	PROCESS_MEMORY_COUNTERS memoryCounters = { 0 };
+	memoryCounters.cb = sizeof(memoryCounters);
+	GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters));
+
+	std::cout << std::endl;
+	std::cout << "compile time : " << dSeconds * 1000.0 << " ms" << std::endl;
+	std::cout << "peak memory  : " << memoryCounters.PeakWorkingSetSize / (1024.0 * 1024.0) << " MB" << std::endl;
+	std::cout << "allocations  : " << g_iAllocations << std::endl;
+	std::cout << "AST nodes    : " << TreeArena::allocatedCount() << " x " << sizeof(Tree) << " bytes = " << (TreeArena::allocatedCount() * sizeof(Tree)) / (1024.0 * 1024.0) << " MB" << std::endl;
+}
 
 int main(int argc, char* argv[])
 {
 	if (argc < 2)
 	{
-		std::cout << "Usage: CodeGenerator.exe filename.c" << std::endl;
+		std::cout << "Usage: CodeGenerator.exe filename.c [-inline=N] [-lexbench] [-compilebench]" << std::endl;
+		std::cout << "\t-inline=N\tInline calls to function()s of at most N bytes, 0 turns it off. Default " << INLINE_THRESHOLD << "." << std::endl;
+		std::cout << "\t-lexbench\tReport tokenizer MB/s & allocations for filename.c instead of compiling it." << std::endl;
+		std::cout << "\t-compilebench\tCompile filename.c, then report compile time, peak memory & allocations." << std::endl;
 		exit(EXIT_FAILURE);
 	}
 
+	bool bCompileBenchmark = false;
+	for (int i = 2; i < argc; i++)
+	{
+		if (strncmp(argv[i], "-inline=", strlen("-inline=")) == 0)
+			Inliner::m_iThreshold = atoi(argv[i] + strlen("-inline="));
+
+		if (strcmp(argv[i], "-lexbench") == 0)
+		{
+			lexBenchmark(argv[1]);
+			exit(EXIT_SUCCESS);
+		}
+
+		if (strcmp(argv[i], "-compilebench") == 0)
+			bCompileBenchmark = true;
+	}
+
 	std::string sFilename = argv[1];
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
 	TinyCReader* pTinyCReader = new TinyCReader();
 	pTinyCReader->read(sFilename.c_str());
 
+	if (bCompileBenchmark)
+	{
+		std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+		compileBenchmarkReport(elapsed.count());
+		exit(EXIT_SUCCESS);
+	}
+
 	system("copyMainDotO.bat");
 
 	exit(EXIT_SUCCESS);
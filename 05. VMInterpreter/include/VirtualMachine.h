@@ -2,6 +2,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <mutex>
 
 enum class OPCODE
 {
@@ -63,6 +64,33 @@ enum class OPCODE
 	MODF,
 	PRTF,
 	CAST,
+	SINF,
+	COSF,
+	SQRTF,
+	ABSF,
+	MINF,
+	MAXF,
+	FLOORF,
+	LERPF,
+	RANDF,
+	SRAND,
+	AWAIT,
+	JMPTABLE,
+	BR_LT,
+	BR_LTEQ,
+	BR_GT,
+	BR_GTEQ,
+	BR_EQ,
+	BR_NEQ,
+	BR_LTF,
+	BR_LTEQF,
+	BR_GTF,
+	BR_GTEQF,
+	BR_EQF,
+	BR_NEQF,
+	DUP,
+	TAILCALL,
+	LEA,
 	HLT
 };
 
@@ -70,13 +98,16 @@ enum class OPCODE
 #define MAX_DATA_SIZE				3840
 #define MAX_HEAP_SIZE				768
 #define MAX_STACK_SIZE				256
-#define MAX_RAM_SIZE				MAX_BYTECODE_SIZE + MAX_DATA_SIZE + MAX_HEAP_SIZE + MAX_STACK_SIZE
+#define MAX_HOSTDATA_SIZE			256
+#define MAX_RAM_SIZE				MAX_BYTECODE_SIZE + MAX_DATA_SIZE + MAX_HEAP_SIZE + MAX_HOSTDATA_SIZE + MAX_STACK_SIZE
 
 #define CS_START_OFFSET				0
 #define DS_START_OFFSET				CS_START_OFFSET + MAX_BYTECODE_SIZE
+#define HD_START_OFFSET				DS_START_OFFSET + MAX_DATA_SIZE + MAX_HEAP_SIZE
 #define SS_START_OFFSET				MAX_RAM_SIZE - 1
 
 #define READ_OPERAND(__eOpCode__)	readOperandFor(__eOpCode__)
+#define HOST_RETURN_ADDRESS			-1								// 'RET' address of a function() called by the host, stops the VM.
 
 enum EFLAGS_BIT
 {
@@ -163,6 +194,115 @@ typedef struct REGISTERS
 	int32_t		EIP;
 } REGISTERS;
 
+enum class HOSTFIELDTYPE
+{
+	INT_32,
+	FLOAT,
+};
+
+struct HostField
+{
+	HostField(const char* sName, HOSTFIELDTYPE eType)
+	: m_sName(sName)
+	, m_eType(eType)
+	, m_iValue(0)
+	{}
+
+	std::string		m_sName;
+	HOSTFIELDTYPE	m_eType;
+	int32_t			m_iValue;		// Last value set, a float's bits for FLOAT. Copied into HOSTDATA on load().
+};
+
+struct ScriptValue
+{
+	ScriptValue()
+	: m_eType(HOSTFIELDTYPE::INT_32)
+	, m_iValue(0)
+	{}
+
+	ScriptValue(int32_t iValue)
+	: m_eType(HOSTFIELDTYPE::INT_32)
+	, m_iValue(iValue)
+	{}
+
+	ScriptValue(float fValue)
+	: m_eType(HOSTFIELDTYPE::FLOAT)
+	, m_fValue(fValue)
+	{}
+
+	ScriptValue(double dValue)
+	: m_eType(HOSTFIELDTYPE::FLOAT)
+	, m_fValue((float)dValue)
+	{}
+
+	int32_t asInt() const	{ return (m_eType == HOSTFIELDTYPE::FLOAT) ? (int32_t)m_fValue : m_iValue; }
+	float asFloat() const	{ return (m_eType == HOSTFIELDTYPE::FLOAT) ? m_fValue : (float)m_iValue; }
+
+	HOSTFIELDTYPE	m_eType;
+	union
+	{
+		int32_t		m_iValue;
+		float		m_fValue;
+	};
+};
+
+struct ExportedFunction
+{
+	ExportedFunction(const char* sName, int32_t iEntryOffset)
+	: m_sName(sName)
+	, m_iEntryOffset(iEntryOffset)
+	, m_bHasReturnValue(false)
+	, m_eReturnType(HOSTFIELDTYPE::INT_32)
+	{}
+
+	std::string					m_sName;
+	int32_t						m_iEntryOffset;
+	bool						m_bHasReturnValue;
+	HOSTFIELDTYPE				m_eReturnType;
+	std::vector<HOSTFIELDTYPE>	m_vArgumentTypes;
+};
+
+struct AsyncCall
+{
+	AsyncCall()
+	: m_bInUse(false)
+	, m_bCompleted(false)
+	, m_iResult(0)
+	{}
+
+	bool			m_bInUse;
+	bool			m_bCompleted;
+	int32_t			m_iResult;
+};
+
+// A host call() in flight. The registers it saved & the export's return type stay here while it is parked on an
+// 'await', so resume() can finish it. A call() made by a native from inside a 'SYSCALL' also keeps what that 'SYSCALL'
+// still has to do once the call() returns.
+struct PendingCall
+{
+	PendingCall()
+	: m_bHasReturnValue(false)
+	, m_eReturnType(HOSTFIELDTYPE::INT_32)
+	, m_iSavedEIP(0)
+	, m_iSavedRSP(0)
+	, m_iSavedRBP(0)
+	, m_bWasRunning(false)
+	, m_iSysCallArgCount(-1)
+	, m_iSysCallRAX(0)
+	{}
+
+	bool			m_bHasReturnValue;
+	HOSTFIELDTYPE	m_eReturnType;
+
+	int32_t			m_iSavedEIP;
+	int64_t			m_iSavedRSP;
+	int64_t			m_iSavedRBP;
+	bool			m_bWasRunning;
+
+	int16_t			m_iSysCallArgCount;		// -1 unless the call() parked inside a 'SYSCALL'.
+	int64_t			m_iSysCallRAX;			// That 'SYSCALL's own return value.
+};
+
 struct HeapNode
 {
 	HeapNode(int32_t pAddress, int iSize)
@@ -184,6 +324,31 @@ class VirtualMachine
 
 		const void*					getStackPointerFromTOS(int32_t iOffset) const;
 		REGISTERS*					getVMRegisters();
+
+		// Host Data, named fields mapped read-only into the VM(HOSTDATA segment).
+		// Fields are registered before loadFile() & written by the host whenever they change.
+		int32_t						addHostField(const char* sName, HOSTFIELDTYPE eType);
+		void						setHostField(int32_t iField, int32_t iValue);
+		void						setHostField(int32_t iField, float fValue);
+
+		// Exported script function()s, called directly without re-running main().
+		// Globals & HEAP are kept between calls, run start() once to initialise them.
+		int32_t						getFunction(const char* sName) const;
+		ScriptValue					call(int32_t iFunction, const std::vector<ScriptValue>& vArgs);
+		template<typename... ARGS>
+		ScriptValue					call(const char* sName, ARGS... args)
+		{
+			return call(getFunction(sName), std::vector<ScriptValue>{ ScriptValue(args)... });
+		}
+
+		// Async SYSCALLs, the native returns a beginAsyncCall() handle in 'EAX' & does the work elsewhere.
+		// completeAsyncCall() may come from any thread. 'await(handle)' in the script parks the VM till then,
+		// start()/call() return early & the host resume()s it later. resume() returns true once the script is done
+		// & hands back the return value of a parked call() in 'pReturnValue'.
+		int32_t						beginAsyncCall();
+		void						completeAsyncCall(int32_t iHandle, int32_t iResult);
+		bool						isParked() const;
+		bool						resume(ScriptValue* pReturnValue = nullptr);
 	protected:
 		void						setSysFuncCallback(std::function<void(const char*, int16_t)>* fSysFuncCallback);
 
@@ -211,12 +376,16 @@ class VirtualMachine
 		void						sta(OPCODE eOpcode);
 		void						clrMem(OPCODE eOpCode);
 		void						call(OPCODE eOpCode);
+		void						tailCall(OPCODE eOpCode);
 		void						sysCall(OPCODE eOpCode);
 		void						memSet(OPCODE eOpCode);
 		void						memCpy(OPCODE eOpCode);
 		void						memCmp(OPCODE eOpCode);
 		void						memChr(OPCODE eOpCode);
 		void						cast(OPCODE eOpCode);
+		void						intrinsic(OPCODE eOpCode);
+		void						awaitAsyncCall(OPCODE eOpCode);
+		ScriptValue					returnFromCall();
 
 		int32_t						getConsumedMemory();
 		int32_t						getAvailableMemory();
@@ -235,11 +404,23 @@ class VirtualMachine
 		int8_t*						DATA;
 		int32_t*					GLOBALS;
 		int8_t*						HEAP;
+		int32_t*					HOSTDATA;
 
 		bool						m_bRunning;
+		uint32_t					m_iRandomState;				// xorshift32 state for 'RANDF', reseeded by 'SRAND'.
 
 		int8_t						RAM[MAX_RAM_SIZE];
 
 		std::vector<HeapNode>		m_vAllocatedList;
 		std::vector<HeapNode>		m_vUnAllocatedList;
+
+		std::vector<HostField>		m_vHostFields;
+		std::vector<int32_t>		m_vHostFieldBinding;		// Script 'HOSTDATA' position ==> index in m_vHostFields.
+
+		std::vector<ExportedFunction>	m_vExports;
+
+		bool						m_bParked;
+		std::vector<AsyncCall>		m_vAsyncCalls;				// Handle ==> index, guarded by m_AsyncMutex.
+		std::vector<PendingCall>	m_vPendingCalls;			// Innermost call() last.
+		std::mutex					m_AsyncMutex;
 };
\ No newline at end of file
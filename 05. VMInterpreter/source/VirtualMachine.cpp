@@ -3,6 +3,7 @@
 #include <assert.h>
 #include <algorithm>
 #include <iostream>
+#include <cmath>
 #include "ConsoleColor.h"
 
 #define VERBOSE	1
@@ -24,7 +25,8 @@ enum class E_VARIABLESCOPE
 	ARGUMENT,
 	LOCAL,
 	STATIC,
-	MEMBER
+	MEMBER,
+	HOST
 };
 
 enum class E_FUNCTIONCALLTYPE
@@ -109,6 +111,34 @@ struct CodeMap
 	{ "PRTF",		OPCODE::PRTF,		1,  PRIMIIVETYPE::INT_8 },
 	{ "CAST",		OPCODE::CAST,		3,  PRIMIIVETYPE::INT_8 },
 
+	{ "SINF",		OPCODE::SINF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "COSF",		OPCODE::COSF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "SQRTF",		OPCODE::SQRTF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "ABSF",		OPCODE::ABSF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "MINF",		OPCODE::MINF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "MAXF",		OPCODE::MAXF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "FLOORF",		OPCODE::FLOORF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "LERPF",		OPCODE::LERPF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "RANDF",		OPCODE::RANDF,		1,  PRIMIIVETYPE::INT_8 },
+	{ "SRAND",		OPCODE::SRAND,		1,  PRIMIIVETYPE::INT_8 },
+	{ "AWAIT",		OPCODE::AWAIT,		1,  PRIMIIVETYPE::INT_8 },
+	{ "JMPTABLE",	OPCODE::JMPTABLE,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LT",		OPCODE::BR_LT,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LTEQ",	OPCODE::BR_LTEQ,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GT",		OPCODE::BR_GT,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GTEQ",	OPCODE::BR_GTEQ,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_EQ",		OPCODE::BR_EQ,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_NEQ",		OPCODE::BR_NEQ,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LTF",		OPCODE::BR_LTF,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_LTEQF",	OPCODE::BR_LTEQF,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GTF",		OPCODE::BR_GTF,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_GTEQF",	OPCODE::BR_GTEQF,	2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_EQF",		OPCODE::BR_EQF,		2,  PRIMIIVETYPE::INT_32 },
+	{ "BR_NEQF",	OPCODE::BR_NEQF,	2,  PRIMIIVETYPE::INT_32 },
+	{ "DUP",		OPCODE::DUP,		1,  PRIMIIVETYPE::INT_8 },
+	{ "TAILCALL",	OPCODE::TAILCALL,	3,  PRIMIIVETYPE::INT_32 },
+	{ "LEA",		OPCODE::LEA,		2,  PRIMIIVETYPE::INT_32 },
+
 	{ "HLT",		OPCODE::HLT,		1,  PRIMIIVETYPE::INT_8 },
 };
 
@@ -120,7 +150,10 @@ VirtualMachine::VirtualMachine()
 , DATA(nullptr)
 , GLOBALS(nullptr)
 , HEAP(nullptr)
+, HOSTDATA(nullptr)
 , m_bRunning(false)
+, m_iRandomState(2463534242)
+, m_bParked(false)
 { }
 
 VirtualMachine::~VirtualMachine()
@@ -191,6 +224,8 @@ void VirtualMachine::reset()
 	m_vUnAllocatedList.push_back(HeapNode(1, MAX_HEAP_SIZE));
 
 	m_bRunning = false;
+	m_bParked = false;
+	m_vPendingCalls.clear();
 }
 
 int VirtualMachine::loadBSS(const char* iByteCode, int startOffset, int iBuffLength)
@@ -231,6 +266,63 @@ int VirtualMachine::loadBSS(const char* iByteCode, int startOffset, int iBuffLen
 	HEAP = &RAM[iStringStartOffset];
 	REGS.GS = iStringStartOffset;
 
+	// Bind Host Data fields
+	//		[COUNT(2 bytes)] [STRING_ID(2 bytes)][TYPE(1 byte)] ...
+	{
+		int16_t iHostFieldCount = *((int16_t*)&iByteCode[iOffset]);
+		iOffset += sizeof(int16_t);
+
+		m_vHostFieldBinding.clear();
+		for (int i = 0; i < iHostFieldCount; i++)
+		{
+			int16_t iStrID = *((int16_t*)&iByteCode[iOffset]);
+			iOffset += sizeof(int16_t);
+			PRIMIIVETYPE eType = (PRIMIIVETYPE)iByteCode[iOffset++];
+
+			int32_t iStringOffset = *((int32_t*)DATA + iStrID);
+			const char* sName = (const char*)&RAM[iStringOffset];
+			HOSTFIELDTYPE eHostType = (eType == PRIMIIVETYPE::FLOAT) ? HOSTFIELDTYPE::FLOAT : HOSTFIELDTYPE::INT_32;
+
+			// Fields the host hasn't registered are added here & read as '0'.
+			int32_t iField = addHostField(sName, eHostType);
+			assert(m_vHostFields[iField].m_eType == eHostType);
+
+			m_vHostFieldBinding.push_back(iField);
+		}
+	}
+
+	// Exported function()s
+	//		[COUNT(2 bytes)] [STRING_ID(2 bytes)][ENTRY_OFFSET(4 bytes)][RETURN_TYPE(1 byte)][ARG_COUNT(1 byte)][ARG_TYPE(1 byte)]... ...
+	{
+		int16_t iExportCount = *((int16_t*)&iByteCode[iOffset]);
+		iOffset += sizeof(int16_t);
+
+		m_vExports.clear();
+		for (int i = 0; i < iExportCount; i++)
+		{
+			int16_t iStrID = *((int16_t*)&iByteCode[iOffset]);
+			iOffset += sizeof(int16_t);
+			int32_t iEntryOffset = *((int32_t*)&iByteCode[iOffset]);
+			iOffset += sizeof(int32_t);
+
+			int32_t iStringOffset = *((int32_t*)DATA + iStrID);
+			ExportedFunction pExport((const char*)&RAM[iStringOffset], iEntryOffset);
+
+			int8_t iReturnType = iByteCode[iOffset++];
+			pExport.m_bHasReturnValue = (iReturnType >= 0);
+			pExport.m_eReturnType = (iReturnType == (int8_t)PRIMIIVETYPE::FLOAT) ? HOSTFIELDTYPE::FLOAT : HOSTFIELDTYPE::INT_32;
+
+			int8_t iArgCount = iByteCode[iOffset++];
+			for (int j = 0; j < iArgCount; j++)
+			{
+				PRIMIIVETYPE eType = (PRIMIIVETYPE)iByteCode[iOffset++];
+				pExport.m_vArgumentTypes.push_back((eType == PRIMIIVETYPE::FLOAT) ? HOSTFIELDTYPE::FLOAT : HOSTFIELDTYPE::INT_32);
+			}
+
+			m_vExports.push_back(pExport);
+		}
+	}
+
 	return iOffset;
 }
 
@@ -252,10 +344,17 @@ void VirtualMachine::load(const char* iByteCode, int iBuffLength)
 	CODE = (int8_t*)&RAM[CS_START_OFFSET];
 	STACK = (int32_t*)&RAM[SS_START_OFFSET];
 	DATA = (int8_t*)&RAM[DS_START_OFFSET];
+	HOSTDATA = (int32_t*)&RAM[HD_START_OFFSET];
+
+	// Values the host set before the code was loaded.
+	for (size_t iField = 0; iField < m_vHostFields.size(); iField++)
+		HOSTDATA[iField] = m_vHostFields[iField].m_iValue;
 
 	int iEndOffset = 0;
 	iEndOffset = loadBSS(iByteCode, 0, iBuffLength);
 	iEndOffset = loadCode(iByteCode, iEndOffset, iBuffLength);
+
+	reset();
 }
 
 void VirtualMachine::execute(const char* iByteCode)
@@ -295,6 +394,12 @@ void VirtualMachine::eval(OPCODE eOpCode)
 			STACK[--REGS.RSP] = iOperand;
 		}
 		break;
+		case OPCODE::DUP:
+		{
+			iTemp1 = STACK[REGS.RSP];
+			STACK[--REGS.RSP] = iTemp1;
+		}
+		break;
 		case OPCODE::PUSHF:
 		{
 			iOperand = READ_OPERAND(eOpCode);
@@ -319,6 +424,11 @@ void VirtualMachine::eval(OPCODE eOpCode)
 			call(eOpCode);
 		}
 		break;
+		case OPCODE::TAILCALL:
+		{
+			tailCall(eOpCode);
+		}
+		break;
 		case OPCODE::SYSCALL:
 		{
 			sysCall(eOpCode);
@@ -614,7 +724,141 @@ void VirtualMachine::eval(OPCODE eOpCode)
 		{
 			iOperand = READ_OPERAND(eOpCode);
 			iTemp1 = STACK[REGS.RSP++];
-			if (iTemp1 > 0)
+			if (iTemp1 != 0)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::JMPTABLE:
+		{
+			// JMPTABLE iCount iLow iDefault iOffset[iCount], the selector is on the STACK.
+			int32_t iCount = READ_OPERAND(eOpCode);
+			int32_t iLow = READ_OPERAND(eOpCode);
+			iOperand = READ_OPERAND(eOpCode);
+
+			iTemp1 = STACK[REGS.RSP++] - iLow;
+			if ((uint32_t)iTemp1 < (uint32_t)iCount)
+				REGS.EIP = *((int32_t*)&CODE[REGS.EIP + iTemp1 * sizeof(int32_t)]);
+			else
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_LT:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			iTemp2 = STACK[REGS.RSP++];
+			iTemp1 = STACK[REGS.RSP++];
+
+			if (iTemp1 < iTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_LTEQ:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			iTemp2 = STACK[REGS.RSP++];
+			iTemp1 = STACK[REGS.RSP++];
+
+			if (iTemp1 <= iTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_GT:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			iTemp2 = STACK[REGS.RSP++];
+			iTemp1 = STACK[REGS.RSP++];
+
+			if (iTemp1 > iTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_GTEQ:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			iTemp2 = STACK[REGS.RSP++];
+			iTemp1 = STACK[REGS.RSP++];
+
+			if (iTemp1 >= iTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_EQ:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			iTemp2 = STACK[REGS.RSP++];
+			iTemp1 = STACK[REGS.RSP++];
+
+			if (iTemp1 == iTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_NEQ:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			iTemp2 = STACK[REGS.RSP++];
+			iTemp1 = STACK[REGS.RSP++];
+
+			if (iTemp1 != iTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_LTF:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			memcpy_s(&fTemp2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fTemp1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+
+			if (fTemp1 < fTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_LTEQF:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			memcpy_s(&fTemp2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fTemp1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+
+			if (fTemp1 <= fTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_GTF:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			memcpy_s(&fTemp2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fTemp1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+
+			if (fTemp1 > fTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_GTEQF:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			memcpy_s(&fTemp2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fTemp1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+
+			if (fTemp1 >= fTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_EQF:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			memcpy_s(&fTemp2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fTemp1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+
+			if (fTemp1 == fTemp2)
+				REGS.EIP = iOperand;
+		}
+		break;
+		case OPCODE::BR_NEQF:
+		{
+			iOperand = READ_OPERAND(eOpCode);
+			memcpy_s(&fTemp2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fTemp1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+
+			if (fTemp1 != fTemp2)
 				REGS.EIP = iOperand;
 		}
 		break;
@@ -667,6 +911,13 @@ void VirtualMachine::eval(OPCODE eOpCode)
 			}
 		}
 		break;
+		case OPCODE::LEA:
+		{
+			// Objects in a STACK FRAME are addressed from the HEAP like the ones MALLOC returns.
+			int32_t iVariable = READ_OPERAND(eOpCode);
+			STACK[--REGS.RSP] = (int32_t)((int8_t*)getAddressOf(iVariable) - HEAP);
+		}
+		break;
 		case OPCODE::VTBL:
 		{
 
@@ -697,6 +948,25 @@ void VirtualMachine::eval(OPCODE eOpCode)
 			cast(eOpCode);
 		}
 		break;
+		case OPCODE::SINF:
+		case OPCODE::COSF:
+		case OPCODE::SQRTF:
+		case OPCODE::ABSF:
+		case OPCODE::MINF:
+		case OPCODE::MAXF:
+		case OPCODE::FLOORF:
+		case OPCODE::LERPF:
+		case OPCODE::RANDF:
+		case OPCODE::SRAND:
+		{
+			intrinsic(eOpCode);
+		}
+		break;
+		case OPCODE::AWAIT:
+		{
+			awaitAsyncCall(eOpCode);
+		}
+		break;
 		case OPCODE::HLT:
 			m_bRunning = false;
 		break;
@@ -936,6 +1206,30 @@ void VirtualMachine::call(OPCODE eOpCode)
 	REGS.EIP = iJumpAddress;				// Jump to the call address.
 }
 
+void VirtualMachine::tailCall(OPCODE eOpCode)
+{
+	int32_t iJumpAddress = READ_OPERAND(eOpCode);			// ( NORMAL | OFFSET )
+	int32_t iArgumentCounts = READ_OPERAND(eOpCode);		// ( CALLER_ARGUMENT_COUNT | CALLEE_ARGUMENT_COUNT )
+	int16_t iCallerArgCount = (iArgumentCounts >> (sizeof(int16_t) * 8));
+	int16_t iCalleeArgCount = (iArgumentCounts & 0x0000FFFF);
+
+	/////////////////////////////////////////////////
+	// The callee takes over the caller's STACK FRAME.
+	//		- 'Call Return Address' & 'Old EBP' stay where they are, the callee returns straight to the caller's caller.
+	//		- The callee's arguments, on top of the STACK, go right below them in place of the caller's.
+	//		  Copied from the top, the two may overlap.
+	//		- The caller's locals are dropped.
+	int64_t iNewRBP = REGS.RBP + iCallerArgCount - iCalleeArgCount;
+	for (int32_t i = iCalleeArgCount - 1; i >= 0; i--)
+	{
+		STACK[iNewRBP + i] = STACK[REGS.RSP + i];
+	}
+
+	REGS.RSP = iNewRBP;
+	REGS.RBP = REGS.RSP;					// ESP is now the new EBP.
+	REGS.EIP = (iJumpAddress & 0x0000FFFF);	// Jump to the call address.
+}
+
 void VirtualMachine::sysCall(OPCODE eOpCode)
 {
 	int32_t iOperand = READ_OPERAND(eOpCode);
@@ -951,6 +1245,15 @@ void VirtualMachine::sysCall(OPCODE eOpCode)
 		(*m_fSysFuncCallback)(sSysFuncName, iArgCount);
 	}
 
+	// The native call()ed a script function() that parked on an 'await', the STACK now holds that function()'s frame.
+	// This 'SYSCALL' is done once resume() returns from that call(), see returnFromCall().
+	if (m_bParked && !m_vPendingCalls.empty())
+	{
+		m_vPendingCalls.back().m_iSysCallArgCount = iArgCount;
+		m_vPendingCalls.back().m_iSysCallRAX = REGS.RAX;
+		return;
+	}
+
 	REGS.RSP += iArgCount;
 }
 
@@ -1077,6 +1380,96 @@ void VirtualMachine::cast(OPCODE eOpCode)
 	}
 }
 
+void VirtualMachine::intrinsic(OPCODE eOpCode)
+{
+	float fArg1 = 0.0f, fArg2 = 0.0f, fArg3 = 0.0f;
+	float fResult = 0.0f;
+
+	/////////////////////////////////////////////////
+	// 1. Arguments were pushed left to right, so pop them in reverse.
+	switch (eOpCode)
+	{
+		case OPCODE::SINF:
+		case OPCODE::COSF:
+		case OPCODE::SQRTF:
+		case OPCODE::ABSF:
+		case OPCODE::FLOORF:
+		{
+			memcpy_s(&fArg1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+		}
+		break;
+		case OPCODE::MINF:
+		case OPCODE::MAXF:
+		{
+			memcpy_s(&fArg2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fArg1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+		}
+		break;
+		case OPCODE::LERPF:
+		{
+			memcpy_s(&fArg3, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fArg2, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+			memcpy_s(&fArg1, sizeof(float), &STACK[REGS.RSP++], sizeof(float));
+		}
+		break;
+		case OPCODE::SRAND:
+		{
+			uint32_t iSeed = (uint32_t)STACK[REGS.RSP++];
+			m_iRandomState = (iSeed != 0) ? iSeed : 1;					// xorshift gets stuck on a zero state.
+		}
+		return;
+	}
+
+	/////////////////////////////////////////////////
+	// 2. Evaluate.
+	switch (eOpCode)
+	{
+		case OPCODE::SINF:		fResult = std::sin(fArg1);					break;
+		case OPCODE::COSF:		fResult = std::cos(fArg1);					break;
+		case OPCODE::SQRTF:		fResult = std::sqrt(fArg1);					break;
+		case OPCODE::ABSF:		fResult = std::fabs(fArg1);					break;
+		case OPCODE::FLOORF:	fResult = std::floor(fArg1);				break;
+		case OPCODE::MINF:		fResult = std::fmin(fArg1, fArg2);			break;
+		case OPCODE::MAXF:		fResult = std::fmax(fArg1, fArg2);			break;
+		case OPCODE::LERPF:		fResult = fArg1 + (fArg2 - fArg1) * fArg3;	break;
+		case OPCODE::RANDF:
+		{
+			m_iRandomState ^= m_iRandomState << 13;
+			m_iRandomState ^= m_iRandomState >> 17;
+			m_iRandomState ^= m_iRandomState << 5;
+
+			fResult = (float)(m_iRandomState >> 8) * (1.0f / 16777216.0f);		// 24 bits ==> [0, 1)
+		}
+		break;
+	}
+
+	/////////////////////////////////////////////////
+	// 3. Push the result back onto the STACK.
+	memcpy_s(&STACK[--REGS.RSP], sizeof(float), &fResult, sizeof(float));
+}
+
+void VirtualMachine::awaitAsyncCall(OPCODE eOpCode)
+{
+	int32_t iHandle = STACK[REGS.RSP];			// Peek, the handle stays on the STACK till the result is in.
+
+	std::lock_guard<std::mutex> lock(m_AsyncMutex);
+	assert(iHandle >= 0 && iHandle < (int32_t)m_vAsyncCalls.size() && m_vAsyncCalls[iHandle].m_bInUse);
+	if (iHandle < 0 || iHandle >= (int32_t)m_vAsyncCalls.size())
+		return;
+
+	if (m_vAsyncCalls[iHandle].m_bCompleted)
+	{
+		STACK[REGS.RSP] = m_vAsyncCalls[iHandle].m_iResult;
+		m_vAsyncCalls[iHandle] = AsyncCall();	// Free the handle.
+	}
+	else
+	{
+		REGS.EIP -= sizeof(int8_t);				// 'AWAIT' runs again on resume().
+		m_bRunning = false;
+		m_bParked = true;
+	}
+}
+
 int32_t VirtualMachine::malloc(int32_t iSize)
 {
 	int32_t iReturnAddress = -1;
@@ -1237,6 +1630,11 @@ void* VirtualMachine::getAddressOf(int32_t iVariable)
 		int32_t iAddress = REGS.RCX + (sizeof(int32_t) * iVariablePos);
 		pRet = (HEAP + iAddress);
 	}
+	else
+	if (eVariableType == E_VARIABLESCOPE::HOST)
+	{
+		pRet = &HOSTDATA[m_vHostFieldBinding[iVariablePos]];
+	}
 	else // STATIC variable saved on the HEAP
 	{
 		pRet = &GLOBALS[iVariablePos];
@@ -1279,6 +1677,12 @@ void VirtualMachine::store(OPCODE eOpCode)
 
 		memcpy_s(iIntPtr, sizeof(int32_t), &STACK[REGS.RSP++], sizeof(int32_t));
 	}
+	else
+	if (eVariableType == E_VARIABLESCOPE::HOST)
+	{
+		assert(false);		// Host Data is read-only for the script, drop the value.
+		REGS.RSP++;
+	}
 	else // STATIC variable saved on the HEAP
 	{
 		memcpy_s(&GLOBALS[iVariablePos], sizeof(int32_t), &STACK[REGS.RSP++], sizeof(int32_t));
@@ -1318,3 +1722,225 @@ REGISTERS* VirtualMachine::getVMRegisters()
 	return &REGS;
 }
 
+int32_t VirtualMachine::getFunction(const char* sName) const
+{
+	int32_t iFunction = 0;
+	for (const ExportedFunction& pExport : m_vExports)
+	{
+		if (pExport.m_sName == sName)
+			return iFunction;
+		iFunction++;
+	}
+
+	return -1;
+}
+
+ScriptValue VirtualMachine::call(int32_t iFunction, const std::vector<ScriptValue>& vArgs)
+{
+	ScriptValue pReturnValue;
+
+	assert(iFunction >= 0 && iFunction < (int32_t)m_vExports.size());
+	if (iFunction < 0 || iFunction >= (int32_t)m_vExports.size())
+		return pReturnValue;
+
+	const ExportedFunction& pExport = m_vExports[iFunction];
+	assert(vArgs.size() == pExport.m_vArgumentTypes.size());
+	if (vArgs.size() != pExport.m_vArgumentTypes.size())
+		return pReturnValue;
+
+	/////////////////////////////////////////////////
+	// 1. Save the VM state, the host may call() from inside a 'SYSCALL'.
+	PendingCall pCall;
+	pCall.m_bHasReturnValue = pExport.m_bHasReturnValue;
+	pCall.m_eReturnType = pExport.m_eReturnType;
+	pCall.m_iSavedEIP = REGS.EIP;
+	pCall.m_iSavedRSP = REGS.RSP;
+	pCall.m_iSavedRBP = REGS.RBP;
+	pCall.m_bWasRunning = m_bRunning;
+	m_vPendingCalls.push_back(pCall);
+
+	/////////////////////////////////////////////////
+	// 2. Same STACK FRAME the compiler builds for a 'CALL'
+	//		- Call Return Address, the 'RET' lands on HOST_RETURN_ADDRESS & hands control back to the host.
+	//		- Old 'EBP'
+	//		- Arguments in reverse order('R'ight to 'L'eft), converted to the declared types.
+	STACK[--REGS.RSP] = HOST_RETURN_ADDRESS;
+	STACK[--REGS.RSP] = (int32_t)REGS.RBP;
+
+	for (int32_t i = (int32_t)vArgs.size() - 1; i >= 0; i--)
+	{
+		if (pExport.m_vArgumentTypes[i] == HOSTFIELDTYPE::FLOAT)
+		{
+			float fValue = vArgs[i].asFloat();
+			memcpy_s(&STACK[--REGS.RSP], sizeof(float), &fValue, sizeof(float));
+		}
+		else
+		{
+			STACK[--REGS.RSP] = vArgs[i].asInt();
+		}
+	}
+
+	REGS.RBP = REGS.RSP;
+	REGS.EIP = pExport.m_iEntryOffset;
+
+	/////////////////////////////////////////////////
+	// 3. Run till the function()'s 'RET'
+	m_bRunning = true;
+	while (m_bRunning && REGS.EIP != HOST_RETURN_ADDRESS)
+	{
+		eval(fetch());
+	}
+
+	/////////////////////////////////////////////////
+	// 4. Parked on an 'await', the frame stays on the STACK & the PendingCall stays on m_vPendingCalls.
+	//	  resume() runs it to its 'RET' & does the rest.
+	if (m_bParked)
+		return pReturnValue;
+
+	return returnFromCall();
+}
+
+ScriptValue VirtualMachine::returnFromCall()
+{
+	ScriptValue pReturnValue;
+
+	assert(!m_vPendingCalls.empty());
+	PendingCall pCall = m_vPendingCalls.back();
+	m_vPendingCalls.pop_back();
+
+	/////////////////////////////////////////////////
+	// 5. Return value is in 'EAX'
+	if (pCall.m_bHasReturnValue)
+	{
+		pReturnValue.m_eType = pCall.m_eReturnType;
+		memcpy_s(&pReturnValue.m_iValue, sizeof(int32_t), &REGS.RAX, sizeof(int32_t));
+	}
+
+	/////////////////////////////////////////////////
+	// 6. Restore the VM state
+	assert((int32_t)REGS.RSP == (int32_t)pCall.m_iSavedRSP);
+	REGS.EIP = pCall.m_iSavedEIP;
+	REGS.RSP = pCall.m_iSavedRSP;
+	REGS.RBP = pCall.m_iSavedRBP;
+	m_bRunning = pCall.m_bWasRunning;
+
+	/////////////////////////////////////////////////
+	// 7. Parked inside a 'SYSCALL', finish that 'SYSCALL' now.
+	if (pCall.m_iSysCallArgCount >= 0)
+	{
+		REGS.RAX = pCall.m_iSysCallRAX;
+		REGS.RSP += pCall.m_iSysCallArgCount;
+	}
+
+	return pReturnValue;
+}
+
+int32_t VirtualMachine::beginAsyncCall()
+{
+	std::lock_guard<std::mutex> lock(m_AsyncMutex);
+
+	int32_t iHandle = 0;
+	for (; iHandle < (int32_t)m_vAsyncCalls.size(); iHandle++)
+	{
+		if (!m_vAsyncCalls[iHandle].m_bInUse)
+			break;
+	}
+
+	if (iHandle == (int32_t)m_vAsyncCalls.size())
+		m_vAsyncCalls.push_back(AsyncCall());
+
+	m_vAsyncCalls[iHandle].m_bInUse = true;
+
+	return iHandle;
+}
+
+void VirtualMachine::completeAsyncCall(int32_t iHandle, int32_t iResult)
+{
+	std::lock_guard<std::mutex> lock(m_AsyncMutex);
+
+	assert(iHandle >= 0 && iHandle < (int32_t)m_vAsyncCalls.size() && m_vAsyncCalls[iHandle].m_bInUse);
+	if (iHandle >= 0 && iHandle < (int32_t)m_vAsyncCalls.size())
+	{
+		m_vAsyncCalls[iHandle].m_iResult = iResult;
+		m_vAsyncCalls[iHandle].m_bCompleted = true;
+	}
+}
+
+bool VirtualMachine::isParked() const
+{
+	return m_bParked;
+}
+
+bool VirtualMachine::resume(ScriptValue* pReturnValue)
+{
+	assert(m_bParked);
+	if (!m_bParked)
+		return true;
+
+	m_bParked = false;
+	m_bRunning = true;
+	while (m_bRunning)
+	{
+		while (m_bRunning && REGS.EIP != HOST_RETURN_ADDRESS)
+		{
+			eval(fetch());
+		}
+
+		if (m_bParked)
+			return false;
+
+		// Back at the 'RET' of a call() that parked. The code that made the call() goes on if it was running,
+		// i.e. the call() came from a 'SYSCALL'.
+		if (REGS.EIP == HOST_RETURN_ADDRESS && !m_vPendingCalls.empty())
+		{
+			ScriptValue pValue = returnFromCall();
+			if (pReturnValue != nullptr)
+				*pReturnValue = pValue;
+		}
+		else
+		{
+			m_bRunning = false;
+		}
+	}
+
+	return true;
+}
+
+int32_t VirtualMachine::addHostField(const char* sName, HOSTFIELDTYPE eType)
+{
+	int32_t iField = 0;
+	for (HostField& pHostField : m_vHostFields)
+	{
+		if (pHostField.m_sName == sName)
+			return iField;
+		iField++;
+	}
+
+	assert(m_vHostFields.size() < MAX_HOSTDATA_SIZE / sizeof(int32_t));
+	m_vHostFields.push_back(HostField(sName, eType));
+
+	return iField;
+}
+
+void VirtualMachine::setHostField(int32_t iField, int32_t iValue)
+{
+	assert(iField >= 0 && iField < (int32_t)m_vHostFields.size());
+	assert(m_vHostFields[iField].m_eType == HOSTFIELDTYPE::INT_32);
+	m_vHostFields[iField].m_iValue = iValue;
+	if (HOSTDATA != nullptr)
+	{
+		HOSTDATA[iField] = iValue;
+	}
+}
+
+void VirtualMachine::setHostField(int32_t iField, float fValue)
+{
+	assert(iField >= 0 && iField < (int32_t)m_vHostFields.size());
+	assert(m_vHostFields[iField].m_eType == HOSTFIELDTYPE::FLOAT);
+	memcpy_s(&m_vHostFields[iField].m_iValue, sizeof(int32_t), &fValue, sizeof(float));
+	if (HOSTDATA != nullptr)
+	{
+		HOSTDATA[iField] = m_vHostFields[iField].m_iValue;
+	}
+}
+
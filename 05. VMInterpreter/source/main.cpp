@@ -1,9 +1,13 @@
 #include <assert.h>
 #include <iostream>
 #include <functional>
+#include <thread>
+#include <chrono>
 #include "VirtualMachine.h"
 #include "meta/MetaFunction.h"
 
+VirtualMachine* pVM = nullptr;
+
 // Dummy System Functions.
 void glLoadIdentity()
 {
@@ -38,12 +42,27 @@ float glColor3fMul(float fRed, float fGreen, float fBlue)
 	return fRed * fGreen * fBlue;
 }
 
+// Stand-in for a slow native(asset lookup, file read...), completes on a background thread after 'iDelayMs'.
+int32_t loadAssetAsync(int32_t iDelayMs)
+{
+	int32_t iHandle = pVM->beginAsyncCall();
+	std::thread([iHandle, iDelayMs]()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(iDelayMs));
+		pVM->completeAsyncCall(iHandle, iDelayMs * 10);
+	}).detach();
+
+	std::cout << "In loadAssetAsync(" << iDelayMs << ", handle = " << iHandle << ");" << std::endl;
+	return iHandle;
+}
+
 META_REGISTER_FUN(glLoadIdentity);
 META_REGISTER_FUN(glClearColor);
 META_REGISTER_FUN(glColor3f);
 META_REGISTER_FUN(retSysFunc);
 META_REGISTER_FUN(retFloatFunc);
 META_REGISTER_FUN(glColor3fMul);
+META_REGISTER_FUN(loadAssetAsync);
 
 void scriptTest()
 {
@@ -66,7 +85,6 @@ void scriptTest()
 	}
 }
 
-VirtualMachine* pVM = nullptr;
 void onScriptCallback(const char* sSysFuncName, int16_t iArgCount);
 int main(int argc, char* argv[])
 {
@@ -78,9 +96,23 @@ int main(int argc, char* argv[])
 
 	std::function<void(const char* sSysFuncName, int16_t iArgCount)> fSysFuncCallback = onScriptCallback;
 	pVM = VirtualMachine::create(&fSysFuncCallback);
+
+	// Host Data read by TestCases/hostData.c, set before the script is loaded.
+	int32_t iAnswerField = pVM->addHostField("iHD_Answer", HOSTFIELDTYPE::INT_32);
+	pVM->setHostField(iAnswerField, 42);
+	int32_t iScaleField = pVM->addHostField("fHD_Scale", HOSTFIELDTYPE::FLOAT);
+	pVM->setHostField(iScaleField, 2.5f);
+
 	pVM->loadFile(argv[1]);
 	pVM->start();
 
+	// Parked on an 'await', this thread is free for other work till the native completes.
+	while (pVM->isParked())
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		pVM->resume();
+	}
+
 	exit(EXIT_SUCCESS);
 }
 
@@ -2,6 +2,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
+#include <chrono>
 
 #include "extern/window.cpp"
 #include "extern/gl.cpp"
@@ -34,12 +36,54 @@ void funcStr(const char* sStr)
 	std::cout << sStr << std::endl;
 }
 
+//bound class for the lua bridge benchmark
+namespace Demo{
+	class Counter{
+	public:
+		Counter() : m_total(0){}
+
+		float32 add(float32 _value){ m_total += _value; return m_total; }
+	private:
+		float32 m_total;
+	};
+}
+
+BEGIN_META_CLASS_DEFINITION(Demo, Counter)
+	ADD_MEMBER_FUNCTION("add", &Demo::Counter::add)
+END_META_CLASS_DEFINITION(Demo, Counter)
+
+//member function calls per second, MetaLuaCMemberFunction vs the typed thunks
+void benchmarkLuaBridge(lua_State* L){
+	const int32 numCalls = 1000000;
+	const char* script =
+		"local c = Counter.new()\n"
+		"for i = 1, 1000000 do c.add(1.5) end\n";
+
+	for (int32 pass = 0; pass < 2; pass++){
+		g_bMetaLuaThunks = (pass == 1);
+
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		if (luaL_dostring(L, script))
+			error(L, "benchmark failed: %s", lua_tostring(L, -1));
+		std::chrono::duration<float64> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+		std::cout << (g_bMetaLuaThunks ? "thunk   : " : "generic : ") << (float64)numCalls / elapsed.count() << " calls/sec" << std::endl;
+	}
+	g_bMetaLuaThunks = true;
+}
+
 int main(int argc, char* argv[]){
 	//Init lua state and bind variables and function defined at global scope
 	lua_State* L = luaL_newstate();
 	luaL_openlibs(L);
 	MetaBind(L);
 
+	if (argc > 1 && strcmp(argv[1], "-bench") == 0){
+		benchmarkLuaBridge(L);
+		lua_close(L);
+		return 0;
+	}
+
 	//create window
 	Window wnd = Window("Lua extension demo", 1024, 768, 40, 40, DEBUG_CONTEXT | MULTISAMPLE16 | RGB24 | ALPHA8 | DEPTH16 | DOUBLE_BUFFER);
 	
@@ -2,6 +2,7 @@
 #define LUA_META_CLASS_TYPE_H
 
 #include <map>
+#include <string>
 #include <assert.h>
 #include "MetaType.h"
 #include "MetaMemberFunction.h"
@@ -24,6 +25,7 @@ public:
 		MetaMemberFunction<Cls> **temp = new MetaMemberFunction<Cls>*[m_numFunctions];
 		memcpy(temp, m_Functions, (m_numFunctions - 1)*sizeof(MetaMemberFunction<Cls>*));
 		temp[m_numFunctions - 1] = new NonConstMetaMemberFunction<Cls>(_name, _fun);
+		temp[m_numFunctions - 1]->setLuaThunk(MetaLuaThunk<Cls, false, Ret, Args...>::function());
 		delete[] m_Functions;
 		m_Functions = temp;
 	}
@@ -34,6 +36,7 @@ public:
 		MetaMemberFunction<Cls> **temp = new MetaMemberFunction<Cls>*[m_numFunctions];
 		memcpy(temp, m_Functions, (m_numFunctions - 1)*sizeof(MetaMemberFunction<Cls>*));
 		temp[m_numFunctions - 1] = new ConstMetaMemberFunction<Cls>(_name, _fun);
+		temp[m_numFunctions - 1]->setLuaThunk(MetaLuaThunk<Cls, true, Ret, Args...>::function());
 		delete[] m_Functions;
 		m_Functions = temp;
 	}
@@ -56,11 +59,12 @@ public:
 
 	
 	virtual const char* toString(void *v) const {
-		const char* str = "";
+		m_string.clear();
 		for (std::map<size_t, MetaClassAttribute<Cls>*>::const_iterator it = m_Attributes.begin(); it != m_Attributes.end(); it++){
-			str += it->second->type()->toString((void*)((char*)v + it->second->offset())) + ";";
+			m_string += it->second->type()->toString((void*)((char*)v + it->second->offset()));
+			m_string += ";";
 		}
-		return str;
+		return m_string.c_str();
 	}
 	virtual float64 toNumber(void* v) const { return 0; }; //TODO
 
@@ -69,7 +73,7 @@ public:
 		lua_createtable(L, static_cast<unsigned int>(m_numAttributes), 1);
 		int table = lua_gettop(L);
 
-		luaL_newmetatable(L, m_name.c_str());
+		luaL_newmetatable(L, m_name);
 		int metatable = lua_gettop(L);
 
 		lua_pushstring(L, "__metatable"); //hide metatable
@@ -89,16 +93,22 @@ public:
 		lua_settable(L, table);
 
 		for (size_t i = 0; i < m_numFunctions; i++){ //add functions
-			lua_pushstring(L, m_Functions[i]->name().c_str());
-			lua_pushlightuserdata(L, v);
-			lua_pushlightuserdata(L, m_Functions[i]);
-			lua_pushcclosure(L, MetaLuaCMemberFunction<Cls>, 2);
+			lua_pushstring(L, m_Functions[i]->name());
+			MetaLuaPushClosure<Cls> thunk = m_Functions[i]->luaThunk();
+			if (g_bMetaLuaThunks && thunk){
+				thunk(L, v, m_Functions[i]);
+			}
+			else{
+				lua_pushlightuserdata(L, v);
+				lua_pushlightuserdata(L, m_Functions[i]);
+				lua_pushcclosure(L, MetaLuaCMemberFunction<Cls>, 2);
+			}
 			lua_settable(L, table);
 		}
 
 		//add attributes
 		for (std::map<size_t, MetaClassAttribute<Cls>*>::const_iterator it = m_Attributes.begin(); it != m_Attributes.end(); it++){
-			lua_pushstring(L, it->second->name().c_str());
+			lua_pushstring(L, it->second->name());
 			it->second->type()->luaSet(L, (char*)v + it->second->offset());
 			lua_settable(L, table);
 		}
@@ -109,7 +119,7 @@ public:
 	virtual void luaGet(lua_State *L, int index, void *v) const{
 		int i = 0;
 		for (std::map<size_t, MetaClassAttribute<Cls>*>::const_iterator it = m_Attributes.begin(); it != m_Attributes.end(); it++){
-			lua_pushstring(L, it->second->name().c_str());
+			lua_pushstring(L, it->second->name());
 			lua_gettable(L, index-i);
 			it->second->type()->luaGet(L, -1, (char*)v + it->second->offset());
 			i++;
@@ -132,6 +142,7 @@ private:
 	MetaMemberFunction<Cls> **m_Functions;
 	size_t m_numAttributes;
 	std::map<size_t, MetaClassAttribute<Cls>*> m_Attributes;
+	mutable std::string m_string; //last toString()
 };
 
 
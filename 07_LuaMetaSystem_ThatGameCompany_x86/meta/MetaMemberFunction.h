@@ -275,6 +275,13 @@ void ApplyWrapper(void(Cls::*fun)(), Cls* cls, Variable Ret, Variable* args, siz
 	Apply((Fun)fun, cls, Ret, args, argCount);
 }
 
+template <typename Cls>
+class MetaMemberFunction;
+
+//Pushes the lua closure of a member function bound to an object(see MetaLuaThunk::pushClosure)
+template <typename Cls>
+using MetaLuaPushClosure = void(*)(lua_State* L, void* _cls, const MetaMemberFunction<Cls>* _fun);
+
 template <typename Cls>
 class MetaMemberFunction{
 public:
@@ -291,8 +298,12 @@ public:
 	virtual size_t argCount() const { return m_sig.ArgCount(); }
 
 	virtual void apply(void *cls, Variable ret, Variable* args, size_t argCount) const = 0;
+
+	MetaLuaPushClosure<Cls> luaThunk() const { return m_luaThunk; }
+	void setLuaThunk(MetaLuaPushClosure<Cls> _thunk) { m_luaThunk = _thunk; }
 protected:
 	void(*m_applyWrapper) (void(Cls::*fun)(), Cls* cls, Variable, Variable*, size_t);
+	MetaLuaPushClosure<Cls> m_luaThunk = nullptr;
 	const char* m_name;
 	MemberFunctionSignature<Cls> m_sig;
 };
@@ -323,6 +334,9 @@ public:
 	void apply(void *cls, Variable ret, Variable* args, size_t argCount) const{
 		m_applyWrapper(m_fun, reinterpret_cast<Cls*>(cls), ret, args, argCount);
 	}
+
+	typedef void (Cls::*Fun) ();
+	Fun function() const { return m_fun; }
 private:
 	void (Cls::*m_fun) ();
 };
@@ -340,6 +354,9 @@ public:
 		m_applyWrapper(const_cast<void(Cls::*)()>(m_fun), reinterpret_cast<Cls*>(cls), ret, args, argCount);
 	}
 
+	typedef void (Cls::*Fun) () const;
+	Fun function() const { return m_fun; }
+
 private:
 	void (Cls::*m_fun) () const;
 };
@@ -0,0 +1,3 @@
+//Defined once for the whole program, luaRegister.h only declares it. The meta headers are not
+//included here as each translation unit that includes them registers its own base MetaTypes.
+bool g_bMetaLuaThunks = true;
@@ -8,9 +8,15 @@ extern "C"{
 }
 
 #include <assert.h>
+#include <type_traits>
+#include <utility>
 #include "MetaFunction.h"
+#include "MetaMemberFunction.h"
 #include "MetaClassType.h"
 
+//Member functions bound with a typed thunk(see MetaLuaThunk), set to false to fall back on MetaLuaCMemberFunction
+extern bool g_bMetaLuaThunks;
+
 //Function to create a Cls Object in lua
 template <typename Cls>
 static int MetaLuaCConstructor(lua_State* L){
@@ -59,6 +65,125 @@ static int MetaLuaCMemberFunction(lua_State* L){
 	return ret.m_type->sizeOf() > 0 ? 1 : 0;
 }
 
+//Reads/writes a C++ value straight off the lua stack, no MetaType or Variable in between.
+//Types without a specialization have no fast path & stay on MetaLuaCMemberFunction.
+template <typename T, typename Enable = void>
+struct LuaStack{
+	enum { FastPath = false };
+};
+
+template <typename T>
+struct LuaStack<T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type>{
+	enum { FastPath = true };
+	static T get(lua_State* L, int index){ return static_cast<T>(lua_tonumber(L, index)); }
+	static void push(lua_State* L, T v){ lua_pushnumber(L, static_cast<lua_Number>(v)); }
+};
+
+template <>
+struct LuaStack<bool>{
+	enum { FastPath = true };
+	static bool get(lua_State* L, int index){ return lua_toboolean(L, index) != 0; }
+	static void push(lua_State* L, bool v){ lua_pushboolean(L, v); }
+};
+
+template <>
+struct LuaStack<const char8*>{
+	enum { FastPath = true };
+	static const char8* get(lua_State* L, int index){ return lua_tostring(L, index); }
+	static void push(lua_State* L, const char8* v){ lua_pushstring(L, v); }
+};
+
+template <typename T>
+struct LuaStack<T*, typename std::enable_if<!std::is_same<T, const char8>::value>::type>{
+	enum { FastPath = true };
+	static T* get(lua_State* L, int index){ return reinterpret_cast<T*>(lua_touserdata(L, index)); }
+	static void push(lua_State* L, T* v){ lua_pushlightuserdata(L, (void*)v); }
+};
+
+template <typename ...Args>
+struct LuaStackAll{
+	enum { FastPath = true };
+};
+
+template <typename Arg, typename ...Args>
+struct LuaStackAll<Arg, Args...>{
+	enum { FastPath = LuaStack<typename std::decay<Arg>::type>::FastPath && LuaStackAll<Args...>::FastPath };
+};
+
+//Pushes the return value, if any, & gives the lua return count
+template <typename Ret>
+struct MetaLuaReturn{
+	enum { FastPath = LuaStack<typename std::decay<Ret>::type>::FastPath };
+
+	template <typename Invoke>
+	static int call(lua_State* L, Invoke _invoke){
+		LuaStack<typename std::decay<Ret>::type>::push(L, _invoke());
+		return 1;
+	}
+};
+
+template <>
+struct MetaLuaReturn<void>{
+	enum { FastPath = true };
+
+	template <typename Invoke>
+	static int call(lua_State* L, Invoke _invoke){
+		_invoke();
+		return 0;
+	}
+};
+
+//Memberfunction Callback from lua, one per signature instantiated by ClassMetaType::addMember().
+//The object & the member function pointer are copied into the closure's upvalue when it is created,
+//arguments are read from the lua stack into typed locals & the member function is called directly.
+template <typename Cls, bool Const, typename Ret, typename ...Args>
+struct MetaLuaThunk{
+	typedef typename std::conditional<Const, Ret(Cls::*)(Args...) const, Ret(Cls::*)(Args...)>::type Fun;
+
+	struct Binding{
+		Cls* m_cls;
+		Fun m_fun;
+	};
+
+	//nullptr if any type has no LuaStack fast path
+	static MetaLuaPushClosure<Cls> function(){
+		return function(std::integral_constant<bool, MetaLuaReturn<Ret>::FastPath && LuaStackAll<Args...>::FastPath>());
+	}
+
+	static MetaLuaPushClosure<Cls> function(std::true_type){ return &MetaLuaThunk::pushClosure; }
+	static MetaLuaPushClosure<Cls> function(std::false_type){ return nullptr; }
+
+	static Fun memberFunction(const MetaMemberFunction<Cls>* _fun, std::false_type){
+		return reinterpret_cast<Fun>(static_cast<const NonConstMetaMemberFunction<Cls>*>(_fun)->function());
+	}
+
+	static Fun memberFunction(const MetaMemberFunction<Cls>* _fun, std::true_type){
+		return reinterpret_cast<Fun>(static_cast<const ConstMetaMemberFunction<Cls>*>(_fun)->function());
+	}
+
+	//Pushes the closure for _fun bound to _cls, the Binding is a full userdata so lua owns it
+	static void pushClosure(lua_State* L, void* _cls, const MetaMemberFunction<Cls>* _fun){
+		Binding* binding = reinterpret_cast<Binding*>(lua_newuserdata(L, sizeof(Binding)));
+		binding->m_cls = reinterpret_cast<Cls*>(_cls);
+		binding->m_fun = memberFunction(_fun, std::integral_constant<bool, Const>());
+		lua_pushcclosure(L, &MetaLuaThunk::call, 1);
+	}
+
+	template <size_t ...I>
+	static Ret invoke(lua_State* L, Cls* cls, Fun fun, std::index_sequence<I...>){
+		return (cls->*fun)(LuaStack<typename std::decay<Args>::type>::get(L, 1 + static_cast<int>(I))...);
+	}
+
+	static int call(lua_State* L){
+		const Binding* binding = reinterpret_cast<const Binding*>(lua_touserdata(L, lua_upvalueindex(1)));
+		assert(binding && binding->m_cls);
+
+		Cls* cls = binding->m_cls;
+		Fun fun = binding->m_fun;
+		return MetaLuaReturn<Ret>::call(L, [L, cls, fun](){ return invoke(L, cls, fun, std::index_sequence_for<Args...>()); });
+	}
+};
+
 //standard lua function callback
 static int MetaLuaCFunction(lua_State* L){
 	void *upval = lua_touserdata(L, lua_upvalueindex(1));
@@ -3,6 +3,20 @@
 #include "Engine/EngineManager.h"
 #include "VirtualMachine.h"
 
+enum class EHOSTFIELD
+{
+	MOUSE_X,
+	MOUSE_Y,
+	SCREEN_WIDTH,
+	SCREEN_HEIGHT,
+	DELTATIME_MS,
+	ELAPSEDTIME_SEC,
+	KEYS_0,					// Keyboard bitset, 8 x 32 bits ==> 256 keys.
+	KEYS_7 = KEYS_0 + 7,
+
+	MAX
+};
+
 class Dream3DTest : public EngineManager
 {
 	public:
@@ -26,6 +40,11 @@ class Dream3DTest : public EngineManager
 protected:
 	private:
 		VirtualMachine*			m_pVM;
+		int32_t					m_iHostFields[(int)EHOSTFIELD::MAX];
+		int32_t					m_iUpdateFunction;
+
+		void					registerHostData();
+		void					updateHostData();
 		void					onScriptCallback(const char* sSysFuncName, int16_t iArgCount);
 };
 
@@ -57,10 +57,17 @@ void Dream3DTest::initialize()
 	};
 
 	m_pVM = VirtualMachine::create(&fSysFuncCallback);
+	registerHostData();
+
 	const char* sFileName = "TestCases/main.o";
 	m_pVM->loadFile(sFileName);
 
 	LoadOpenGLFunctions(false);
+
+	// main() sets up the script state once, update() is called every frame.
+	updateHostData();
+	m_pVM->start();
+	m_iUpdateFunction = m_pVM->getFunction("update");
 }
 
 void Dream3DTest::update(float elapsedTime)
@@ -70,7 +77,51 @@ void Dream3DTest::update(float elapsedTime)
 
 void Dream3DTest::render(float elapsedTime)
 {
-	m_pVM->start();
+	updateHostData();
+	if (m_pVM->isParked())
+		m_pVM->resume();					// Still waiting on an async native, the frame goes on without the script.
+	else
+		m_pVM->call(m_iUpdateFunction, {});
+}
+
+void Dream3DTest::registerHostData()
+{
+	m_iHostFields[(int)EHOSTFIELD::MOUSE_X] = m_pVM->addHostField("iHD_MouseX", HOSTFIELDTYPE::INT_32);
+	m_iHostFields[(int)EHOSTFIELD::MOUSE_Y] = m_pVM->addHostField("iHD_MouseY", HOSTFIELDTYPE::INT_32);
+	m_iHostFields[(int)EHOSTFIELD::SCREEN_WIDTH] = m_pVM->addHostField("iHD_ScreenWidth", HOSTFIELDTYPE::INT_32);
+	m_iHostFields[(int)EHOSTFIELD::SCREEN_HEIGHT] = m_pVM->addHostField("iHD_ScreenHeight", HOSTFIELDTYPE::INT_32);
+	m_iHostFields[(int)EHOSTFIELD::DELTATIME_MS] = m_pVM->addHostField("fHD_DeltaTimeMs", HOSTFIELDTYPE::FLOAT);
+	m_iHostFields[(int)EHOSTFIELD::ELAPSEDTIME_SEC] = m_pVM->addHostField("fHD_ElapsedTimeSec", HOSTFIELDTYPE::FLOAT);
+
+	char sKeysName[16] = { 0 };
+	for (int i = (int)EHOSTFIELD::KEYS_0; i <= (int)EHOSTFIELD::KEYS_7; i++)
+	{
+		sprintf_s(sKeysName, "iHD_Keys%d", i - (int)EHOSTFIELD::KEYS_0);
+		m_iHostFields[i] = m_pVM->addHostField(sKeysName, HOSTFIELDTYPE::INT_32);
+	}
+}
+
+void Dream3DTest::updateHostData()
+{
+	m_pVM->setHostField(m_iHostFields[(int)EHOSTFIELD::MOUSE_X], m_iMouseX);
+	m_pVM->setHostField(m_iHostFields[(int)EHOSTFIELD::MOUSE_Y], m_iMouseY);
+	m_pVM->setHostField(m_iHostFields[(int)EHOSTFIELD::SCREEN_WIDTH], (int32_t)getWidth());
+	m_pVM->setHostField(m_iHostFields[(int)EHOSTFIELD::SCREEN_HEIGHT], (int32_t)getHeight());
+	m_pVM->setHostField(m_iHostFields[(int)EHOSTFIELD::DELTATIME_MS], (float)getTimer()->getDeltaTimeMs());
+	m_pVM->setHostField(m_iHostFields[(int)EHOSTFIELD::ELAPSEDTIME_SEC], (float)getTimer()->getElapsedTimeInSec());
+
+	// Keyboard bitset, key 'k' ==> bit (k % 32) of iHD_Keys(k / 32).
+	int32_t iKeys[8] = { 0 };
+	for (int32_t iKey = 0; iKey < DEF_MAX_KEYS; iKey++)
+	{
+		if (isKeyPressed(iKey))
+			iKeys[iKey >> 5] |= (1 << (iKey & 31));
+	}
+
+	for (int i = 0; i < 8; i++)
+	{
+		m_pVM->setHostField(m_iHostFields[(int)EHOSTFIELD::KEYS_0 + i], iKeys[i]);
+	}
 }
 	 
 void Dream3DTest::keyPressedEx(unsigned int iVirtualKeycode, unsigned short ch)